@@ -44,11 +44,11 @@
  *----------------------------------------------------------*/               
 
 #define configUSE_PREEMPTION		1
-#define configUSE_IDLE_HOOK			0
+#define configUSE_IDLE_HOOK			1
 #define configUSE_TICK_HOOK			0
 #define configCPU_CLOCK_HZ			( ( unsigned long ) 60000000 )	/* =12.0MHz xtal multiplied by 5 using the PLL. */
 #define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
-#define configMAX_PRIORITIES		( 4 )
+#define configMAX_PRIORITIES		( 5 )
 #define configMINIMAL_STACK_SIZE	( ( unsigned short ) 90 )
 #define configTOTAL_HEAP_SIZE		( ( size_t ) 13 * 1024 )
 #define configMAX_TASK_NAME_LEN  	( 8 )
@@ -58,92 +58,92 @@
 #define configUSE_TIME_SLICING           1
 #define configSUPPORT_DYNAMIC_ALLOCATION 1
 #define configUSE_MUTEXES                1
-#define configUSE_APPLICATION_TASK_TAG   1
+#define configUSE_APPLICATION_TASK_TAG   0
+
+/* Stop the tick while only the idle task can run; Timer0 is reprogrammed up to the next release */
+#define configUSE_TICKLESS_IDLE                2
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP  2
+extern void vApplicationSleep( uint32_t ulExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vApplicationSleep( xExpectedIdleTime )
+
+/* One-shot Timer0 matches programmed to the next tick with work instead of a 1 kHz tick; needs configUSE_TICKLESS_IDLE 0 */
+#define configUSE_EVENT_DRIVEN_TICK            0
+extern uint32_t ulApplicationGetElapsedTicks( void );
+extern void vApplicationSetNextTickEvent( uint32_t ulTickNow, uint32_t ulTicksToEvent );
+#define portGET_ELAPSED_TICKS() ulApplicationGetElapsedTicks()
+#define portSET_NEXT_TICK_EVENT( xTickNow, xTicksToEvent ) vApplicationSetNextTickEvent( ( xTickNow ), ( xTicksToEvent ) )
+
+/* Catch up suspended ticks in one pass, skipping the releases a periodic task fell behind on (counted as misses) */
+#define configUSE_BULK_TICK_CATCH_UP           0
+
+/* CPU load over sliding 100 ms / 1 s / 10 s windows, sampled from the run time counter by the tick */
+#define configUSE_CPU_LOAD_WINDOWS             1
+
+/* Scheduling events recorded in RAM, stamped with T1TC, and streamed over the UART at idle priority (see trace_decode.py) */
+#define configUSE_TRACE_RECORDER               0
+#define configTRACE_RECORDER_RECORDS           128
+
+/* Per-task log2 histograms of job response time, lateness and release jitter in run time counter counts */
+#define configUSE_JOB_HISTOGRAMS               1
+
+/* Number of the running task on P0.10-P0.13 (0 = idle), a pulse on P0.15 at each job release and on P0.16 at each deadline miss, for a logic analyser.
+Written through IOSET0/IOCLR0 only, never an IOPIN0 read-modify-write; the ID pins read 0 for the few cycles between the two writes of a switch */
+#define configUSE_GPIO_TASK_TRACE              0
+#define configGPIO_TRACE_ID_SHIFT              10
+#define configGPIO_TRACE_ID_MASK               ( 0xFUL << configGPIO_TRACE_ID_SHIFT )
+#define configGPIO_TRACE_RELEASE_PIN           ( 1UL << 15 )
+#define configGPIO_TRACE_MISS_PIN              ( 1UL << 16 )
+#define configGPIO_TRACE_PINS                  ( configGPIO_TRACE_ID_MASK | configGPIO_TRACE_RELEASE_PIN | configGPIO_TRACE_MISS_PIN )
+#define portGPIO_TRACE_TASK( uxNumber )        { IOCLR0 = configGPIO_TRACE_ID_MASK; IOSET0 = ( ( uint32_t ) ( uxNumber ) << configGPIO_TRACE_ID_SHIFT ) & configGPIO_TRACE_ID_MASK; }
+#define portGPIO_TRACE_RELEASE()               { IOSET0 = configGPIO_TRACE_RELEASE_PIN; IOCLR0 = configGPIO_TRACE_RELEASE_PIN; }
+#define portGPIO_TRACE_MISS()                  { IOSET0 = configGPIO_TRACE_MISS_PIN; IOCLR0 = configGPIO_TRACE_MISS_PIN; }
+
+/* Deepest stack use of each periodic task and of idle printed over the UART every 10 s, as #define lines for stack_sizes.h (see main.c).
+Off by default: Uart_Receiver's messages are dropped while the UART is busy with a report line */
+#define configUSE_STACK_REPORT                 0
+
+/* Cycles spent in the tick, the context switch, ready list inserts and the kernel's critical sections, timed on the PWM
+timer counting PCLK (= CCLK, see VPBDIV); min/avg/max printed over the UART every 10 s */
+#define configUSE_KERNEL_PROFILING             0
+#define portPROFILE_GET_TIME()                 ( ( uint32_t ) PWMTC )
+
+/* Cycles from an interrupt marked with vTaskLatencyEnterISR()/vTaskLatencyExitISR() to the first run of the task it woke,
+min/avg/max per source, on the PWM timer; printed with the kernel profile every 10 s */
+#define configUSE_ISR_LATENCY                  0
+#define configISR_LATENCY_SOURCES              4
+#define portLATENCY_GET_TIME()                 ( ( uint32_t ) PWMTC )
 
 #define configUSE_EDF_SCHEDULER   1
-
-#define TIMER_TRACE_Config 1
-
-
-#if ( TIMER_TRACE_Config == 1 )	
-
-extern int button1_TaskInTime,  button1_TaskOutTime,  button1_TaskTotalTime;
-extern int button2_TaskInTime,  button2_TaskOutTime,  button2_TaskTotalTime;
-extern int Transmitter_TaskInTime, Transmitter_TaskOutTime, Transmitter_TaskTotalTime;
-extern int Consumer_TaskInTime,     Consumer_TaskOutTime,     Consumer_TaskTotalTime;
-extern int load1_TaskInTime,    load1_TaskOutTime,    load1_TaskTotalTime;
-extern int load2_TaskInTime,    load2_TaskOutTime,    load2_TaskTotalTime;
-
-extern int system_Time;
-extern int cpu_Load;
-
-#define traceTASK_SWITCHED_OUT()	if ((int)pxCurrentTCB->pxTaskTag == 1)\
-		{\
-	         button1_TaskOutTime = T1TC;\
-	         button1_TaskTotalTime += (button1_TaskOutTime - button1_TaskInTime);\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 2)\
-		{\
-			button2_TaskOutTime = T1TC;\
-			button2_TaskTotalTime += (button2_TaskOutTime - button2_TaskInTime);\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 3)\
-		{\
-			Transmitter_TaskOutTime = T1TC;\
-			Transmitter_TaskTotalTime += (Transmitter_TaskOutTime - Transmitter_TaskInTime);\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 4)\
-		{\
-			Consumer_TaskOutTime = T1TC;\
-			Consumer_TaskTotalTime += (Consumer_TaskOutTime - Consumer_TaskInTime);\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 5)\
-		{\
-			load1_TaskOutTime = T1TC;\
-			load1_TaskTotalTime += (load1_TaskOutTime - load1_TaskInTime);\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 6)\
-		{\
-			load2_TaskOutTime = T1TC;\
-			load2_TaskTotalTime += (load2_TaskOutTime - load2_TaskInTime);\
-		}\
-		system_Time = T1TC;\
-		cpu_Load = ((  button1_TaskTotalTime + button2_TaskTotalTime\
-				+ Transmitter_TaskTotalTime + Consumer_TaskTotalTime\
-				+ load1_TaskTotalTime +load2_TaskTotalTime ) / (float)system_Time ) * 100;
-
-#define traceTASK_SWITCHED_IN()	  if ((int)pxCurrentTCB->pxTaskTag == 1)\
-		{\
-	        button1_TaskInTime = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 2)\
-		{\
-			button2_TaskInTime = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 3)\
-		{\
-			Transmitter_TaskInTime = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 4)\
-		{\
-			Consumer_TaskInTime = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 5)\
-		{\
-			load1_TaskInTime = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 6)\
-		{\
-			load2_TaskInTime = T1TC;\
-		}
-
-#endif
+/* Priority band scheduled by EDF; priorities above it stay fixed-priority (e.g. a watchdog feeder) */
+#define configEDF_PRIORITY_BAND   1
+/* Periodic task priorities when configUSE_EDF_SCHEDULER is 0: 1 = rate monotonic, 2 = deadline monotonic */
+#define configPERIODIC_PRIORITY_ASSIGNMENT 1
+/* Opt-in EDF admission test: the densities C/D of the periodic tasks with a known WCET must add up to 1 or less, else
+vTaskStartScheduler() asserts.  Tasks from xTaskPeriodicCreate() have no WCET and are left out */
+#define configUSE_EDF_PARTITION_ANALYSIS 0
+/* EDF deadlines in Timer1 counts (PCLK / ( T1PR + 1 )) instead of ticks, for xTaskPeriodicCreateFine() */
+#define configUSE_EDF_FINE_DEADLINES 0
+#define configEDF_DEADLINE_TIMER_HZ  ( configCPU_CLOCK_HZ / 1001UL )
+#define portEDF_GET_DEADLINE_TIME()  ( ( uint32_t ) T1TC )
+
+/* Per-task run time from Timer1, started in prvSetupHardware().  T1TC wraps after 2^32 counts (about 20 hours), so it is
+extended to 64 bits by ullApplicationGetRunTime() in main.c; the trace only needs the low 32 bits and reads T1TC itself */
+#define configGENERATE_RUN_TIME_STATS           1
+#define configRUN_TIME_COUNTER_TYPE             uint64_t
+extern uint64_t ullApplicationGetRunTime( void );
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()        ullApplicationGetRunTime()
+#define portTRACE_GET_TIME()                    ( ( uint32_t ) T1TC )
+#define configRUN_TIME_COUNTER_HZ               ( configCPU_CLOCK_HZ / 1001UL )
 
 #define configQUEUE_REGISTRY_SIZE 0
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 		      0
 #define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+/* Co-routines of priority configEDF_CO_ROUTINE_PRIORITY_BAND (default the highest) in deadline order, and
+xCoRoutinePeriodicCreate() in croutine_ext.h; needs configUSE_CO_ROUTINES, configUSE_IDLE_HOOK and croutine.c from this directory */
+#define configUSE_EDF_CO_ROUTINES       0
 
 /* Set the following definitions to 1 to include the API function, or zero
 to exclude the API function. */
@@ -155,6 +155,8 @@ to exclude the API function. */
 #define INCLUDE_vTaskSuspend			  1
 #define INCLUDE_vTaskDelayUntil		   	  1
 #define INCLUDE_vTaskDelay				  1
+#define INCLUDE_xTaskGetIdleTaskHandle	  1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
 
 
 
@@ -0,0 +1,599 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "croutine.h"
+#include "croutine_ext.h"
+
+/* Remove the whole file is co-routines are not being used. */
+#if ( configUSE_CO_ROUTINES != 0 )
+
+/*
+ * Some kernel aware debuggers require data to be viewed to be global, rather
+ * than file scope.
+ */
+    #ifdef portREMOVE_STATIC_QUALIFIER
+        #define static
+    #endif
+
+/* When set to 1 the ready list of co-routine priority
+ * configEDF_CO_ROUTINE_PRIORITY_BAND is kept in deadline order, as the EDF band
+ * of the task ready lists is, and xCoRoutinePeriodicCreate() is available.
+ * vCoRoutineSchedule() then runs the co-routine of the band with the earliest
+ * deadline whenever no co-routine of a higher priority is ready.  A co-routine
+ * created in the band by xCoRoutineCreate() has no deadline and runs after
+ * every co-routine that has one, round robin with the others that have none.
+ *
+ * All the co-routines share the stack of the task that calls
+ * vCoRoutineSchedule(): the idle task from its hook, or a task of the EDF band
+ * that calls it in a loop, which then gives the co-routines the processor time
+ * left by the tasks with earlier deadlines. */
+    #ifndef configUSE_EDF_CO_ROUTINES
+        #define configUSE_EDF_CO_ROUTINES    0
+    #endif
+
+    #if ( configUSE_EDF_CO_ROUTINES == 1 )
+        #ifndef configEDF_CO_ROUTINE_PRIORITY_BAND
+            #define configEDF_CO_ROUTINE_PRIORITY_BAND    ( configMAX_CO_ROUTINE_PRIORITIES - 1 )
+        #endif
+
+        #if ( configEDF_CO_ROUTINE_PRIORITY_BAND >= configMAX_CO_ROUTINE_PRIORITIES )
+            #error configEDF_CO_ROUTINE_PRIORITY_BAND must be below configMAX_CO_ROUTINE_PRIORITIES
+        #endif
+    #endif
+
+
+/* Lists for ready and blocked co-routines. --------------------*/
+    static List_t pxReadyCoRoutineLists[ configMAX_CO_ROUTINE_PRIORITIES ]; /*< Prioritised ready co-routines. */
+    static List_t xDelayedCoRoutineList1;                                   /*< Delayed co-routines. */
+    static List_t xDelayedCoRoutineList2;                                   /*< Delayed co-routines (two lists are used - one for delays that have overflowed the current tick count. */
+    static List_t * pxDelayedCoRoutineList = NULL;                          /*< Points to the delayed co-routine list currently being used. */
+    static List_t * pxOverflowDelayedCoRoutineList = NULL;                  /*< Points to the delayed co-routine list currently being used to hold co-routines that have overflowed the current tick count. */
+    static List_t xPendingReadyCoRoutineList;                               /*< Holds co-routines that have been readied by an external event.  They cannot be added directly to the ready lists as the ready lists cannot be accessed by interrupts. */
+
+/* Other file private variables. --------------------------------*/
+    CRCB_t * pxCurrentCoRoutine = NULL;
+    static UBaseType_t uxTopCoRoutineReadyPriority = 0;
+    static TickType_t xCoRoutineTickCount = 0, xLastTickCount = 0, xPassedTicks = 0;
+
+/* The initial state of the co-routine when it is created. */
+    #define corINITIAL_STATE    ( 0 )
+
+    #if ( configUSE_EDF_CO_ROUTINES == 1 )
+
+/*
+ * The control block of every co-routine when configUSE_EDF_CO_ROUTINES is set.
+ * croutine.h fixes CRCB_t, so the deadline follows it in a larger block that
+ * the rest of this file still handles as a CRCB_t.
+ */
+        typedef struct corEDFCoRoutineControlBlock
+        {
+            CRCB_t xCRCB;                  /*< Must be first, a pointer to the block is used as a pointer to the CRCB_t. */
+            TickType_t xPeriod;            /*< 0 for a co-routine without a period, which has no deadline. */
+            TickType_t xRelativeDeadline;  /*< Deadline of each job, relative to its release. */
+            TickType_t xRelease;           /*< Release of the current job. */
+            TickType_t xDeadline;          /*< Deadline of the current job, the order of the EDF band. */
+            UBaseType_t uxMisses;          /*< Jobs that ended after their deadline. */
+        } EDFCRCB_t;
+
+        #define corCRCB_SIZE    sizeof( EDFCRCB_t )
+
+/* pdTRUE if the tick xA comes before xB, also when the tick count wraps. */
+        #define corEDF_TICK_BEFORE( xA, xB )    ( ( TickType_t ) ( ( xA ) - ( xB ) ) > ( portMAX_DELAY >> 1 ) )
+
+        #define corEDF_HAS_DEADLINE( pxCRCB )    ( ( ( const EDFCRCB_t * ) ( pxCRCB ) )->xPeriod != ( TickType_t ) 0U )
+
+/* pdTRUE if the co-routine pxA goes ahead of pxB in the EDF band.  Equal
+ * deadlines keep the order in which the co-routines became ready. */
+        #define corEDF_RUNS_BEFORE( pxA, pxB )                                                             \
+    ( ( corEDF_HAS_DEADLINE( pxA ) ) &&                                                                    \
+      ( ( !( corEDF_HAS_DEADLINE( pxB ) ) ) ||                                                             \
+        ( corEDF_TICK_BEFORE( ( ( const EDFCRCB_t * ) ( pxA ) )->xDeadline, ( ( const EDFCRCB_t * ) ( pxB ) )->xDeadline ) ) ) )
+
+/*
+ * Place the co-routine represented by pxCRCB into the appropriate ready queue
+ * for the priority.  It is inserted at the end of the list, or in deadline
+ * order in the EDF band.
+ *
+ * This macro accesses the co-routine ready lists and therefore must not be
+ * used from within an ISR.
+ */
+        #define prvAddCoRoutineToReadyQueue( pxCRCB )                                                                           \
+    {                                                                                                                           \
+        if( ( pxCRCB )->uxPriority > uxTopCoRoutineReadyPriority )                                                              \
+        {                                                                                                                       \
+            uxTopCoRoutineReadyPriority = ( pxCRCB )->uxPriority;                                                               \
+        }                                                                                                                       \
+        if( ( pxCRCB )->uxPriority == ( UBaseType_t ) configEDF_CO_ROUTINE_PRIORITY_BAND )                                      \
+        {                                                                                                                       \
+            prvInsertEDFReady( pxCRCB );                                                                                        \
+        }                                                                                                                       \
+        else                                                                                                                    \
+        {                                                                                                                       \
+            vListInsertEnd( ( List_t * ) &( pxReadyCoRoutineLists[ ( pxCRCB )->uxPriority ] ), &( ( pxCRCB )->xGenericListItem ) ); \
+        }                                                                                                                       \
+    }
+
+    #else /* configUSE_EDF_CO_ROUTINES */
+
+        #define corCRCB_SIZE    sizeof( CRCB_t )
+
+/*
+ * Place the co-routine represented by pxCRCB into the appropriate ready queue
+ * for the priority.  It is inserted at the end of the list.
+ *
+ * This macro accesses the co-routine ready lists and therefore must not be
+ * used from within an ISR.
+ */
+        #define prvAddCoRoutineToReadyQueue( pxCRCB )                                                                       \
+    {                                                                                                                       \
+        if( ( pxCRCB )->uxPriority > uxTopCoRoutineReadyPriority )                                                          \
+        {                                                                                                                   \
+            uxTopCoRoutineReadyPriority = ( pxCRCB )->uxPriority;                                                           \
+        }                                                                                                                   \
+        vListInsertEnd( ( List_t * ) &( pxReadyCoRoutineLists[ ( pxCRCB )->uxPriority ] ), &( ( pxCRCB )->xGenericListItem ) ); \
+    }
+
+    #endif /* configUSE_EDF_CO_ROUTINES */
+
+/*
+ * Utility to ready all the lists used by the scheduler.  This is called
+ * automatically upon the creation of the first co-routine.
+ */
+    static void prvInitialiseCoRoutineLists( void );
+
+/*
+ * Co-routines that are readied by an interrupt cannot be placed directly into
+ * the ready lists (there is no mutual exclusion).  Instead they are placed in
+ * in the pending ready list in order that they can later be moved to the ready
+ * list by the co-routine scheduler.
+ */
+    static void prvCheckPendingReadyList( void );
+
+/*
+ * Macro that looks at the list of co-routines that are currently delayed to
+ * see if any require waking.
+ *
+ * Co-routines are stored in the queue in the order of their wake time -
+ * meaning once one co-routine has been found whose timer has not expired
+ * we need not look any further down the list.
+ */
+    static void prvCheckDelayedList( void );
+
+/*
+ * Allocate and ready a co-routine, with a period and a relative deadline when
+ * xPeriod is not 0.  Both are only kept with configUSE_EDF_CO_ROUTINES.
+ */
+    static BaseType_t prvCreateCoRoutine( crCOROUTINE_CODE pxCoRoutineCode,
+                                          UBaseType_t uxPriority,
+                                          UBaseType_t uxIndex,
+                                          TickType_t xPeriod,
+                                          TickType_t xRelativeDeadline );
+
+    #if ( configUSE_EDF_CO_ROUTINES == 1 )
+
+/*
+ * Insert pxCRCB in the ready list of the EDF band, ahead of the first
+ * co-routine it goes ahead of.
+ */
+        static void prvInsertEDFReady( CRCB_t * pxCRCB );
+
+    #endif
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode,
+                                 UBaseType_t uxPriority,
+                                 UBaseType_t uxIndex )
+    {
+        return prvCreateCoRoutine( pxCoRoutineCode, uxPriority, uxIndex, ( TickType_t ) 0U, ( TickType_t ) 0U );
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_CO_ROUTINES == 1 )
+
+        BaseType_t xCoRoutinePeriodicCreate( crCOROUTINE_CODE pxCoRoutineCode,
+                                             UBaseType_t uxIndex,
+                                             TickType_t xPeriod,
+                                             TickType_t xRelativeDeadline )
+        {
+            configASSERT( xPeriod > ( TickType_t ) 0U );
+            configASSERT( xRelativeDeadline > ( TickType_t ) 0U );
+            configASSERT( xRelativeDeadline <= xPeriod );
+
+            return prvCreateCoRoutine( pxCoRoutineCode, ( UBaseType_t ) configEDF_CO_ROUTINE_PRIORITY_BAND, uxIndex, xPeriod, xRelativeDeadline );
+        }
+
+    #endif /* configUSE_EDF_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCreateCoRoutine( crCOROUTINE_CODE pxCoRoutineCode,
+                                          UBaseType_t uxPriority,
+                                          UBaseType_t uxIndex,
+                                          TickType_t xPeriod,
+                                          TickType_t xRelativeDeadline )
+    {
+        BaseType_t xReturn;
+        CRCB_t * pxCoRoutine;
+
+        /* Allocate the memory that will store the co-routine control block. */
+        pxCoRoutine = ( CRCB_t * ) pvPortMalloc( corCRCB_SIZE );
+
+        if( pxCoRoutine )
+        {
+            /* If pxCurrentCoRoutine is NULL then this is the first co-routine to
+            * be created and the co-routine data structures need initialising. */
+            if( pxCurrentCoRoutine == NULL )
+            {
+                pxCurrentCoRoutine = pxCoRoutine;
+                prvInitialiseCoRoutineLists();
+            }
+
+            /* Check the priority is within limits. */
+            if( uxPriority >= configMAX_CO_ROUTINE_PRIORITIES )
+            {
+                uxPriority = configMAX_CO_ROUTINE_PRIORITIES - 1;
+            }
+
+            /* Fill out the co-routine control block from the function parameters. */
+            pxCoRoutine->uxState = corINITIAL_STATE;
+            pxCoRoutine->uxPriority = uxPriority;
+            pxCoRoutine->uxIndex = uxIndex;
+            pxCoRoutine->pxCoRoutineFunction = pxCoRoutineCode;
+
+            #if ( configUSE_EDF_CO_ROUTINES == 1 )
+                {
+                    EDFCRCB_t * const pxEDFCoRoutine = ( EDFCRCB_t * ) pxCoRoutine;
+
+                    /* The first job is released now. */
+                    pxEDFCoRoutine->xPeriod = xPeriod;
+                    pxEDFCoRoutine->xRelativeDeadline = xRelativeDeadline;
+                    pxEDFCoRoutine->xRelease = xCoRoutineTickCount;
+                    pxEDFCoRoutine->xDeadline = xCoRoutineTickCount + xRelativeDeadline;
+                    pxEDFCoRoutine->uxMisses = ( UBaseType_t ) 0U;
+                }
+            #else
+                ( void ) xPeriod;
+                ( void ) xRelativeDeadline;
+            #endif
+
+            /* Initialise all the other co-routine control block parameters. */
+            vListInitialiseItem( &( pxCoRoutine->xGenericListItem ) );
+            vListInitialiseItem( &( pxCoRoutine->xEventListItem ) );
+
+            /* Set the co-routine control block as a link back from the ListItem_t.
+             * This is so we can get back to the containing CRCB from a generic item
+             * in a list. */
+            listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xGenericListItem ), pxCoRoutine );
+            listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xEventListItem ), pxCoRoutine );
+
+            /* Event lists are always in priority order. */
+            listSET_LIST_ITEM_VALUE( &( pxCoRoutine->xEventListItem ), ( ( TickType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( TickType_t ) uxPriority ) );
+
+            /* Now the co-routine has been initialised it can be added to the ready
+             * list at the correct priority. */
+            prvAddCoRoutineToReadyQueue( pxCoRoutine );
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay,
+                                     List_t * pxEventList )
+    {
+        TickType_t xTimeToWake;
+
+        /* Calculate the time to wake - this may overflow but this is
+         * not a problem. */
+        xTimeToWake = xCoRoutineTickCount + xTicksToDelay;
+
+        /* We must remove ourselves from the ready list before adding
+         * ourselves to the blocked list as the same list item is used for
+         * both lists. */
+        ( void ) uxListRemove( ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+
+        /* The list item will be inserted in wake time order. */
+        listSET_LIST_ITEM_VALUE( &( pxCurrentCoRoutine->xGenericListItem ), xTimeToWake );
+
+        if( xTimeToWake < xCoRoutineTickCount )
+        {
+            /* Wake time has overflowed.  Place this item in the
+             * overflow list. */
+            vListInsert( ( List_t * ) pxOverflowDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+        }
+        else
+        {
+            /* The wake time has not overflowed, so we can use the
+             * current block list. */
+            vListInsert( ( List_t * ) pxDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+        }
+
+        if( pxEventList )
+        {
+            /* Also add the co-routine to an event list.  If this is done then the
+             * function must be called with interrupts disabled. */
+            vListInsert( pxEventList, &( pxCurrentCoRoutine->xEventListItem ) );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_CO_ROUTINES == 1 )
+
+        void vCoRoutineAddToNextRelease( void )
+        {
+            EDFCRCB_t * const pxEDFCoRoutine = ( EDFCRCB_t * ) pxCurrentCoRoutine;
+
+            configASSERT( corEDF_HAS_DEADLINE( pxCurrentCoRoutine ) );
+
+            /* The job ends during the current tick, so it is late if its
+             * deadline is not after that tick. */
+            if( corEDF_TICK_BEFORE( xCoRoutineTickCount, pxEDFCoRoutine->xRelease + pxEDFCoRoutine->xRelativeDeadline ) == pdFALSE )
+            {
+                ( pxEDFCoRoutine->uxMisses )++;
+            }
+
+            pxEDFCoRoutine->xRelease += pxEDFCoRoutine->xPeriod;
+
+            if( corEDF_TICK_BEFORE( xCoRoutineTickCount, pxEDFCoRoutine->xRelease ) )
+            {
+                pxEDFCoRoutine->xDeadline = pxEDFCoRoutine->xRelease + pxEDFCoRoutine->xRelativeDeadline;
+                vCoRoutineAddToDelayedList( pxEDFCoRoutine->xRelease - xCoRoutineTickCount, NULL );
+            }
+            else
+            {
+                /* The next job is already released.  As a task that does not
+                 * block in vTaskDelayUntil(), the co-routine stays ready with
+                 * the deadline it has until it next blocks. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        UBaseType_t uxCoRoutinePeriodicGetMisses( CoRoutineHandle_t xHandle )
+        {
+            return ( ( const EDFCRCB_t * ) xHandle )->uxMisses;
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvInsertEDFReady( CRCB_t * pxCRCB )
+        {
+            List_t * const pxList = &( pxReadyCoRoutineLists[ configEDF_CO_ROUTINE_PRIORITY_BAND ] );
+            ListItem_t * const pxNewListItem = &( pxCRCB->xGenericListItem );
+            ListItem_t * pxIterator;
+
+            /* vListInsert() is not used, as its comparison of the item values
+             * does not survive deadlines that wrap. */
+            for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != listGET_END_MARKER( pxList ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+            {
+                if( corEDF_RUNS_BEFORE( pxCRCB, ( CRCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) ) )
+                {
+                    break;
+                }
+            }
+
+            pxNewListItem->pxNext = pxIterator;
+            pxNewListItem->pxPrevious = pxIterator->pxPrevious;
+            pxIterator->pxPrevious->pxNext = pxNewListItem;
+            pxIterator->pxPrevious = pxNewListItem;
+            pxNewListItem->pxContainer = pxList;
+
+            ( pxList->uxNumberOfItems )++;
+        }
+
+    #endif /* configUSE_EDF_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+    static void prvCheckPendingReadyList( void )
+    {
+        /* Are there any co-routines waiting to get moved to the ready list?  These
+         * are co-routines that have been readied by an ISR.  The ISR cannot access
+         * the ready lists itself. */
+        while( listLIST_IS_EMPTY( &xPendingReadyCoRoutineList ) == pdFALSE )
+        {
+            CRCB_t * pxUnblockedCRCB;
+
+            /* The pending ready list can be accessed by an ISR. */
+            portDISABLE_INTERRUPTS();
+            {
+                pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyCoRoutineList ) );
+                ( void ) uxListRemove( &( pxUnblockedCRCB->xEventListItem ) );
+            }
+            portENABLE_INTERRUPTS();
+
+            ( void ) uxListRemove( &( pxUnblockedCRCB->xGenericListItem ) );
+            prvAddCoRoutineToReadyQueue( pxUnblockedCRCB );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCheckDelayedList( void )
+    {
+        CRCB_t * pxCRCB;
+
+        xPassedTicks = xTaskGetTickCount() - xLastTickCount;
+
+        while( xPassedTicks )
+        {
+            xCoRoutineTickCount++;
+            xPassedTicks--;
+
+            /* If the tick count has overflowed we need to swap the ready lists. */
+            if( xCoRoutineTickCount == 0 )
+            {
+                List_t * pxTemp;
+
+                /* Tick count has overflowed so we need to swap the delay lists.  If there are
+                 * any items in pxDelayedCoRoutineList here then there is an error! */
+                pxTemp = pxDelayedCoRoutineList;
+                pxDelayedCoRoutineList = pxOverflowDelayedCoRoutineList;
+                pxOverflowDelayedCoRoutineList = pxTemp;
+            }
+
+            /* See if this tick has made a timeout expire. */
+            while( listLIST_IS_EMPTY( pxDelayedCoRoutineList ) == pdFALSE )
+            {
+                pxCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedCoRoutineList );
+
+                if( xCoRoutineTickCount < listGET_LIST_ITEM_VALUE( &( pxCRCB->xGenericListItem ) ) )
+                {
+                    /* Timeout not yet expired. */
+                    break;
+                }
+
+                portDISABLE_INTERRUPTS();
+                {
+                    /* The event could have occurred just before this critical
+                     *  section.  If this is the case then the generic list item will
+                     *  have been moved to the pending ready list and the following
+                     *  line is still valid.  Also the pvContainer parameter will have
+                     *  been set to NULL so the following lines are also valid. */
+                    ( void ) uxListRemove( &( pxCRCB->xGenericListItem ) );
+
+                    /* Is the co-routine waiting on an event also? */
+                    if( pxCRCB->xEventListItem.pxContainer )
+                    {
+                        ( void ) uxListRemove( &( pxCRCB->xEventListItem ) );
+                    }
+                }
+                portENABLE_INTERRUPTS();
+
+                prvAddCoRoutineToReadyQueue( pxCRCB );
+            }
+        }
+
+        xLastTickCount = xCoRoutineTickCount;
+    }
+/*-----------------------------------------------------------*/
+
+    void vCoRoutineSchedule( void )
+    {
+        /* Only run a co-routine after prvInitialiseCoRoutineLists() has been
+         * called.  prvInitialiseCoRoutineLists() is called automatically when a
+         * co-routine is created. */
+        if( pxDelayedCoRoutineList != NULL )
+        {
+            /* See if any co-routines readied by events need moving to the ready lists. */
+            prvCheckPendingReadyList();
+
+            /* See if any delayed co-routines have timed out. */
+            prvCheckDelayedList();
+
+            /* Find the highest priority queue that contains ready co-routines. */
+            while( listLIST_IS_EMPTY( &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) ) )
+            {
+                if( uxTopCoRoutineReadyPriority == 0 )
+                {
+                    /* No more co-routines to check. */
+                    return;
+                }
+
+                --uxTopCoRoutineReadyPriority;
+            }
+
+            #if ( configUSE_EDF_CO_ROUTINES == 1 )
+                if( ( uxTopCoRoutineReadyPriority == ( UBaseType_t ) configEDF_CO_ROUTINE_PRIORITY_BAND ) &&
+                    ( corEDF_HAS_DEADLINE( listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) ) ) ) )
+                {
+                    /* The earliest deadline is at the head of the band. */
+                    pxCurrentCoRoutine = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) );
+                }
+                else
+            #endif /* configUSE_EDF_CO_ROUTINES */
+            {
+                /* listGET_OWNER_OF_NEXT_ENTRY walks through the list, so the co-routines
+                 * of the same priority get an equal share of the processor time. */
+                listGET_OWNER_OF_NEXT_ENTRY( pxCurrentCoRoutine, &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) );
+            }
+
+            /* Call the co-routine. */
+            ( pxCurrentCoRoutine->pxCoRoutineFunction )( pxCurrentCoRoutine, pxCurrentCoRoutine->uxIndex );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseCoRoutineLists( void )
+    {
+        UBaseType_t uxPriority;
+
+        for( uxPriority = 0; uxPriority < configMAX_CO_ROUTINE_PRIORITIES; uxPriority++ )
+        {
+            vListInitialise( ( List_t * ) &( pxReadyCoRoutineLists[ uxPriority ] ) );
+        }
+
+        vListInitialise( ( List_t * ) &xDelayedCoRoutineList1 );
+        vListInitialise( ( List_t * ) &xDelayedCoRoutineList2 );
+        vListInitialise( ( List_t * ) &xPendingReadyCoRoutineList );
+
+        /* Start with pxDelayedCoRoutineList using list1 and the
+         * pxOverflowDelayedCoRoutineList using list2. */
+        pxDelayedCoRoutineList = &xDelayedCoRoutineList1;
+        pxOverflowDelayedCoRoutineList = &xDelayedCoRoutineList2;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xCoRoutineRemoveFromEventList( const List_t * pxEventList )
+    {
+        CRCB_t * pxUnblockedCRCB;
+        BaseType_t xReturn;
+
+        /* This function is called from within an interrupt.  It can only access
+         * event lists and the pending ready list.  This function assumes that a
+         * check has already been made to ensure pxEventList is not empty. */
+        pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+        ( void ) uxListRemove( &( pxUnblockedCRCB->xEventListItem ) );
+        vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), &( pxUnblockedCRCB->xEventListItem ) );
+
+        #if ( configUSE_EDF_CO_ROUTINES == 1 )
+            /* Inside the EDF band only an earlier deadline goes first. */
+            if( ( pxUnblockedCRCB->uxPriority > pxCurrentCoRoutine->uxPriority ) ||
+                ( ( pxUnblockedCRCB->uxPriority == pxCurrentCoRoutine->uxPriority ) &&
+                  ( ( pxUnblockedCRCB->uxPriority != ( UBaseType_t ) configEDF_CO_ROUTINE_PRIORITY_BAND ) ||
+                    ( corEDF_RUNS_BEFORE( pxUnblockedCRCB, pxCurrentCoRoutine ) ) ) ) )
+        #else
+            if( pxUnblockedCRCB->uxPriority >= pxCurrentCoRoutine->uxPriority )
+        #endif
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_CO_ROUTINES == 0 */
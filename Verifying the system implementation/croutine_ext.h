@@ -0,0 +1,89 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * The co-routine API that the EDF scheduler of this project adds to the
+ * kernel.  It is only declared when configUSE_EDF_CO_ROUTINES is set, the
+ * option is described where croutine.c gives it its default.
+ */
+
+#ifndef INC_CROUTINE_EXT_H
+#define INC_CROUTINE_EXT_H
+
+#ifndef CO_ROUTINE_H
+    #error "include croutine.h must appear in source files before include croutine_ext.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#if ( ( configUSE_CO_ROUTINES != 0 ) && ( configUSE_EDF_CO_ROUTINES == 1 ) )
+
+/*
+ * Create a co-routine released every xPeriod ticks from now, each job due
+ * xRelativeDeadline ticks after its release.  It gets the priority
+ * configEDF_CO_ROUTINE_PRIORITY_BAND and runs in deadline order with the other
+ * periodic co-routines.  Each job ends with crWAIT_FOR_NEXT_RELEASE().
+ */
+    BaseType_t xCoRoutinePeriodicCreate( crCOROUTINE_CODE pxCoRoutineCode,
+                                         UBaseType_t uxIndex,
+                                         TickType_t xPeriod,
+                                         TickType_t xRelativeDeadline );
+
+/*
+ * End the job of the calling periodic co-routine and block it until its next
+ * release, as crDELAY() blocks for a number of ticks.  If that release has
+ * already passed the co-routine stays ready for its next job.  Only used from
+ * the body of a periodic co-routine, between crSTART() and crEND().
+ */
+    #define crWAIT_FOR_NEXT_RELEASE( xHandle ) \
+    vCoRoutineAddToNextRelease();              \
+    crSET_STATE0( ( xHandle ) );
+
+/*
+ * The number of jobs of the periodic co-routine xHandle that ended after
+ * their deadline.
+ */
+    UBaseType_t uxCoRoutinePeriodicGetMisses( CoRoutineHandle_t xHandle );
+
+/*
+ * Called by crWAIT_FOR_NEXT_RELEASE(), not intended for use in application
+ * code.
+ */
+    void vCoRoutineAddToNextRelease( void );
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+#endif /* INC_CROUTINE_EXT_H */
@@ -0,0 +1,75 @@
+/*
+ * Kernel configuration for the host test programs in this directory.  It
+ * follows FreeRTOS_Config.h without the LPC21xx peripherals.  The options a
+ * test program exercises are left to their defaults in tasks.c, run.sh sets
+ * them on the compiler command line.
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+
+#define configUSE_PREEMPTION                   1
+#define configUSE_IDLE_HOOK                    0
+#define configUSE_TICK_HOOK                    0
+#define configCPU_CLOCK_HZ                     ( ( unsigned long ) 60000000 )
+#define configTICK_RATE_HZ                     ( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES                   ( 5 )
+#define configMINIMAL_STACK_SIZE               ( ( unsigned short ) 90 )
+#define configTOTAL_HEAP_SIZE                  ( ( size_t ) 13 * 1024 )
+#define configMAX_TASK_NAME_LEN                ( 8 )
+#define configUSE_TRACE_FACILITY               0
+#define configUSE_16_BIT_TICKS                 0
+#define configIDLE_SHOULD_YIELD                0
+#define configUSE_TIME_SLICING                 1
+#define configSUPPORT_DYNAMIC_ALLOCATION       1
+#define configUSE_MUTEXES                      1
+#define configUSE_TICKLESS_IDLE                0
+#define configMAX_CO_ROUTINE_PRIORITIES        ( 2 )
+#define configQUEUE_REGISTRY_SIZE              0
+#define configMAX_PERIODIC_TASKS               1024
+
+#define configUSE_EDF_SCHEDULER                1
+#define configEDF_PRIORITY_BAND                1
+
+/* The target's Timer1, advanced by the simulator in sim.c. */
+extern volatile uint32_t ulHostTimer1;
+
+/* Trace records of configUSE_TRACE_RECORDER are stamped with Timer1 too. */
+#define portTRACE_GET_TIME()                   ( ulHostTimer1 )
+
+/* Deadlines of configUSE_EDF_FINE_DEADLINES in Timer1 counts. */
+#define configEDF_DEADLINE_TIMER_HZ            ( configCPU_CLOCK_HZ / 1001UL )
+#define portEDF_GET_DEADLINE_TIME()            ( ulHostTimer1 )
+
+/* The one-shot tick of configUSE_EVENT_DRIVEN_TICK, simulated in sim.c. */
+extern uint32_t ulApplicationGetElapsedTicks( void );
+extern void vApplicationSetNextTickEvent( uint32_t ulTickNow,
+                                          uint32_t ulTicksToEvent );
+#define portGET_ELAPSED_TICKS()                               ulApplicationGetElapsedTicks()
+#define portSET_NEXT_TICK_EVENT( xTickNow, xTicksToEvent )    vApplicationSetNextTickEvent( ( xTickNow ), ( xTicksToEvent ) )
+
+/* Calls of xTaskIncrementTick(), counted by port.c for catch_up.c. */
+extern uint32_t ulHostTickCalls;
+#define traceTASK_INCREMENT_TICK( xTickCount )    ( ulHostTickCalls++ )
+
+/* Report a failed assertion and stop the test program. */
+extern void vHostAssertFailed( const char * pcFile,
+                               int iLine );
+#define configASSERT( x )    if( ( x ) == 0 ) vHostAssertFailed( __FILE__, __LINE__ )
+
+#define INCLUDE_vTaskPrioritySet               1
+#define INCLUDE_uxTaskPriorityGet              1
+#define INCLUDE_vTaskDelete                    1
+#define INCLUDE_vTaskCleanUpResources          0
+#define INCLUDE_vTaskSuspend                   1
+#define INCLUDE_vTaskDelayUntil                1
+#define INCLUDE_vTaskDelay                     1
+#define INCLUDE_xTaskGetIdleTaskHandle         1
+#define INCLUDE_xTaskGetCurrentTaskHandle      1
+#define INCLUDE_xTaskGetHandle                 1
+#define INCLUDE_xTaskGetSchedulerState         1
+#define INCLUDE_uxTaskGetStackHighWaterMark    1
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,102 @@
+/*
+ * Holds 300 ticks pending with the scheduler suspended, starting at a tick at
+ * which every periodic task is blocked in xTaskDelayUntil() and a job has just
+ * been created, then resumes the scheduler.  Prints the calls of
+ * xTaskIncrementTick() the catch-up took, and checks that each task and the
+ * job were released once, at their last release before the end of the
+ * catch-up, with the releases they skipped counted as misses.  run.sh builds
+ * it with configUSE_BULK_TICK_CATCH_UP and configUSE_EDF_JOBS.
+ */
+
+#include <stdio.h>
+
+#include "sim.h"
+#include "task_ext.h"
+
+#define catchTASKS      3
+#define catchTICKS      300U
+#define catchJOB_T      7U
+#define catchJOB_SERVER "JOBS" /* The default configEDF_JOB_SERVER_NAME. */
+
+static const TickType_t xTaskSet[ catchTASKS ][ 3 ] = { { 1, 10, 10 }, { 2, 20, 20 }, { 3, 40, 30 } };
+
+static void prvJob( void * pvParameters )
+{
+    /* Never called, the simulator does not run the job server. */
+    ( void ) pvParameters;
+}
+
+int main( void )
+{
+    TickType_t xWake[ catchTASKS ], xStart, xEnd, xSkipped;
+    UBaseType_t uxMisses[ catchTASKS ], uxMissed, uxTask, uxServerMisses;
+    TickType_t xTick;
+    int iFailed = 0;
+
+    for( uxTask = 0; uxTask < catchTASKS; uxTask++ )
+    {
+        ( void ) uxSimCreatePeriodic( xTaskSet[ uxTask ][ 0 ], xTaskSet[ uxTask ][ 1 ], xTaskSet[ uxTask ][ 2 ] );
+    }
+
+    vSimStart();
+
+    /* Run past the first jobs, up to a tick with every task blocked. */
+    do
+    {
+        vSimRun( 1, NULL );
+    } while( ( xTaskGetTickCount() < 5U ) || ( xTaskGetCurrentTaskHandle() != xTaskGetIdleTaskHandle() ) );
+
+    /* The job is first released on the next tick. */
+    xStart = xTaskGetTickCount();
+
+    if( xTaskPeriodicJobCreate( prvJob, NULL, catchJOB_T, catchJOB_T ) != pdPASS )
+    {
+        return 2;
+    }
+
+    for( uxTask = 0; uxTask < catchTASKS; uxTask++ )
+    {
+        xWake[ uxTask ] = xSimGetLastWake( uxTask );
+        uxMisses[ uxTask ] = uxTaskPeriodicGetMisses( xSimGetHandle( uxTask ) );
+    }
+
+    vTaskSuspendAll();
+
+    for( xTick = 0; xTick < catchTICKS; xTick++ )
+    {
+        ( void ) xTaskIncrementTick();
+    }
+
+    ulHostTickCalls = 0U;
+    ( void ) xTaskResumeAll();
+    xEnd = xTaskGetTickCount();
+    printf( "%u ticks caught up with %u tick calls\n", ( unsigned ) catchTICKS, ( unsigned ) ulHostTickCalls );
+
+    for( uxTask = 0; uxTask < catchTASKS; uxTask++ )
+    {
+        /* The wake time is moved to the release the task was released at. */
+        xSkipped = ( xSimGetLastWake( uxTask ) - xWake[ uxTask ] ) / xTaskSet[ uxTask ][ 1 ];
+        uxMissed = uxTaskPeriodicGetMisses( xSimGetHandle( uxTask ) ) - uxMisses[ uxTask ];
+        printf( "%c skipped %u releases, %u counted as misses\n", ( char ) ( 'A' + uxTask ), ( unsigned ) xSkipped, ( unsigned ) uxMissed );
+
+        if( ( ( ( xSimGetLastWake( uxTask ) - xWake[ uxTask ] ) % xTaskSet[ uxTask ][ 1 ] ) != 0U ) ||
+            ( ( xEnd - xSimGetLastWake( uxTask ) ) >= xTaskSet[ uxTask ][ 1 ] ) ||
+            ( uxMissed != ( UBaseType_t ) xSkipped ) )
+        {
+            iFailed = 1;
+        }
+    }
+
+    /* The job was due first at xStart + 1 and is released once, at its last
+     * release. */
+    xSkipped = ( xEnd - ( xStart + 1U ) ) / catchJOB_T;
+    uxServerMisses = uxTaskPeriodicGetMisses( xTaskGetHandle( catchJOB_SERVER ) );
+    printf( "job fell %u releases behind, %u counted as misses\n", ( unsigned ) xSkipped, ( unsigned ) uxServerMisses );
+
+    if( uxServerMisses != ( UBaseType_t ) xSkipped )
+    {
+        iFailed = 1;
+    }
+
+    return iFailed;
+}
@@ -0,0 +1,110 @@
+/*
+ * Prints the schedule of the task sets of release_queue.c, chosen by
+ * argv[ 1 ], run as periodic co-routines with configUSE_EDF_CO_ROUTINES.  Each
+ * tick vCoRoutineSchedule() is called once and the co-routine it runs takes
+ * that tick.  run.sh checks that the co-routines schedule exactly as the EDF
+ * tasks do, with the same jobs and misses.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim.h"
+#include "croutine.h"
+#include "croutine_ext.h"
+
+typedef struct CoRoutineSet
+{
+    UBaseType_t uxCoRoutines;
+    TickType_t xCoRoutine[ 6 ][ 3 ]; /* C, T, D of each co-routine. */
+} CoRoutineSet_t;
+
+/* The sets of release_queue.c. */
+static const CoRoutineSet_t xSets[] =
+{
+    { 4, { { 1, 5, 5 }, { 2, 10, 10 }, { 3, 20, 20 }, { 2, 20, 20 } } },
+    { 4, { { 1, 8, 8 }, { 2, 8, 8 }, { 1, 8, 8 }, { 2, 8, 8 } } },
+    { 5, { { 1, 6, 3 }, { 2, 6, 6 }, { 1, 4, 4 }, { 2, 12, 5 }, { 1, 12, 12 } } },
+    { 4, { { 3, 7, 7 }, { 3, 7, 5 }, { 2, 14, 14 }, { 4, 14, 9 } } },
+};
+
+static const CoRoutineSet_t * pxSet;
+static CoRoutineHandle_t xHandles[ 6 ];
+static uint32_t ulJobs[ 6 ];
+static char cRan;
+
+static void prvPeriodicCoRoutine( CoRoutineHandle_t xHandle,
+                                  UBaseType_t uxIndex )
+{
+    /* Kept across the blocking calls, as co-routines have no stack of their
+     * own. */
+    static TickType_t xLeft[ 6 ];
+
+    crSTART( xHandle );
+
+    xHandles[ uxIndex ] = xHandle;
+
+    for( ; ; )
+    {
+        for( xLeft[ uxIndex ] = pxSet->xCoRoutine[ uxIndex ][ 0 ]; xLeft[ uxIndex ] > 0; xLeft[ uxIndex ]-- )
+        {
+            /* One tick of the job, then give the scheduler the next tick. */
+            cRan = ( char ) ( 'A' + uxIndex );
+
+            if( xLeft[ uxIndex ] > 1 )
+            {
+                crDELAY( xHandle, 0 );
+            }
+        }
+
+        ulJobs[ uxIndex ]++;
+        crWAIT_FOR_NEXT_RELEASE( xHandle );
+    }
+
+    crEND();
+}
+
+int main( int argc,
+          char ** argv )
+{
+    static char cSchedule[ 1001 ];
+    UBaseType_t uxCoRoutine;
+    TickType_t xTick;
+
+    if( ( argc != 2 ) || ( atoi( argv[ 1 ] ) < 0 ) || ( ( size_t ) atoi( argv[ 1 ] ) >= ( sizeof( xSets ) / sizeof( xSets[ 0 ] ) ) ) )
+    {
+        printf( "usage: %s <set 0 to %u>\n", argv[ 0 ], ( unsigned ) ( sizeof( xSets ) / sizeof( xSets[ 0 ] ) - 1U ) );
+        return 1;
+    }
+
+    pxSet = &( xSets[ atoi( argv[ 1 ] ) ] );
+
+    for( uxCoRoutine = 0; uxCoRoutine < pxSet->uxCoRoutines; uxCoRoutine++ )
+    {
+        if( xCoRoutinePeriodicCreate( prvPeriodicCoRoutine, uxCoRoutine, pxSet->xCoRoutine[ uxCoRoutine ][ 1 ], pxSet->xCoRoutine[ uxCoRoutine ][ 2 ] ) != pdPASS )
+        {
+            return 2;
+        }
+    }
+
+    vSimStart();
+
+    for( xTick = 0; xTick < 1000; xTick++ )
+    {
+        cRan = '.';
+        vCoRoutineSchedule();
+        cSchedule[ xTick ] = cRan;
+
+        /* Only the idle task runs, so this only advances the tick. */
+        vSimRun( 1, NULL );
+    }
+
+    printf( "%s\n", cSchedule );
+
+    for( uxCoRoutine = 0; uxCoRoutine < pxSet->uxCoRoutines; uxCoRoutine++ )
+    {
+        printf( "%c jobs %u misses %u\n", ( char ) ( 'A' + uxCoRoutine ), ( unsigned ) ulJobs[ uxCoRoutine ], ( unsigned ) uxCoRoutinePeriodicGetMisses( xHandles[ uxCoRoutine ] ) );
+    }
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Times the delayed tasks with and without configUSE_DELAYED_TASK_WHEEL, at 10,
+ * 100 and 1000 blocked tasks.  Each task blocks with vTaskDelay() for a
+ * pseudo-random 1 to 2000 ticks as soon as it runs, so the delayed tasks stay
+ * at the given count.  Prints the average time of a block and of a tick, and a
+ * checksum of the order the tasks woke in, which run.sh compares between the
+ * two builds.
+ */
+
+#define _POSIX_C_SOURCE    199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define benchTICKS    20000U
+
+static TaskHandle_t xTasks[ 1000 ];
+static uint32_t ulSeed = 1U;
+
+static void prvBenchTask( void * pvParameters )
+{
+    /* Never called, main() plays the task. */
+    ( void ) pvParameters;
+}
+
+static TickType_t prvNextDelay( void )
+{
+    ulSeed = ( ulSeed * 1103515245UL ) + 12345UL;
+
+    return ( TickType_t ) ( 1U + ( ( ulSeed >> 8 ) % 2000U ) );
+}
+
+static uint64_t prvNow( void )
+{
+    struct timespec xNow;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+
+int main( int argc,
+          char ** argv )
+{
+    UBaseType_t uxTasks, uxTask;
+    uint64_t ullStart, ullBlockTime = 0U, ullTickTime = 0U;
+    uint32_t ulBlocks = 0U, ulTick, ulChecksum = 0U;
+    TaskHandle_t xRunning;
+
+    if( ( argc != 2 ) || ( atoi( argv[ 1 ] ) < 1 ) || ( atoi( argv[ 1 ] ) > 1000 ) )
+    {
+        printf( "usage: %s <tasks 1 to 1000>\n", argv[ 0 ] );
+        return 1;
+    }
+
+    uxTasks = ( UBaseType_t ) atoi( argv[ 1 ] );
+
+    /* Above the EDF band, so they are scheduled by fixed priority. */
+    for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+    {
+        if( xTaskCreate( prvBenchTask, "B", configMINIMAL_STACK_SIZE, NULL, configEDF_PRIORITY_BAND + 1, &( xTasks[ uxTask ] ) ) != pdPASS )
+        {
+            return 2;
+        }
+    }
+
+    vTaskStartScheduler();
+
+    for( ulTick = 0U; ulTick < benchTICKS; ulTick++ )
+    {
+        /* Every task that has woken blocks again straight away. */
+        for( xRunning = xTaskGetCurrentTaskHandle(); xRunning != xTaskGetIdleTaskHandle(); xRunning = xTaskGetCurrentTaskHandle() )
+        {
+            for( uxTask = 0; xTasks[ uxTask ] != xRunning; uxTask++ )
+            {
+            }
+
+            ulChecksum = ( ulChecksum * 31U ) + ( ulTick * 1009U ) + ( uint32_t ) uxTask;
+
+            ullStart = prvNow();
+            vTaskDelay( prvNextDelay() );
+            ullBlockTime += prvNow() - ullStart;
+            ulBlocks++;
+        }
+
+        ullStart = prvNow();
+
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            vTaskSwitchContext();
+        }
+
+        ullTickTime += prvNow() - ullStart;
+    }
+
+    printf( "tasks %4u  block %6.1f ns  tick %6.1f ns  checksum %08x\n",
+            ( unsigned ) uxTasks,
+            ( double ) ullBlockTime / ( double ) ulBlocks,
+            ( double ) ullTickTime / ( double ) benchTICKS,
+            ( unsigned ) ulChecksum );
+
+    return 0;
+}
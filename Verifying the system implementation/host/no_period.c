@@ -0,0 +1,73 @@
+/*
+ * Prints the schedule of a task set chosen by argv[ 1 ], with a task in the EDF
+ * band that has no period when argv[ 2 ] is 1.  That task never blocks, so it
+ * must take exactly the ticks the idle task takes without it.  run.sh compares
+ * the two schedules with the idle ticks of the first marked as the other
+ * task's.  run.sh also builds it with a configINITIAL_TICK_COUNT just before
+ * the tick count wraps.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim.h"
+
+typedef struct SimSet
+{
+    UBaseType_t uxTasks;
+    TickType_t xTask[ 4 ][ 3 ]; /* C, T, D of each task. */
+} SimSet_t;
+
+static const SimSet_t xSets[] =
+{
+    /* Harmonic periods with idle time in every hyperperiod. */
+    { 3, { { 1, 5, 5 }, { 2, 10, 10 }, { 3, 20, 20 } } },
+    /* Constrained deadlines. */
+    { 4, { { 1, 6, 3 }, { 1, 4, 4 }, { 2, 12, 5 }, { 1, 12, 12 } } },
+};
+
+static void prvNoPeriodTask( void * pvParameters )
+{
+    /* Never called, the simulator runs it as the '?' task. */
+    ( void ) pvParameters;
+}
+
+int main( int argc,
+          char ** argv )
+{
+    static char cSchedule[ 1001 ];
+    const SimSet_t * pxSet;
+    UBaseType_t uxTask;
+
+    if( ( argc != 3 ) || ( atoi( argv[ 1 ] ) < 0 ) || ( ( size_t ) atoi( argv[ 1 ] ) >= ( sizeof( xSets ) / sizeof( xSets[ 0 ] ) ) ) )
+    {
+        printf( "usage: %s <set 0 to %u> <no period task 0 or 1>\n", argv[ 0 ], ( unsigned ) ( sizeof( xSets ) / sizeof( xSets[ 0 ] ) - 1U ) );
+        return 1;
+    }
+
+    pxSet = &( xSets[ atoi( argv[ 1 ] ) ] );
+
+    for( uxTask = 0; uxTask < pxSet->uxTasks; uxTask++ )
+    {
+        ( void ) uxSimCreatePeriodic( pxSet->xTask[ uxTask ][ 0 ], pxSet->xTask[ uxTask ][ 1 ], pxSet->xTask[ uxTask ][ 2 ] );
+    }
+
+    if( atoi( argv[ 2 ] ) != 0 )
+    {
+        if( xTaskCreate( prvNoPeriodTask, "N", configMINIMAL_STACK_SIZE, NULL, configEDF_PRIORITY_BAND, NULL ) != pdPASS )
+        {
+            return 2;
+        }
+    }
+
+    vSimStart();
+    vSimRun( 1000, cSchedule );
+    printf( "%s\n", cSchedule );
+
+    for( uxTask = 0; uxTask < pxSet->uxTasks; uxTask++ )
+    {
+        printf( "%c jobs %u misses %u\n", ( char ) ( 'A' + uxTask ), ( unsigned ) ulSimGetJobs( uxTask ), ( unsigned ) ulSimGetMisses( uxTask ) );
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+ * Partitions a task set over two cores with configUSE_EDF_PARTITION_ANALYSIS,
+ * with a periodic task created without an execution time before and after the
+ * scheduler starts, and checks the core of each task and the density of each
+ * core.  The tasks without an execution time are placed on no core and add
+ * nothing to the densities.  run.sh builds it for first fit and worst fit.
+ */
+
+#include <stdio.h>
+
+#include "sim.h"
+#include "task_ext.h"
+
+#define partTASKS    4
+
+static const TickType_t xTaskSet[ partTASKS ][ 3 ] = { { 1, 10, 10 }, { 2, 5, 5 }, { 3, 5, 5 }, { 1, 4, 4 } };
+
+/* Cores of the tasks above, placed in decreasing utilisation order 0.6, 0.4,
+ * 0.25 then 0.1, and the density of each core in 1/10000. */
+#if ( configEDF_PARTITIONING == 2 )
+    static const UBaseType_t uxCores[ partTASKS ] = { 0, 1, 0, 1 };
+    static const uint32_t ulDensities[ 2 ] = { 7000, 6500 };
+#else
+    static const UBaseType_t uxCores[ partTASKS ] = { 1, 0, 0, 1 };
+    static const uint32_t ulDensities[ 2 ] = { 10000, 3500 };
+#endif
+
+static void prvUnknownTask( void * pvParameters )
+{
+    /* Never called, the simulator does not run it. */
+    ( void ) pvParameters;
+}
+
+static int prvCheck( const char * pcWhat,
+                     uint32_t ulGot,
+                     uint32_t ulExpected )
+{
+    printf( "%s %u (expected %u)\n", pcWhat, ( unsigned ) ulGot, ( unsigned ) ulExpected );
+
+    return ( ulGot != ulExpected ) ? 1 : 0;
+}
+
+int main( void )
+{
+    TaskHandle_t xBefore, xAfter;
+    UBaseType_t uxTask;
+    int iFailed = 0;
+
+    for( uxTask = 0; uxTask < partTASKS; uxTask++ )
+    {
+        ( void ) uxSimCreatePeriodic( xTaskSet[ uxTask ][ 0 ], xTaskSet[ uxTask ][ 1 ], xTaskSet[ uxTask ][ 2 ] );
+    }
+
+    if( xTaskPeriodicCreate( prvUnknownTask, "U0", configMINIMAL_STACK_SIZE, NULL, configEDF_PRIORITY_BAND, &xBefore, 20 ) != pdPASS )
+    {
+        return 2;
+    }
+
+    vSimStart();
+
+    for( uxTask = 0; uxTask < partTASKS; uxTask++ )
+    {
+        iFailed |= prvCheck( "core of task", ( uint32_t ) uxTaskPeriodicGetCore( xSimGetHandle( uxTask ) ), ( uint32_t ) uxCores[ uxTask ] );
+    }
+
+    iFailed |= prvCheck( "core of U0", ( uint32_t ) uxTaskPeriodicGetCore( xBefore ), ( uint32_t ) configEDF_NUMBER_OF_CORES );
+
+    /* Created while the scheduler runs, again on no core. */
+    if( xTaskPeriodicCreate( prvUnknownTask, "U1", configMINIMAL_STACK_SIZE, NULL, configEDF_PRIORITY_BAND, &xAfter, 20 ) != pdPASS )
+    {
+        return 2;
+    }
+
+    iFailed |= prvCheck( "core of U1", ( uint32_t ) uxTaskPeriodicGetCore( xAfter ), ( uint32_t ) configEDF_NUMBER_OF_CORES );
+    iFailed |= prvCheck( "density of core 0", ulTaskPeriodicGetCoreUtilisation( 0 ), ulDensities[ 0 ] );
+    iFailed |= prvCheck( "density of core 1", ulTaskPeriodicGetCoreUtilisation( 1 ), ulDensities[ 1 ] );
+
+    /* A task that fits on neither core is not created. */
+    iFailed |= prvCheck( "task of density 0.8 created", ( uint32_t ) xTaskPeriodicCreateConstrained( prvUnknownTask, "F", configMINIMAL_STACK_SIZE, NULL, configEDF_PRIORITY_BAND, NULL, 5, 5, 4 ), ( uint32_t ) pdFAIL );
+
+    return iFailed;
+}
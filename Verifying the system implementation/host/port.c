@@ -0,0 +1,89 @@
+/*
+ * Port layer of the host test programs, see portmacro.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+uint32_t ulHostTickCalls = 0;
+
+static UBaseType_t uxCriticalNesting = 0;
+static BaseType_t xYieldPending = pdFALSE;
+
+void vPortEnterCritical( void )
+{
+    uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    configASSERT( uxCriticalNesting > 0 );
+    uxCriticalNesting--;
+
+    if( ( uxCriticalNesting == 0 ) && ( xYieldPending != pdFALSE ) )
+    {
+        xYieldPending = pdFALSE;
+        vTaskSwitchContext();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    if( uxCriticalNesting > 0 )
+    {
+        xYieldPending = pdTRUE;
+    }
+    else
+    {
+        vTaskSwitchContext();
+    }
+}
+/*-----------------------------------------------------------*/
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    ( void ) pxCode;
+    ( void ) pvParameters;
+
+    return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+    /* Return to vTaskStartScheduler(), and from there to the simulator,
+     * which runs the tasks from then on. */
+    return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    return calloc( 1, xWantedSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    free( pv );
+}
+/*-----------------------------------------------------------*/
+
+void vHostAssertFailed( const char * pcFile,
+                        int iLine )
+{
+    printf( "configASSERT() failed at %s:%d\n", pcFile, iLine );
+    exit( 2 );
+}
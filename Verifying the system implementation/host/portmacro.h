@@ -0,0 +1,68 @@
+/*
+ * Port layer of the host test programs.  There is no context switch: the
+ * simulator in sim.c plays the running task itself, so a yield only asks the
+ * kernel which task that is now.  Interrupts are not simulated, a critical
+ * section only delays a yield asked for inside it to its end.
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include <stdint.h>
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#define portCHAR          char
+#define portFLOAT         float
+#define portDOUBLE        double
+#define portLONG          long
+#define portSHORT         short
+#define portSTACK_TYPE    uint32_t
+#define portBASE_TYPE     long
+
+typedef portSTACK_TYPE   StackType_t;
+typedef long             BaseType_t;
+typedef unsigned long    UBaseType_t;
+
+#if ( configUSE_16_BIT_TICKS == 1 )
+    typedef uint16_t     TickType_t;
+    #define portMAX_DELAY              ( TickType_t ) 0xffff
+#else
+    typedef uint32_t     TickType_t;
+    #define portMAX_DELAY              ( TickType_t ) 0xffffffffUL
+    #define portTICK_TYPE_IS_ATOMIC    1
+#endif
+
+#define portSTACK_GROWTH      ( -1 )
+#define portTICK_PERIOD_MS    ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT    8
+#define portNOP()
+
+extern void vPortYield( void );
+extern void vPortEnterCritical( void );
+extern void vPortExitCritical( void );
+
+#define portYIELD()                                 vPortYield()
+#define portYIELD_FROM_ISR()                        vPortYield()
+#define portEND_SWITCHING_ISR( xSwitchRequired )    if( ( xSwitchRequired ) != pdFALSE ) vPortYield()
+#define portENTER_CRITICAL()                        vPortEnterCritical()
+#define portEXIT_CRITICAL()                         vPortExitCritical()
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+#define portSET_INTERRUPT_MASK_FROM_ISR()           ( vPortEnterCritical(), ( UBaseType_t ) 0 )
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )      do { ( void ) ( x ); vPortExitCritical(); } while( 0 )
+
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* PORTMACRO_H */
@@ -0,0 +1,64 @@
+/*
+ * Prints the schedule of a task set chosen by argv[ 1 ].  run.sh builds it with
+ * and without configUSE_EDF_RELEASE_QUEUE, for each configEDF_TIE_BREAK, and
+ * with configUSE_EVENT_DRIVEN_TICK, and checks that the builds print the same
+ * schedules.  The sets release several tasks at the same tick, with equal and
+ * different relative deadlines.  The number of tick interrupts goes to stderr.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim.h"
+
+typedef struct SimSet
+{
+    UBaseType_t uxTasks;
+    TickType_t xTask[ 6 ][ 3 ]; /* C, T, D of each task. */
+} SimSet_t;
+
+static const SimSet_t xSets[] =
+{
+    /* Harmonic periods, all released together every 20 ticks. */
+    { 4, { { 1, 5, 5 }, { 2, 10, 10 }, { 3, 20, 20 }, { 2, 20, 20 } } },
+    /* Equal periods and deadlines, broken only by the tie-break. */
+    { 4, { { 1, 8, 8 }, { 2, 8, 8 }, { 1, 8, 8 }, { 2, 8, 8 } } },
+    /* Constrained deadlines that put a later release ahead of an earlier one. */
+    { 5, { { 1, 6, 3 }, { 2, 6, 6 }, { 1, 4, 4 }, { 2, 12, 5 }, { 1, 12, 12 } } },
+    /* Overloaded, so that deadlines are missed and jobs released late. */
+    { 4, { { 3, 7, 7 }, { 3, 7, 5 }, { 2, 14, 14 }, { 4, 14, 9 } } },
+};
+
+int main( int argc,
+          char ** argv )
+{
+    static char cSchedule[ 1001 ];
+    const SimSet_t * pxSet;
+    UBaseType_t uxTask;
+
+    if( ( argc != 2 ) || ( atoi( argv[ 1 ] ) < 0 ) || ( ( size_t ) atoi( argv[ 1 ] ) >= ( sizeof( xSets ) / sizeof( xSets[ 0 ] ) ) ) )
+    {
+        printf( "usage: %s <set 0 to %u>\n", argv[ 0 ], ( unsigned ) ( sizeof( xSets ) / sizeof( xSets[ 0 ] ) - 1U ) );
+        return 1;
+    }
+
+    pxSet = &( xSets[ atoi( argv[ 1 ] ) ] );
+
+    for( uxTask = 0; uxTask < pxSet->uxTasks; uxTask++ )
+    {
+        ( void ) uxSimCreatePeriodic( pxSet->xTask[ uxTask ][ 0 ], pxSet->xTask[ uxTask ][ 1 ], pxSet->xTask[ uxTask ][ 2 ] );
+    }
+
+    vSimStart();
+    vSimRun( 1000, cSchedule );
+    printf( "%s\n", cSchedule );
+
+    for( uxTask = 0; uxTask < pxSet->uxTasks; uxTask++ )
+    {
+        printf( "%c jobs %u misses %u\n", ( char ) ( 'A' + uxTask ), ( unsigned ) ulSimGetJobs( uxTask ), ( unsigned ) ulSimGetMisses( uxTask ) );
+    }
+
+    fprintf( stderr, "tick interrupts %u\n", ( unsigned ) ulSimGetTickInterrupts() );
+
+    return 0;
+}
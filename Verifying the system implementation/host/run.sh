@@ -0,0 +1,138 @@
+#!/bin/sh
+# Build and run the host test programs against a FreeRTOS V10.4.6 kernel tree:
+#
+#     FREERTOS_KERNEL=/path/to/FreeRTOS-Kernel sh run.sh
+#
+# The kernel tree gives include/ and list.c, this directory gives the port and
+# the configuration, and tasks.c, croutine.c and their headers come from the
+# directory above.
+# Prints one line per check and exits non-zero if any check failed.
+
+set -u
+
+HOST=$(cd "$(dirname "$0")" && pwd)
+SRC=$(dirname "$HOST")
+OUT=${OUT:-"${TMPDIR:-/tmp}/edf-host"}
+CC=${CC:-cc}
+FAILED=0
+
+if [ -z "${FREERTOS_KERNEL:-}" ] || [ ! -f "$FREERTOS_KERNEL/list.c" ]; then
+    echo "set FREERTOS_KERNEL to a FreeRTOS V10.4.6 kernel tree" >&2
+    exit 2
+fi
+
+mkdir -p "$OUT"
+
+# build <name> <test source> [compiler options...]
+#
+# The end marker of a kernel list is a MiniListItem_t that the list code walks
+# as a ListItem_t, which optimising compilers may reorder around unless strict
+# aliasing is off.
+build() {
+    name=$1
+    test=$2
+    shift 2
+    $CC -std=c99 -O2 -fno-strict-aliasing -Wall -I"$HOST" -I"$SRC" -I"$FREERTOS_KERNEL/include" "$@" \
+        "$SRC/tasks.c" "$FREERTOS_KERNEL/list.c" "$HOST/port.c" "$HOST/sim.c" "$HOST/$test" \
+        -o "$OUT/$name" || { echo "FAIL build $name"; FAILED=1; return 1; }
+}
+
+# check <name> <command...>: pass if the command exits with 0.
+check() {
+    name=$1
+    shift
+    if "$@" > "$OUT/$name.log" 2>&1; then
+        echo "pass $name"
+    else
+        echo "FAIL $name (see $OUT/$name.log)"
+        FAILED=1
+    fi
+}
+
+# The release queue (configUSE_EDF_RELEASE_QUEUE) schedules exactly as the
+# delayed lists do, for every tie-break.
+for tie in 0 1 2; do
+    build rq0_$tie release_queue.c -DconfigEDF_TIE_BREAK=$tie -DconfigUSE_EDF_RELEASE_QUEUE=0 &&
+    build rq1_$tie release_queue.c -DconfigEDF_TIE_BREAK=$tie -DconfigUSE_EDF_RELEASE_QUEUE=1 || continue
+    for set in 0 1 2 3; do
+        "$OUT/rq0_$tie" $set > "$OUT/rq0_${tie}_$set.txt" 2> /dev/null
+        "$OUT/rq1_$tie" $set > "$OUT/rq1_${tie}_$set.txt" 2> /dev/null
+        check release_queue_tie${tie}_set$set cmp "$OUT/rq0_${tie}_$set.txt" "$OUT/rq1_${tie}_$set.txt"
+    done
+done
+
+# The one-shot tick (configUSE_EVENT_DRIVEN_TICK) schedules exactly as the
+# periodic tick, with and without the release queue.  The tick interrupts each
+# build took over the 1000 ticks are printed for reference.
+for rq in 0 1; do
+    build event$rq release_queue.c -DconfigUSE_EDF_RELEASE_QUEUE=$rq -DconfigUSE_EVENT_DRIVEN_TICK=1 || continue
+    for set in 0 1 2 3; do
+        "$OUT/event$rq" $set > "$OUT/event${rq}_$set.txt" 2> "$OUT/event${rq}_$set.irq"
+        echo "  set $set release queue $rq: $(cat "$OUT/event${rq}_$set.irq")"
+        check event_tick_rq${rq}_set$set cmp "$OUT/rq${rq}_0_$set.txt" "$OUT/event${rq}_$set.txt"
+    done
+done
+
+# Periodic co-routines (configUSE_EDF_CO_ROUTINES) schedule exactly as the EDF
+# tasks of the same sets, with the same jobs and misses.
+build co_routines co_routines.c -DconfigUSE_CO_ROUTINES=1 -DconfigUSE_EDF_CO_ROUTINES=1 "$SRC/croutine.c" &&
+for set in 0 1 2 3; do
+    "$OUT/co_routines" $set > "$OUT/co_routines_$set.txt" 2>&1
+    check co_routines_set$set cmp "$OUT/rq0_0_$set.txt" "$OUT/co_routines_$set.txt"
+done
+
+# A task of the EDF band without a period runs after every task with a deadline,
+# in both deadline modes, also when the tick count wraps.
+for fine in 0 1; do
+    for start in 0 0xFFFFFF00; do
+        build np_${fine}_$start no_period.c -DconfigUSE_EDF_FINE_DEADLINES=$fine -DconfigINITIAL_TICK_COUNT=$start || continue
+        for set in 0 1; do
+            "$OUT/np_${fine}_$start" $set 0 | sed '1s/\./?/g' > "$OUT/np_${fine}_${start}_${set}_0.txt" 2>&1
+            "$OUT/np_${fine}_$start" $set 1 > "$OUT/np_${fine}_${start}_${set}_1.txt" 2>&1
+            check no_period_fine${fine}_start${start}_set$set cmp "$OUT/np_${fine}_${start}_${set}_0.txt" "$OUT/np_${fine}_${start}_${set}_1.txt"
+        done
+    done
+done
+
+# The bulk catch-up (configUSE_BULK_TICK_CATCH_UP) releases tasks and jobs that
+# fell behind once, at their last release, and counts the skipped releases as
+# misses.  The tick calls it took are printed for reference.
+build catch_up catch_up.c -DconfigUSE_BULK_TICK_CATCH_UP=1 -DconfigUSE_EDF_JOBS=1 &&
+check catch_up "$OUT/catch_up" &&
+sed 's/^/  /' "$OUT/catch_up.log"
+
+# The trace recorder (configUSE_TRACE_RECORDER) gives each job the deadline the
+# kernel ordered it by, and trace_decode.py plots it there.
+for fine in 0 1; do
+    build trace$fine trace.c -DconfigUSE_TRACE_RECORDER=1 -DconfigTRACE_RECORDER_RECORDS=4096 -DconfigUSE_EDF_FINE_DEADLINES=$fine &&
+    "$OUT/trace$fine" "$OUT/trace$fine.raw" > /dev/null &&
+    python3 "$SRC/trace_decode.py" --raw --hz 59940 --tick-hz 1000 --chrome "$OUT/trace$fine.json" "$OUT/trace$fine.raw" &&
+    check trace_deadlines_fine$fine python3 "$HOST/trace_check.py" "$OUT/trace$fine.json" 59940 1000 3 7 20 ||
+    { echo "FAIL trace_fine$fine"; FAILED=1; }
+done
+
+# The partition analysis (configUSE_EDF_PARTITION_ANALYSIS) places each task
+# with an execution time on a core by first fit or worst fit, and leaves the
+# tasks without one out.
+for fit in 1 2; do
+    build partition$fit partition.c -DconfigUSE_EDF_PARTITION_ANALYSIS=1 -DconfigEDF_NUMBER_OF_CORES=2 -DconfigEDF_PARTITIONING=$fit &&
+    check partition_fit$fit "$OUT/partition$fit"
+done
+
+# The timing wheel (configUSE_DELAYED_TASK_WHEEL) wakes the same tasks at the
+# same ticks as the delayed lists.  The timings are printed for reference.
+build wheel0 delayed_tasks.c -DconfigUSE_DELAYED_TASK_WHEEL=0 &&
+build wheel1 delayed_tasks.c -DconfigUSE_DELAYED_TASK_WHEEL=1 &&
+build wheel16 delayed_tasks.c -DconfigUSE_DELAYED_TASK_WHEEL=1 -DconfigDELAYED_TASK_WHEEL_SIZE=16 &&
+for tasks in 10 100 1000; do
+    for wheel in wheel0 wheel1 wheel16; do
+        "$OUT/$wheel" $tasks > "$OUT/${wheel}_$tasks.txt" 2>&1
+        echo "  $wheel: $(cat "$OUT/${wheel}_$tasks.txt")"
+    done
+
+    for wheel in wheel1 wheel16; do
+        check ${wheel}_tasks$tasks test "$(sed 's/.*checksum //' "$OUT/wheel0_$tasks.txt")" = "$(sed 's/.*checksum //' "$OUT/${wheel}_$tasks.txt")"
+    done
+done
+
+exit $FAILED
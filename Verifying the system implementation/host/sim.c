@@ -0,0 +1,252 @@
+/*
+ * A discrete tick simulator for the host test programs, see sim.h.  It also
+ * plays the one-shot timer of configUSE_EVENT_DRIVEN_TICK.
+ */
+
+#include <stdio.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+#include "sim.h"
+
+/* Timer1 counts per tick at the target's 60 MHz PCLK with T1PR = 1000. */
+#define simTIMER1_COUNTS_PER_TICK    ( ( uint32_t ) ( configCPU_CLOCK_HZ / 1001UL / configTICK_RATE_HZ ) )
+
+typedef struct SimTask
+{
+    TaskHandle_t xHandle;
+    TickType_t xWCET;
+    TickType_t xPeriod;
+    TickType_t xDeadline;
+    TickType_t xLeft;       /* Ticks left of the current job. */
+    TickType_t xLastWake;   /* Release of the current job, as xTaskDelayUntil() keeps it. */
+    uint32_t ulJobs;
+    uint32_t ulMisses;
+} SimTask_t;
+
+volatile uint32_t ulHostTimer1 = 0;
+
+static SimTask_t xSimTasks[ simMAX_TASKS ];
+static UBaseType_t uxSimTaskCount = 0;
+static uint32_t ulSimTickInterrupts = 0;
+
+/* The tick in progress, the tick the kernel has accounted up to, and the tick
+ * the next tick interrupt counts.  Until the kernel programs an event the tick
+ * interrupts every tick. */
+static uint32_t ulSimTick = ( uint32_t ) configINITIAL_TICK_COUNT;
+static uint32_t ulSimPortTick = ( uint32_t ) configINITIAL_TICK_COUNT;
+static uint32_t ulSimEventTick = ( uint32_t ) configINITIAL_TICK_COUNT + 1U;
+
+static void prvSimTask( void * pvParameters )
+{
+    /* Never called, the simulator plays the task. */
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+static SimTask_t * prvGetRunningSimTask( void )
+{
+    TaskHandle_t xRunning = xTaskGetCurrentTaskHandle();
+    UBaseType_t uxTask;
+
+    for( uxTask = 0; uxTask < uxSimTaskCount; uxTask++ )
+    {
+        if( xSimTasks[ uxTask ].xHandle == xRunning )
+        {
+            return &( xSimTasks[ uxTask ] );
+        }
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxSimCreatePeriodic( TickType_t xWCET,
+                                 TickType_t xPeriod,
+                                 TickType_t xDeadline )
+{
+    SimTask_t * pxTask = &( xSimTasks[ uxSimTaskCount ] );
+    char cName[ configMAX_TASK_NAME_LEN ];
+
+    configASSERT( uxSimTaskCount < simMAX_TASKS );
+
+    ( void ) snprintf( cName, sizeof( cName ), "S%u", ( unsigned ) uxSimTaskCount );
+    pxTask->xWCET = xWCET;
+    pxTask->xPeriod = xPeriod;
+    pxTask->xDeadline = xDeadline;
+    pxTask->xLeft = xWCET;
+
+    if( xTaskPeriodicCreateConstrained( prvSimTask, cName, configMINIMAL_STACK_SIZE, NULL, configEDF_PRIORITY_BAND, &( pxTask->xHandle ), xPeriod, xDeadline, xWCET ) != pdPASS )
+    {
+        vHostAssertFailed( __FILE__, __LINE__ );
+    }
+
+    return uxSimTaskCount++;
+}
+/*-----------------------------------------------------------*/
+
+void vSimStart( void )
+{
+    UBaseType_t uxTask;
+
+    vTaskStartScheduler();
+    configASSERT( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED );
+
+    for( uxTask = 0; uxTask < uxSimTaskCount; uxTask++ )
+    {
+        xSimTasks[ uxTask ].xLastWake = xTaskGetTickCount();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vSimRun( TickType_t xTicks,
+              char * pcSchedule )
+{
+    SimTask_t * pxTask;
+    TickType_t xTick;
+
+    for( xTick = 0; xTick < xTicks; xTick++ )
+    {
+        pxTask = prvGetRunningSimTask();
+
+        if( pcSchedule != NULL )
+        {
+            if( pxTask != NULL )
+            {
+                *pcSchedule = ( char ) ( 'A' + ( pxTask - xSimTasks ) );
+            }
+            else if( xTaskGetCurrentTaskHandle() == xTaskGetIdleTaskHandle() )
+            {
+                *pcSchedule = '.';
+            }
+            else
+            {
+                *pcSchedule = '?';
+            }
+
+            pcSchedule++;
+        }
+
+        ulHostTimer1 += simTIMER1_COUNTS_PER_TICK;
+
+        if( pxTask != NULL )
+        {
+            pxTask->xLeft--;
+
+            if( pxTask->xLeft == 0 )
+            {
+                /* The job ends with this tick. */
+                pxTask->ulJobs++;
+
+                if( ( TickType_t ) ( xTaskGetTickCount() + 1U - pxTask->xLastWake ) > pxTask->xDeadline )
+                {
+                    pxTask->ulMisses++;
+                }
+
+                pxTask->xLeft = pxTask->xWCET;
+                ( void ) xTaskDelayUntil( &( pxTask->xLastWake ), pxTask->xPeriod );
+            }
+        }
+
+        ulSimTick++;
+
+        #if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+            if( ulSimTick != ulSimEventTick )
+            {
+                /* No interrupt at the end of this tick. */
+                continue;
+            }
+        #endif
+
+        ulSimTickInterrupts++;
+
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            vTaskSwitchContext();
+        }
+    }
+
+    if( pcSchedule != NULL )
+    {
+        *pcSchedule = '\0';
+    }
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulApplicationGetElapsedTicks( void )
+{
+    uint32_t ulElapsedTicks = ulSimTick - ulSimPortTick;
+
+    /* The tick of the event is counted by the tick interrupt. */
+    if( ulElapsedTicks > ( ulSimEventTick - ulSimPortTick - 1U ) )
+    {
+        ulElapsedTicks = ulSimEventTick - ulSimPortTick - 1U;
+    }
+
+    ulSimPortTick += ulElapsedTicks;
+
+    return ulElapsedTicks;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationSetNextTickEvent( uint32_t ulTickNow,
+                                   uint32_t ulTicksToEvent )
+{
+    uint32_t ulTicksAhead;
+
+    if( ( int32_t ) ( ulTickNow - ulSimPortTick ) > 0 )
+    {
+        /* The kernel counted the tick of the last interrupt. */
+        ulSimPortTick = ulTickNow;
+    }
+
+    ulTicksAhead = ( ulTickNow + ulTicksToEvent ) - ulSimPortTick;
+
+    if( ( int32_t ) ulTicksAhead <= 0 )
+    {
+        /* The kernel is behind the port, the next tick is the earliest. */
+        ulTicksAhead = 1U;
+    }
+
+    /* An event due at a tick that has already started interrupts at the end
+     * of the tick in progress, as soon as the target timer could. */
+    if( ( int32_t ) ( ( ulSimPortTick + ulTicksAhead ) - ulSimTick ) < 1 )
+    {
+        ulSimEventTick = ulSimTick + 1U;
+    }
+    else
+    {
+        ulSimEventTick = ulSimPortTick + ulTicksAhead;
+    }
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulSimGetTickInterrupts( void )
+{
+    return ulSimTickInterrupts;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulSimGetJobs( UBaseType_t uxTask )
+{
+    return xSimTasks[ uxTask ].ulJobs;
+}
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xSimGetHandle( UBaseType_t uxTask )
+{
+    return xSimTasks[ uxTask ].xHandle;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xSimGetLastWake( UBaseType_t uxTask )
+{
+    return xSimTasks[ uxTask ].xLastWake;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulSimGetMisses( UBaseType_t uxTask )
+{
+    return xSimTasks[ uxTask ].ulMisses;
+}
@@ -0,0 +1,68 @@
+/*
+ * A discrete tick simulator for the host test programs.  Each simulated
+ * periodic task is a real task of the kernel whose jobs take a fixed number of
+ * ticks.  At every tick the simulator charges one tick to the task the kernel
+ * has made the running task, and when a job is done it calls xTaskDelayUntil()
+ * on behalf of that task, as the task's loop would.
+ *
+ * With configUSE_EVENT_DRIVEN_TICK set to 1 the simulator is also the port's
+ * one-shot timer: time still passes one tick at a time, but the kernel only
+ * sees a tick interrupt at the tick it asked for through
+ * portSET_NEXT_TICK_EVENT(), and reads the ticks in between through
+ * portGET_ELAPSED_TICKS().
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define simMAX_TASKS    1024
+
+/*
+ * Create a periodic task in the EDF band whose jobs run for xWCET ticks.
+ * Returns its index, 'A' + index is its letter in the schedule.
+ */
+UBaseType_t uxSimCreatePeriodic( TickType_t xWCET,
+                                 TickType_t xPeriod,
+                                 TickType_t xDeadline );
+
+/*
+ * Start the scheduler.  The first release of every task is the tick the
+ * scheduler starts at.
+ */
+void vSimStart( void );
+
+/*
+ * Run xTicks ticks.  If pcSchedule is not NULL the letter of the task that ran
+ * in each tick is written to it, '.' for the idle task and '?' for any other
+ * task, followed by a terminating 0.
+ */
+void vSimRun( TickType_t xTicks,
+              char * pcSchedule );
+
+/*
+ * The tick interrupts taken so far.  With configUSE_EVENT_DRIVEN_TICK set the
+ * simulator only interrupts at the tick the kernel programmed last.
+ */
+uint32_t ulSimGetTickInterrupts( void );
+
+/*
+ * The jobs the task completed and the deadlines it missed.
+ */
+uint32_t ulSimGetJobs( UBaseType_t uxTask );
+
+/*
+ * The kernel's handle of the task.
+ */
+TaskHandle_t xSimGetHandle( UBaseType_t uxTask );
+
+/*
+ * The wake time the task keeps for xTaskDelayUntil().  While the task is
+ * blocked it is the release of its next job.
+ */
+TickType_t xSimGetLastWake( UBaseType_t uxTask );
+uint32_t ulSimGetMisses( UBaseType_t uxTask );
+
+#endif /* SIM_H */
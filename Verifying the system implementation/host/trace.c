@@ -0,0 +1,51 @@
+/*
+ * Runs a task set with the trace recorder and writes what xTaskTraceRead()
+ * returns to the file named by argv[ 1 ], for trace_decode.py --raw.  run.sh
+ * exports it with --chrome and checks the deadline markers with
+ * trace_check.py, with and without configUSE_EDF_FINE_DEADLINES.
+ */
+
+#include <stdio.h>
+
+#include "sim.h"
+#include "task_ext.h"
+
+/* C, T, D of each task, the D of each must be given to trace_check.py. */
+static const TickType_t xTaskSet[][ 3 ] = { { 1, 5, 3 }, { 2, 10, 7 }, { 3, 20, 20 } };
+
+int main( int argc,
+          char ** argv )
+{
+    static uint8_t ucRecords[ 8 * 4096 ];
+    size_t xLength;
+    UBaseType_t uxTask;
+    FILE * pxFile;
+
+    if( argc != 2 )
+    {
+        printf( "usage: %s <raw trace file>\n", argv[ 0 ] );
+        return 1;
+    }
+
+    for( uxTask = 0; uxTask < ( sizeof( xTaskSet ) / sizeof( xTaskSet[ 0 ] ) ); uxTask++ )
+    {
+        ( void ) uxSimCreatePeriodic( xTaskSet[ uxTask ][ 0 ], xTaskSet[ uxTask ][ 1 ], xTaskSet[ uxTask ][ 2 ] );
+    }
+
+    vSimStart();
+    vSimRun( 200, NULL );
+
+    xLength = xTaskTraceRead( ucRecords, sizeof( ucRecords ) );
+    pxFile = fopen( argv[ 1 ], "wb" );
+
+    if( ( pxFile == NULL ) || ( fwrite( ucRecords, 1, xLength, pxFile ) != xLength ) )
+    {
+        printf( "cannot write %s\n", argv[ 1 ] );
+        return 2;
+    }
+
+    ( void ) fclose( pxFile );
+    printf( "%u records\n", ( unsigned ) ( xLength / 8U ) );
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Check the deadline markers of a trace exported by trace_decode.py --chrome.
+
+    trace_check.py TRACE.json TIMER_HZ TICK_HZ D0 D1 ...
+
+D0, D1, ... are the relative deadlines in ticks of the tasks the simulator
+named S0, S1, ...  Every release must be followed by a deadline marker that
+lies the relative deadline after it, to within one timer count, which is what
+configUSE_EDF_FINE_DEADLINES rounds the deadline to.
+"""
+
+import json
+import sys
+
+
+def main():
+    if len(sys.argv) < 5:
+        raise SystemExit(__doc__)
+    with open(sys.argv[1]) as stream:
+        events = json.load(stream)["traceEvents"]
+    timer_hz, tick_hz = int(sys.argv[2]), int(sys.argv[3])
+    deadlines = [int(d) for d in sys.argv[4:]]
+
+    names = {e["tid"]: e["args"]["name"] for e in events if e.get("name") == "thread_name"}
+    marks = {}
+    for event in events:
+        name = names.get(event.get("tid"), "")
+        if name.startswith("S") and event["ph"] == "i":
+            marks.setdefault((name, event["name"]), []).append(event["ts"])
+
+    # The export is sorted by time, so when D equals T a job's deadline comes
+    # after the next release: pair the n-th deadline with the n-th release.
+    checked = failed = 0
+    for (name, kind), stamps in sorted(marks.items()):
+        if kind != "deadline":
+            continue
+        for released, deadline in zip(marks[(name, "release")], stamps):
+            expected = released + deadlines[int(name[1:])] * 1e6 / tick_hz
+            checked += 1
+            if abs(deadline - expected) > 1e6 / timer_hz + 1e-6:
+                failed += 1
+                print("%s deadline at %.3f us, expected %.3f us" % (name, deadline, expected))
+
+    print("%d deadlines checked, %d wrong" % (checked, failed))
+    return 1 if failed or not checked else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
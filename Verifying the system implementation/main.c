@@ -59,10 +59,14 @@
 /* Scheduler includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "task_ext.h"
 #include "lpc21xx.h"
 #include "semphr.h"
 #include "queue.h"
 #include "event_groups.h"
+#if ( configUSE_CO_ROUTINES != 0 )
+	#include "croutine.h"
+#endif
 
 /* Peripheral includes. */
 #include "serial.h"
@@ -90,19 +94,40 @@ TaskHandle_t Load2_handler     = NULL;
 
 QueueHandle_t xQueue;
 
+/* Stack sizes in words.  With mainUSE_MEASURED_STACK_SIZES set to 1 they are
+taken from stack_sizes.h, a copy of the #define lines printed by the stack
+report (configUSE_STACK_REPORT) after a run that went through every path. */
+#define mainUSE_MEASURED_STACK_SIZES	0
 
-#if ( TIMER_TRACE_Config == 1 )
+#if ( mainUSE_MEASURED_STACK_SIZES == 1 )
+	#include "stack_sizes.h"
+#endif
 
-int button1_TaskInTime,      button1_TaskOutTime,     button1_TaskTotalTime;
-int button2_TaskInTime,      button2_TaskOutTime,     button2_TaskTotalTime;
-int Transmitter_TaskInTime,  Transmitter_TaskOutTime, Transmitter_TaskTotalTime;
-int Consumer_TaskInTime,     Consumer_TaskOutTime,    Consumer_TaskTotalTime;
-int load1_TaskInTime,        load1_TaskOutTime,       load1_TaskTotalTime;
-int load2_TaskInTime,        load2_TaskOutTime,       load2_TaskTotalTime;
-/* SYSTEM_TIME = TITC */ 
-int system_Time = 0;
-int cpu_Load = 0;
+#ifndef mainSTACK_BUTTON_1_MONITOR
+	#define mainSTACK_BUTTON_1_MONITOR		100
+#endif
+#ifndef mainSTACK_BUTTON_2_MONITOR
+	#define mainSTACK_BUTTON_2_MONITOR		100
+#endif
+#ifndef mainSTACK_PERIODIC_TRANSMITTER
+	#define mainSTACK_PERIODIC_TRANSMITTER	100
+#endif
+#ifndef mainSTACK_UART_RECEIVER
+	#define mainSTACK_UART_RECEIVER			100
+#endif
+#ifndef mainSTACK_LOAD_1_SIMULATION
+	#define mainSTACK_LOAD_1_SIMULATION		100
+#endif
+#ifndef mainSTACK_LOAD_2_SIMULATION
+	#define mainSTACK_LOAD_2_SIMULATION		100
 #endif
+
+
+/* Percentage of time spent outside the idle task, over the last second when
+configUSE_CPU_LOAD_WINDOWS is 1 and since start-up otherwise, for the debugger
+watch window.  Refreshed by the idle hook, once a second when it has to divide
+the 64-bit run time counters itself. */
+int cpu_Load = 0;
 /*
  * Configure the processor for use with the Keil demo board.  This is very
  * minimal as most of the setup is managed by the settings in the project
@@ -132,9 +157,6 @@ void Button_1_Monitor( void * pvParameters )
 	TickType_t xLastWakeTime;
 	xLastWakeTime = xTaskGetTickCount();
 	
-#if ( TIMER_TRACE_Config == 1 )
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 1 );
-#endif
 
 	for( ;; )
 	{
@@ -194,10 +216,6 @@ void Button_2_Monitor( void * pvParameters )
 	TickType_t xLastWakeTime;
 	xLastWakeTime = xTaskGetTickCount();
 
-#if ( TIMER_TRACE_Config == 1 )
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 2 );
-#endif
-
 	for( ;; )
 	{
 		B2_curr_state = GPIO_read(PORT_0, PIN2);
@@ -247,11 +265,6 @@ void Periodic_Transmitter( void * pvParameters )
 	TickType_t xLastWakeTime;
 	xLastWakeTime = xTaskGetTickCount();
 
-
-#if (TIMER_TRACE_Config == 1 )
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 3 );
-#endif
-
 	for( ;; )
 	{
 		if ( xQueue != 0 )
@@ -280,9 +293,6 @@ void Uart_Receiver( void * pvParameters )
 	TickType_t xLastWakeTime;
 	xLastWakeTime = xTaskGetTickCount();
 	
-#if (TIMER_TRACE_Config == 1 )
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 4 );
-#endif
 	
 	for( ;; )
 	{
@@ -309,11 +319,6 @@ void Load_1_Simulation( void * pvParameters )
 	TickType_t xLastWakeTime;
 	xLastWakeTime = xTaskGetTickCount();
 
-
-#if ( TIMER_TRACE_Config == 1 )
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 5);
-#endif
-
 	for( ;; )
 	{
 
@@ -336,9 +341,6 @@ void Load_2_Simulation( void * pvParameters )
 	xLastWakeTime = xTaskGetTickCount();
 
 	
-#if (TIMER_TRACE_Config == 1 )
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 6 );
-#endif
 
 
 	for( ;; )
@@ -362,11 +364,551 @@ void vApplicationTickHook( void )
 }
 
 /*Idle_Task CallBack Function */ 
+/* PIN9 is driven high on each pass of the idle loop and low by the tasks.  With
+configUSE_TICKLESS_IDLE 2 the idle task spends its idle time asleep in
+vApplicationSleep(), where this hook does not run, so PIN9 no longer shows idle
+time: it only marks that the idle task was switched in.  cpu_Load, taken from
+the run time counters, still counts the sleep as idle. */
 void vApplicationIdleHook( void )
 {
 	GPIO_write (PORT_0, PIN9, PIN_IS_HIGH);
+
+#if ( configUSE_CPU_LOAD_WINDOWS == 1 )
+	cpu_Load = ( int ) ( uxTaskGetCpuLoad( 1 ) / 10 );
+#else
+	{
+		static TickType_t xLastLoadUpdate = 0;
+		TickType_t xNow = xTaskGetTickCount();
+
+		/* The idle hook runs over and over, a long division on each pass
+		would only add to the load it measures.  The tick count is read once,
+		as vTaskStepTick() can move it on by many ticks at a time. */
+		if( ( xNow - xLastLoadUpdate ) >= ( TickType_t ) configTICK_RATE_HZ )
+		{
+			xLastLoadUpdate = xNow;
+			cpu_Load = 100 - ( int ) ulTaskGetIdleRunTimePercent();
+		}
+	}
+#endif
+
+#if ( configUSE_CO_ROUTINES != 0 )
+	/* The co-routines share the idle task's stack, one step per pass, the
+	earliest deadline first with configUSE_EDF_CO_ROUTINES.  Tickless idle does
+	not know their wake times, so with it they only run when the core wakes. */
+	vCoRoutineSchedule();
+#endif
+}
+
+#if ( configUSE_TRACE_RECORDER == 1 ) || ( configUSE_STACK_REPORT == 1 ) || ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 )
+
+/* How long the UART takes over a line of ulChars characters, 10 bits each. */
+#define mainUART_LINE_TICKS( ulChars )	( ( TickType_t ) ( ( ( ( ulChars ) * 10UL * configTICK_RATE_HZ ) / mainCOM_TEST_BAUD_RATE ) + 1UL ) )
+
+/* Send a line from a task, the buffer must stay untouched until the UART is
+done with it. */
+static void prvSendLine( const char *pcLine, unsigned long ulLength )
+{
+	/* The UART refuses a string while it is still sending another one. */
+	while( vSerialPutString( ( const signed char * ) pcLine, ( unsigned short ) ulLength ) == pdFALSE )
+	{
+		vTaskDelay( 1 );
+	}
+
+	/* Give the UART the time to send the line before the next one. */
+	vTaskDelay( mainUART_LINE_TICKS( ulLength ) );
+}
+
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+/* The kernel trace records are sent over the UART as text lines so they can
+share it with Uart_Receiver: '#', a base64 frame, '\n'.  A frame is a type
+byte, the payload and a checksum byte that makes the bytes add up to 0.
+trace_decode.py reads them back on the host. */
+#define mainTRACE_FRAME_HEADER		( ( unsigned char ) 0x01 )
+#define mainTRACE_FRAME_RECORDS		( ( unsigned char ) 0x02 )
+#define mainTRACE_RECORD_SIZE		( 8 )
+#define mainTRACE_RECORDS_PER_LINE	( 24 )
+#define mainTRACE_FRAME_SIZE		( 2 + ( mainTRACE_RECORDS_PER_LINE * mainTRACE_RECORD_SIZE ) )
+#define mainTRACE_LINE_SIZE			( 2 + ( ( ( mainTRACE_FRAME_SIZE + 2 ) / 3 ) * 4 ) )
+
+/* Records are stamped with T1TC, PCLK divided by T1PR + 1. */
+#define mainTRACE_TIMER_HZ			( configCPU_CLOCK_HZ / 1001UL )
+
+/* The header is repeated so a capture can start at any time. */
+#define mainTRACE_HEADER_EVERY		( 64 )
+
+/* How long the drain waits when the trace buffer is empty.  Each wait adds
+three records of its own. */
+#define mainTRACE_DRAIN_PERIOD		( ( TickType_t ) 50 )
+
+static const char cBase64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* Encode and send one frame, ucFrame[ 0 ] holding its type.  The UART sends
+from the line buffer while the next one is filled, so two are used in turn. */
+static void prvTraceSendFrame( unsigned char *ucFrame, unsigned long ulLength )
+{
+	static char cLines[ 2 ][ mainTRACE_LINE_SIZE ];
+	static unsigned char ucLine = 0;
+	char *pcLine = cLines[ ucLine ];
+	unsigned long ulIn, ulOut = 0, ulBits;
+	unsigned char ucSum = 0;
+
+	for( ulIn = 0; ulIn < ulLength; ulIn++ )
+	{
+		ucSum += ucFrame[ ulIn ];
+	}
+	ucFrame[ ulLength++ ] = ( unsigned char ) ( 0U - ucSum );
+
+	pcLine[ ulOut++ ] = '#';
+
+	for( ulIn = 0; ulIn < ulLength; ulIn += 3 )
+	{
+		ulBits = ( unsigned long ) ucFrame[ ulIn ] << 16;
+
+		if( ( ulIn + 1 ) < ulLength )
+		{
+			ulBits |= ( unsigned long ) ucFrame[ ulIn + 1 ] << 8;
+		}
+
+		if( ( ulIn + 2 ) < ulLength )
+		{
+			ulBits |= ( unsigned long ) ucFrame[ ulIn + 2 ];
+		}
+
+		pcLine[ ulOut++ ] = cBase64[ ( ulBits >> 18 ) & 0x3F ];
+		pcLine[ ulOut++ ] = cBase64[ ( ulBits >> 12 ) & 0x3F ];
+		pcLine[ ulOut++ ] = ( ( ulIn + 1 ) < ulLength ) ? cBase64[ ( ulBits >> 6 ) & 0x3F ] : '=';
+		pcLine[ ulOut++ ] = ( ( ulIn + 2 ) < ulLength ) ? cBase64[ ulBits & 0x3F ] : '=';
+	}
+
+	pcLine[ ulOut++ ] = '\n';
+
+	ucLine ^= 1;
+	prvSendLine( pcLine, ulOut );
+}
+
+/* Runs at the idle priority, so the trace is only sent in the spare time. */
+static void prvTraceDrainTask( void * pvParameters )
+{
+	static unsigned char ucFrame[ mainTRACE_FRAME_SIZE ];
+	unsigned long ulLength, ulLinesToHeader = 0;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		if( ulLinesToHeader == 0 )
+		{
+			ulLinesToHeader = mainTRACE_HEADER_EVERY;
+
+			ucFrame[ 0 ] = mainTRACE_FRAME_HEADER;
+			ucFrame[ 1 ] = 'E';
+			ucFrame[ 2 ] = 'D';
+			ucFrame[ 3 ] = 'F';
+			ucFrame[ 4 ] = 'T';
+			ucFrame[ 5 ] = 2;	/* Version, 2 since DEADLINE records hold the absolute deadline. */
+			ucFrame[ 6 ] = ( unsigned char ) ( mainTRACE_TIMER_HZ );
+			ucFrame[ 7 ] = ( unsigned char ) ( mainTRACE_TIMER_HZ >> 8 );
+			ucFrame[ 8 ] = ( unsigned char ) ( mainTRACE_TIMER_HZ >> 16 );
+			ucFrame[ 9 ] = ( unsigned char ) ( mainTRACE_TIMER_HZ >> 24 );
+			ucFrame[ 10 ] = ( unsigned char ) ( configTICK_RATE_HZ );
+			ucFrame[ 11 ] = ( unsigned char ) ( configTICK_RATE_HZ >> 8 );
+			prvTraceSendFrame( ucFrame, 12 );
+		}
+
+		ulLength = ( unsigned long ) xTaskTraceRead( &ucFrame[ 1 ], mainTRACE_RECORDS_PER_LINE * mainTRACE_RECORD_SIZE );
+
+		if( ulLength > 0 )
+		{
+			ucFrame[ 0 ] = mainTRACE_FRAME_RECORDS;
+			prvTraceSendFrame( ucFrame, ulLength + 1 );
+			ulLinesToHeader--;
+		}
+		else
+		{
+			vTaskDelay( mainTRACE_DRAIN_PERIOD );
+		}
+	}
+}
+
+#endif /* configUSE_TRACE_RECORDER */
+
+#if ( configUSE_STACK_REPORT == 1 ) || ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 )
+
+/* The stack and kernel reports are text lines printed every
+mainREPORT_PERIOD by tasks of the idle priority. */
+#define mainREPORT_PERIOD			( ( TickType_t ) ( 10UL * configTICK_RATE_HZ ) )
+#define mainREPORT_LINE_SIZE		( 80 )
+
+static unsigned long prvAppendText( char *pcLine, unsigned long ulOut, const char *pcText )
+{
+	while( ( *pcText != '\0' ) && ( ulOut < ( mainREPORT_LINE_SIZE - 1 ) ) )
+	{
+		pcLine[ ulOut++ ] = *pcText++;
+	}
+
+	return ulOut;
+}
+
+static unsigned long prvAppendNumber( char *pcLine, unsigned long ulOut, unsigned long ulValue )
+{
+	char cDigits[ 10 ];
+	unsigned long ulDigits = 0;
+
+	do
+	{
+		cDigits[ ulDigits++ ] = ( char ) ( '0' + ( ulValue % 10UL ) );
+		ulValue /= 10UL;
+	} while( ulValue != 0UL );
+
+	while( ( ulDigits > 0 ) && ( ulOut < ( mainREPORT_LINE_SIZE - 1 ) ) )
+	{
+		pcLine[ ulOut++ ] = cDigits[ --ulDigits ];
+	}
+
+	return ulOut;
+}
+
+#endif
+
+#if ( configUSE_STACK_REPORT == 1 )
+
+/* The stack report recommends the deepest use seen plus
+mainSTACK_MARGIN_PERCENT, rounded up to an even number of words as the stacks
+are 8 byte aligned.  The margin covers the paths the run did not take;
+interrupts use their own stack on this port. */
+#define mainSTACK_MARGIN_PERCENT	( 25UL )
+
+/* Print "#define mainSTACK_<name> <size>", the task name in upper case with
+spaces as underscores, and, as a comment, the words used out of the stack size,
+or all of it as a comment on configMINIMAL_STACK_SIZE for the idle task when
+xDefine is pdFALSE.  "full" flags a stack that may have overflowed. */
+static void prvStackReportLine( TaskHandle_t xTask, BaseType_t xDefine )
+{
+	static char cLine[ mainREPORT_LINE_SIZE ];
+	const char *pcName;
+	UBaseType_t uxDepth;
+	unsigned long ulUsed, ulSize, ulOut;
+
+	ulUsed = ( unsigned long ) uxTaskGetStackUsage( xTask, &uxDepth );
+	ulSize = ( ulUsed + ( ( ( ulUsed * mainSTACK_MARGIN_PERCENT ) + 99UL ) / 100UL ) + 1UL ) & ~1UL;
+
+	if( xDefine != pdFALSE )
+	{
+		ulOut = prvAppendText( cLine, 0, "#define mainSTACK_" );
+
+		for( pcName = pcTaskGetName( xTask ); ( *pcName != '\0' ) && ( ulOut < ( mainREPORT_LINE_SIZE - 1 ) ); pcName++ )
+		{
+			if( ( *pcName >= 'a' ) && ( *pcName <= 'z' ) )
+			{
+				cLine[ ulOut++ ] = ( char ) ( *pcName - 'a' + 'A' );
+			}
+			else
+			{
+				cLine[ ulOut++ ] = ( *pcName == ' ' ) ? '_' : *pcName;
+			}
+		}
+
+		ulOut = prvAppendText( cLine, ulOut, "\t" );
+		ulOut = prvAppendNumber( cLine, ulOut, ulSize );
+		ulOut = prvAppendText( cLine, ulOut, "\t/* used " );
+	}
+	else
+	{
+		ulOut = prvAppendText( cLine, 0, "/* configMINIMAL_STACK_SIZE " );
+		ulOut = prvAppendNumber( cLine, ulOut, ulSize );
+		ulOut = prvAppendText( cLine, ulOut, ", idle task used " );
+	}
+
+	ulOut = prvAppendNumber( cLine, ulOut, ulUsed );
+	ulOut = prvAppendText( cLine, ulOut, " of " );
+	ulOut = prvAppendNumber( cLine, ulOut, ( unsigned long ) uxDepth );
+	ulOut = prvAppendText( cLine, ulOut, ( ulUsed >= ( unsigned long ) uxDepth ) ? " words, full */" : " words */" );
+	cLine[ ulOut++ ] = '\n';
+
+	prvSendLine( cLine, ulOut );
+}
+
+/* Runs at the idle priority and prints the lines of stack_sizes.h for the
+periodic tasks the kernel knows of, then the idle task's use. */
+static void prvStackReportTask( void * pvParameters )
+{
+	TaskHandle_t xTask;
+	UBaseType_t uxTask;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		vTaskDelay( mainREPORT_PERIOD );
+
+		for( uxTask = 0; ( xTask = xTaskPeriodicGetHandle( uxTask ) ) != NULL; uxTask++ )
+		{
+			prvStackReportLine( xTask, pdTRUE );
+		}
+
+		prvStackReportLine( xTaskGetIdleTaskHandle(), pdFALSE );
+	}
+}
+
+#endif /* configUSE_STACK_REPORT */
+
+#if ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 )
+
+#if ( configUSE_KERNEL_PROFILING == 1 )
+
+/* The parts of the kernel ulTaskGetSchedulerProfile() times, in the order of
+taskPROFILE_TICK to taskPROFILE_CRITICAL in task_ext.h. */
+static const char * const pcProfileSections[] = { "tick", "switch", "ready insert", "critical" };
+
+#endif
+
+/* Print "<pcName><ulNumber>: <count> x, min <n> avg <n> max <n> cycles", the
+number left out when ulNumber is mainREPORT_NO_NUMBER. */
+#define mainREPORT_NO_NUMBER	( 0xFFFFFFFFUL )
+
+static void prvReportStatsLine( const char *pcName, unsigned long ulNumber, uint32_t ulCount, uint32_t ulMin, uint32_t ulAverage, uint32_t ulMax )
+{
+	static char cLine[ mainREPORT_LINE_SIZE ];
+	unsigned long ulOut;
+
+	ulOut = prvAppendText( cLine, 0, pcName );
+
+	if( ulNumber != mainREPORT_NO_NUMBER )
+	{
+		ulOut = prvAppendNumber( cLine, ulOut, ulNumber );
+	}
+
+	ulOut = prvAppendText( cLine, ulOut, ": " );
+	ulOut = prvAppendNumber( cLine, ulOut, ( unsigned long ) ulCount );
+	ulOut = prvAppendText( cLine, ulOut, " x, min " );
+	ulOut = prvAppendNumber( cLine, ulOut, ( unsigned long ) ulMin );
+	ulOut = prvAppendText( cLine, ulOut, " avg " );
+	ulOut = prvAppendNumber( cLine, ulOut, ( unsigned long ) ulAverage );
+	ulOut = prvAppendText( cLine, ulOut, " max " );
+	ulOut = prvAppendNumber( cLine, ulOut, ( unsigned long ) ulMax );
+	ulOut = prvAppendText( cLine, ulOut, " cycles" );
+	cLine[ ulOut++ ] = '\n';
+
+	prvSendLine( cLine, ulOut );
+}
+
+/* Runs at the idle priority and prints, over the last mainREPORT_PERIOD, the
+count and the minimum, average and maximum PCLK cycles of each timed part of
+the kernel, e.g. "tick: 10000 x, min 310 avg 352 max 1204 cycles", then of the
+interrupt to task latency of each source that woke a task, e.g. "isr 0: ...".
+
+An interrupt is timed by calling vTaskLatencyEnterISR( <source> ) first thing
+in its handler and vTaskLatencyExitISR() before it returns, for example in the
+UART interrupt of serial.c that hands the received characters to a task. */
+static void prvKernelReportTask( void * pvParameters )
+{
+	unsigned long ulIndex;
+	uint32_t ulCount, ulMin, ulAverage, ulMax;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		vTaskDelay( mainREPORT_PERIOD );
+
+#if ( configUSE_KERNEL_PROFILING == 1 )
+		for( ulIndex = 0; ulIndex < ( sizeof( pcProfileSections ) / sizeof( pcProfileSections[ 0 ] ) ); ulIndex++ )
+		{
+			ulCount = ulTaskGetSchedulerProfile( ( UBaseType_t ) ulIndex, &ulMin, &ulAverage, &ulMax, pdTRUE );
+			prvReportStatsLine( pcProfileSections[ ulIndex ], mainREPORT_NO_NUMBER, ulCount, ulMin, ulAverage, ulMax );
+		}
+#endif
+
+#if ( configUSE_ISR_LATENCY == 1 )
+		for( ulIndex = 0; ulIndex < configISR_LATENCY_SOURCES; ulIndex++ )
+		{
+			ulCount = ulTaskGetISRLatency( ( UBaseType_t ) ulIndex, &ulMin, &ulAverage, &ulMax, pdTRUE );
+
+			if( ulCount != 0 )
+			{
+				prvReportStatsLine( "isr ", ulIndex, ulCount, ulMin, ulAverage, ulMax );
+			}
+		}
+#endif
+	}
+}
+
+#endif /* ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 ) */
+
+#if ( configUSE_TICKLESS_IDLE == 2 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 )
+
+/* Timer0 generates the tick: no prescaler and a match every tick that resets
+the counter (see prvSetupTimerInterrupt() in the LPC2000 port). */
+#define mainTIMER0_COUNTS_PER_TICK	( configCPU_CLOCK_HZ / configTICK_RATE_HZ )
+#define mainMAX_SUPPRESSED_TICKS	( 0xFFFFFFFFUL / mainTIMER0_COUNTS_PER_TICK )
+#define mainTIMER0_MR0_INTERRUPT	( 0x01 )
+
+#endif
+
+#if ( configUSE_TICKLESS_IDLE == 2 )
+
+#define mainPCON_IDLE_MODE			( 0x01 )
+
+/* Called by the idle task with the scheduler suspended when no job is ready.
+Timer0 is stretched up to the next release so the core sleeps through the
+ticks in between instead of waking every millisecond. */
+void vApplicationSleep( uint32_t ulExpectedIdleTime )
+{
+	unsigned long ulCountsElapsed, ulCompleteTickPeriods;
+
+	if( ulExpectedIdleTime > mainMAX_SUPPRESSED_TICKS )
+	{
+		ulExpectedIdleTime = mainMAX_SUPPRESSED_TICKS;
+	}
+
+	/* Stop the tick while it is reprogrammed.  T0TC keeps the counts already
+	spent in the current tick.  The few cycles lost here are not accounted
+	for. */
+	T0TCR = 0;
+
+	portDISABLE_INTERRUPTS();
+
+	/* A task may have been readied between the idle task deciding to sleep
+	and interrupts being disabled. */
+	if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+	{
+		T0TCR = 1;
+		portENABLE_INTERRUPTS();
+		return;
+	}
+
+	/* Match at the end of the last idle tick.  The counter still holds the
+	part of the current tick that has already gone. */
+	T0MR0 = mainTIMER0_COUNTS_PER_TICK * ulExpectedIdleTime;
+	T0TCR = 1;
+
+	/* Any enabled interrupt ends idle mode, including the stretched tick. */
+	PCON = mainPCON_IDLE_MODE;
+
+	T0TCR = 0;
+
+	if( ( T0IR & mainTIMER0_MR0_INTERRUPT ) != 0 )
+	{
+		/* The tick interrupt ended the sleep.  It is still pending and will
+		count the last tick itself once interrupts are enabled. */
+		ulCompleteTickPeriods = ulExpectedIdleTime - 1UL;
+		T0MR0 = mainTIMER0_COUNTS_PER_TICK;
+	}
+	else
+	{
+		/* Another interrupt ended the sleep early: step the whole ticks that
+		passed and keep the counter inside the current tick. */
+		ulCountsElapsed = T0TC;
+		ulCompleteTickPeriods = ulCountsElapsed / mainTIMER0_COUNTS_PER_TICK;
+		T0TC = ulCountsElapsed % mainTIMER0_COUNTS_PER_TICK;
+		T0MR0 = mainTIMER0_COUNTS_PER_TICK;
+	}
+
+	T0TCR = 1;
+	vTaskStepTick( ulCompleteTickPeriods );
+	portENABLE_INTERRUPTS();
+}
+
+#endif /* configUSE_TICKLESS_IDLE */
+
+#if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+
+/* The match is kept at least this far ahead of the counter so it cannot be
+passed before it is written. */
+#define mainTIMER0_MIN_MATCH_DISTANCE	( 64UL )
+
+/* Longest distance to a match that can still be told apart from a match that
+has already been passed. */
+#define mainMAX_TICKS_TO_EVENT		( 0x7FFFFFFFUL / mainTIMER0_COUNTS_PER_TICK )
+
+/* Timer0 counts freely once the kernel programs the first event.  The port
+keeps the tick it has accounted up to and the counter value at which that tick
+started; ulEventTick is the tick the match interrupt will count. */
+static unsigned long ulPortTick = 0, ulPortTickStart = 0, ulEventTick = 0;
+static unsigned long ulTickEventsStarted = 0;
+
+/* Called by the kernel with interrupts masked.  Returns the whole ticks gone
+since the last call, except the tick of the pending match which the tick
+interrupt counts itself. */
+uint32_t ulApplicationGetElapsedTicks( void )
+{
+	unsigned long ulElapsedTicks;
+
+	if( ulTickEventsStarted == 0 )
+	{
+		/* Timer0 still interrupts every tick. */
+		return 0;
+	}
+
+	ulElapsedTicks = ( T0TC - ulPortTickStart ) / mainTIMER0_COUNTS_PER_TICK;
+
+	if( ulElapsedTicks > ( ulEventTick - ulPortTick - 1UL ) )
+	{
+		ulElapsedTicks = ulEventTick - ulPortTick - 1UL;
+	}
+
+	ulPortTick += ulElapsedTicks;
+	ulPortTickStart += ulElapsedTicks * mainTIMER0_COUNTS_PER_TICK;
+
+	return ulElapsedTicks;
+}
+
+/* Called by the kernel with interrupts masked at the end of each tick
+interrupt and context switch.  ulTickNow is the tick count the kernel has
+accounted, which lags the port only while the kernel unwinds pended ticks. */
+void vApplicationSetNextTickEvent( uint32_t ulTickNow, uint32_t ulTicksToEvent )
+{
+	unsigned long ulTicksAhead, ulMatch;
+
+	if( ulTickEventsStarted == 0 )
+	{
+		/* The first call comes from the first tick interrupt, so T0TC holds
+		the counts since the start of the current tick.  Stop resetting the
+		counter on a match. */
+		ulPortTick = ulTickNow;
+		ulPortTickStart = 0;
+		T0MCR = mainTIMER0_MR0_INTERRUPT;
+		ulTickEventsStarted = 1;
+	}
+	else if( ( long ) ( ulTickNow - ulPortTick ) > 0 )
+	{
+		/* The kernel counted the ticks of matches since the last call. */
+		ulPortTickStart += ( ulTickNow - ulPortTick ) * mainTIMER0_COUNTS_PER_TICK;
+		ulPortTick = ulTickNow;
+	}
+
+	if( ulTicksToEvent > mainMAX_TICKS_TO_EVENT )
+	{
+		ulTicksToEvent = mainMAX_TICKS_TO_EVENT;
+	}
+
+	ulTicksAhead = ( ulTickNow + ulTicksToEvent ) - ulPortTick;
+
+	if( ( ( long ) ulTicksAhead <= 0 ) || ( ulTicksAhead > mainMAX_TICKS_TO_EVENT ) )
+	{
+		/* The kernel is behind the port, the next tick is the earliest. */
+		ulTicksAhead = 1UL;
+	}
+
+	ulEventTick = ulPortTick + ulTicksAhead;
+	ulMatch = ulPortTickStart + ( ulTicksAhead * mainTIMER0_COUNTS_PER_TICK );
+
+	if( ( long ) ( ulMatch - T0TC ) < ( long ) mainTIMER0_MIN_MATCH_DISTANCE )
+	{
+		/* That tick has already started; interrupt as soon as possible.  The
+		interrupt counts ulEventTick, the ticks past it are reported by the
+		next ulApplicationGetElapsedTicks(). */
+		ulMatch = T0TC + mainTIMER0_MIN_MATCH_DISTANCE;
+	}
+
+	T0MR0 = ulMatch;
 }
 
+#endif /* configUSE_EVENT_DRIVEN_TICK */
+
 /*
  * Application entry point:
  * Starts all the other tasks, then starts the scheduler. 
@@ -382,57 +924,73 @@ int main( void )
 	xTaskPeriodicCreate(
 			Button_1_Monitor,                  /* Function that implements the task. */
 			"BUTTON 1 MONITOR",                /* Text name for the task. */
-			100,                               /* Stack size in words, not bytes. */
+			mainSTACK_BUTTON_1_MONITOR,        /* Stack size in words, not bytes. */
 			( void * ) 0,                      /* Parameter passed into the task. */
-			1,                                 /* Priority at which the task is created. */
+			configEDF_PRIORITY_BAND,           /* Priority at which the task is created. */
 			&Button_1_Monitor_handler,         /* Used to pass out the created task's handle. */
 			50);                               /* Period for the task */
 
 	xTaskPeriodicCreate(
 			Button_2_Monitor,                  /* Function that implements the task. */
 			"BUTTON 2 MONITOR",                /* Text name for the task. */
-			100,                               /* Stack size in words, not bytes. */
+			mainSTACK_BUTTON_2_MONITOR,        /* Stack size in words, not bytes. */
 			( void * ) 0,                      /* Parameter passed into the task. */
-			1,                                 /* Priority at which the task is created. */
+			configEDF_PRIORITY_BAND,           /* Priority at which the task is created. */
 			&Button_2_Monitor_handler,         /* Used to pass out the created task's handle. */
 			50);                               /* Period for the task */
 
 	xTaskPeriodicCreate(
 			Periodic_Transmitter,               /* Function that implements the task. */
 			"PERIODIC TRANSMITTER",             /* Text name for the task. */
-			100,                                /* Stack size in words, not bytes. */
+			mainSTACK_PERIODIC_TRANSMITTER,     /* Stack size in words, not bytes. */
 			( void * ) 0,                       /* Parameter passed into the task. */
-			1,                                  /* Priority at which the task is created. */
+			configEDF_PRIORITY_BAND,            /* Priority at which the task is created. */
 			&PeriodicTransmitter_handler,       /* Used to pass out the created task's handle. */
 			100);                               /* Period for the task */
 
 	xTaskPeriodicCreate(
 			Uart_Receiver,                      /* Function that implements the task. */
 			"UART RECEIVER",                    /* Text name for the task. */
-			100,                                /* Stack size in words, not bytes. */
+			mainSTACK_UART_RECEIVER,            /* Stack size in words, not bytes. */
 			( void * ) 0,                       /* Parameter passed into the task. */
-			1,                                  /* Priority at which the task is created. */
+			configEDF_PRIORITY_BAND,            /* Priority at which the task is created. */
 			&Uart_Receiver_handler,             /* Used to pass out the created task's handle. */
 			20);                                /* Period for the task */
 
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateConstrained(
 			Load_1_Simulation,                 /* Function that implements the task. */
 			"LOAD 1 SIMULATION",               /* Text name for the task. */
-			100,                               /* Stack size in words, not bytes. */
+			mainSTACK_LOAD_1_SIMULATION,       /* Stack size in words, not bytes. */
 			( void * ) 0,                      /* Parameter passed into the task. */
-			1,                                 /* Priority at which the task is created. */
+			configEDF_PRIORITY_BAND,           /* Priority at which the task is created. */
 			&Load1_handler,                    /* Used to pass out the created task's handle. */
-			10);	                            /* Period for the task */
+			10,                                /* Period for the task */
+			10,                                /* Relative deadline for the task */
+			5);                                /* Execution time for the response time analysis */
 
 	
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateConstrained(
 			Load_2_Simulation,                 /* Function that implements the task. */
 			"LOAD 2 SIMULATION",               /* Text name for the task. */
-			100,                               /* Stack size in words, not bytes. */
+			mainSTACK_LOAD_2_SIMULATION,       /* Stack size in words, not bytes. */
 			( void * ) 0,                      /* Parameter passed into the task. */
-			1,                                 /* Priority at which the task is created. */
+			configEDF_PRIORITY_BAND,           /* Priority at which the task is created. */
 			&Load2_handler,                    /* Used to pass out the created task's handle. */
-			100); 	                           /* Period for the task */
+			100,                               /* Period for the task */
+			100,                               /* Relative deadline for the task */
+			12);                               /* Execution time for the response time analysis */
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+	xTaskCreate( prvTraceDrainTask, "TRACE", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL );
+#endif
+
+#if ( configUSE_STACK_REPORT == 1 )
+	xTaskCreate( prvStackReportTask, "STACKS", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL );
+#endif
+
+#if ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 )
+	xTaskCreate( prvKernelReportTask, "KERNEL", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL );
+#endif
 
 	/* Now all the tasks have been started - start the scheduler.
 
@@ -449,10 +1007,39 @@ int main( void )
 }
 /*-----------------------------------------------------------*/
 
+/* T1TC extended to 64 bits.  ulRunTimeHalves counts the halves of the 32 bit
+range the counter has gone through, so its lowest bit matches the top bit of
+T1TC until the counter crosses into the next half.  The first read after that
+moves it on.  The new value only depends on the old one, so a task and an
+interrupt that both find it behind store the same value and no lock is
+needed.  The counter has to be read at least once every half range, about 10
+hours; every context switch and load sample reads it. */
+static volatile unsigned long ulRunTimeHalves = 0;
+
+uint64_t ullApplicationGetRunTime( void )
+{
+	unsigned long ulHalves, ulCount;
+
+	/* Read in this order, a half crossed after the read of ulRunTimeHalves
+	is then caught by the test below. */
+	ulHalves = ulRunTimeHalves;
+	ulCount = T1TC;
+
+	if( ( ( ulHalves ^ ( ulCount >> 31 ) ) & 1UL ) != 0 )
+	{
+		ulHalves++;
+		ulRunTimeHalves = ulHalves;
+	}
+
+	return ( ( uint64_t ) ( ulHalves >> 1 ) << 32 ) | ( uint64_t ) ulCount;
+}
+
+/* Restarts T1TC from 0, which also restarts the extended count. */
 void timer1Reset(void)
 {
 	T1TCR |= 0x2;
 	T1TCR &= ~0x2;
+	ulRunTimeHalves = 0;
 }
 
 static void ConfigTimer1(void)
@@ -475,6 +1062,20 @@ static void prvSetupHardware( void )
 	/* Configure trace timer 1 and read TITC to get current tick */
 	ConfigTimer1();
 
+#if ( configUSE_GPIO_TASK_TRACE == 1 )
+	/* Task number and release/miss strobes for the logic analyser, idle to start with */
+	IOCLR0 = configGPIO_TRACE_PINS;
+	IODIR0 |= configGPIO_TRACE_PINS;
+#endif
+
+#if ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 )
+	/* The PWM timer counts every PCLK for portPROFILE_GET_TIME() and
+	portLATENCY_GET_TIME(), no match resets it and no PWM output is enabled. */
+	PWMPR = 0;
+	PWMTCR = 0x2;
+	PWMTCR = 0x1;
+#endif
+
 	/* Setup the peripheral bus to be the same as the PLL output. */
 	VPBDIV = mainBUS_CLK_FULL;
 }
@@ -0,0 +1,16 @@
+/* Stack sizes in words of the periodic tasks, used by main.c when
+mainUSE_MEASURED_STACK_SIZES is 1.  Replace the lines below with the ones the
+stack report (configUSE_STACK_REPORT) prints after a run that went through
+every path.  Until then they are the sizes main.c uses without this file. */
+
+#ifndef STACK_SIZES_H
+#define STACK_SIZES_H
+
+#define mainSTACK_BUTTON_1_MONITOR	100
+#define mainSTACK_BUTTON_2_MONITOR	100
+#define mainSTACK_PERIODIC_TRANSMITTER	100
+#define mainSTACK_UART_RECEIVER	100
+#define mainSTACK_LOAD_1_SIMULATION	100
+#define mainSTACK_LOAD_2_SIMULATION	100
+
+#endif /* STACK_SIZES_H */
@@ -0,0 +1,296 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * The task API that the periodic task scheduler of this project adds to the
+ * kernel.  Each function is only declared when the option that builds it in
+ * tasks.c is set.  The options are described where tasks.c gives them their
+ * defaults.
+ */
+
+#ifndef INC_TASK_EXT_H
+#define INC_TASK_EXT_H
+
+#ifndef INC_TASK_H
+    #error "include task.h must appear in source files before include task_ext.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*-----------------------------------------------------------
+* PERIODIC TASKS
+*----------------------------------------------------------*/
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+/*
+ * Create a task released every uxPeriod ticks, from its first run, by its calls
+ * to vTaskDelayUntil().  Its deadline is the end of the period.
+ *
+ * With configUSE_EDF_SCHEDULER set uxPriority must be configEDF_PRIORITY_BAND,
+ * the task is scheduled by deadline inside that band.  Otherwise the task gets
+ * the priority of its rank among the periodic tasks and uxPriority is not used.
+ *
+ * No execution time is given, so it is taken as unknown (0).  The response
+ * time analysis of the fixed-priority scheduler then has no result for the task
+ * or for the tasks it can delay, see xTaskPeriodicGetResponseTime(), and the
+ * EDF partition analysis leaves the task out, see uxTaskPeriodicGetCore().  Use
+ * xTaskPeriodicCreateConstrained() for tasks whose execution time is measured.
+ */
+    BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
+                                    const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                    const configSTACK_DEPTH_TYPE usStackDepth,
+                                    void * const pvParameters,
+                                    UBaseType_t uxPriority,
+                                    TaskHandle_t * const pxCreatedTask,
+                                    TickType_t uxPeriod ) PRIVILEGED_FUNCTION;
+
+/*
+ * As xTaskPeriodicCreate(), with a relative deadline of 1 to uxPeriod ticks
+ * and a worst case execution time of up to xRelativeDeadline ticks, 0 if it is
+ * not known.
+ */
+    BaseType_t xTaskPeriodicCreateConstrained( TaskFunction_t pxTaskCode,
+                                               const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                               const configSTACK_DEPTH_TYPE usStackDepth,
+                                               void * const pvParameters,
+                                               UBaseType_t uxPriority,
+                                               TaskHandle_t * const pxCreatedTask,
+                                               TickType_t uxPeriod,
+                                               TickType_t xRelativeDeadline,
+                                               TickType_t xWCET ) PRIVILEGED_FUNCTION;
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_DEADLINES == 1 ) )
+
+/*
+ * As xTaskPeriodicCreateConstrained(), with the relative deadline given in
+ * portEDF_GET_DEADLINE_TIME() counts.
+ */
+        BaseType_t xTaskPeriodicCreateFine( TaskFunction_t pxTaskCode,
+                                            const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                            const configSTACK_DEPTH_TYPE usStackDepth,
+                                            void * const pvParameters,
+                                            UBaseType_t uxPriority,
+                                            TaskHandle_t * const pxCreatedTask,
+                                            TickType_t uxPeriod,
+                                            uint32_t ulRelativeDeadline,
+                                            TickType_t xWCET ) PRIVILEGED_FUNCTION;
+    #endif
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+/*
+ * The number of deadlines xTask has missed since it was created.
+ */
+UBaseType_t uxTaskPeriodicGetMisses( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * The periodic task at uxIndex in creation order, counting from 0, or NULL
+ * past the last one, to walk the periodic tasks without keeping their handles.
+ */
+TaskHandle_t xTaskPeriodicGetHandle( UBaseType_t uxIndex ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_EDF_SCHEDULER == 0 )
+
+/* The response time of a task that was not analysed. */
+    #define taskRESPONSE_TIME_UNKNOWN    ( ( TickType_t ) 0U )
+
+/*
+ * The worst case response time of xTask found by the response time analysis,
+ * in ticks, or portMAX_DELAY if the task can miss its deadline.  It is
+ * taskRESPONSE_TIME_UNKNOWN when xTask, or a periodic task of the same or a
+ * higher priority, was created without an execution time.
+ */
+    TickType_t xTaskPeriodicGetResponseTime( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) )
+
+/*
+ * The core the partition analysis placed xTask on, 0 to
+ * configEDF_NUMBER_OF_CORES - 1, or configEDF_NUMBER_OF_CORES if it is not
+ * placed.  The scheduler does not use it.
+ */
+    UBaseType_t uxTaskPeriodicGetCore( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * The density of the tasks the analysis placed on uxCore, in hundredths of a
+ * percent.
+ */
+    uint32_t ulTaskPeriodicGetCoreUtilisation( UBaseType_t uxCore ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+/*
+ * Write a table of the periodic tasks, their utilisation and their core to
+ * pcWriteBuffer.  With configEDF_SPLIT_TASK_ANALYSIS a task split by the
+ * analysis is listed with the core of each piece; the kernel does not split
+ * or migrate it.
+ */
+        void vTaskPeriodicPartitionList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    #endif
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) */
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOBS == 1 ) )
+
+/*
+ * Release pxJobCode( pvParameters ) every xPeriod ticks, each call due
+ * xRelativeDeadline ticks after its release.  The jobs run on the stack of a
+ * single server task, earliest deadline first, each to completion unless it
+ * calls vTaskPeriodicJobPreemptionPoint().  Releases skipped by
+ * configUSE_BULK_TICK_CATCH_UP are counted by uxTaskPeriodicGetMisses() of
+ * the server, the task named configEDF_JOB_SERVER_NAME.
+ */
+    BaseType_t xTaskPeriodicJobCreate( TaskFunction_t pxJobCode,
+                                       void * const pvParameters,
+                                       TickType_t xPeriod,
+                                       TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from a job at a point where it can be preempted.  Each released job
+ * with an earlier deadline than the calling job runs to completion, nested on
+ * the same stack, before this returns.
+ */
+    void vTaskPeriodicJobPreemptionPoint( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* MEASUREMENT
+*----------------------------------------------------------*/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+/*
+ * The time xTask has spent in the Running state, in run time counter counts.
+ */
+    configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_CPU_LOAD_WINDOWS == 1 )
+
+/*
+ * The CPU load in tenths of a percent over the last sample (uxWindow 0), the
+ * last configCPU_LOAD_WINDOW_SAMPLES samples (1) or the last
+ * configCPU_LOAD_WINDOW_SAMPLES blocks of them (2), and the share of the last
+ * sample periodic task xTask used.
+ */
+    UBaseType_t uxTaskGetCpuLoad( UBaseType_t uxWindow ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxTaskGetLoadShare( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+/*
+ * Move up to xBufferLength bytes of whole trace records to pvBuffer, oldest
+ * first, and return the number of bytes moved.  There can only be one reader.
+ */
+    size_t xTaskTraceRead( void * pvBuffer,
+                           size_t xBufferLength ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_JOB_HISTOGRAMS == 1 )
+
+/* The histograms ulTaskGetJobHistograms() returns, in this order. */
+    #define taskJOB_RESPONSE_TIME     0
+    #define taskJOB_LATENESS          1
+    #define taskJOB_RELEASE_JITTER    2
+    #define taskJOB_HISTOGRAMS        3
+
+/*
+ * Copy the taskJOB_HISTOGRAMS histograms of xTask, configJOB_HISTOGRAM_BUCKETS
+ * buckets each, to pulBuckets and the largest value of each to pulMax, then
+ * clear them if xReset is pdTRUE.  Either pointer can be NULL.  Returns the
+ * number of jobs counted.
+ */
+    uint32_t ulTaskGetJobHistograms( TaskHandle_t xTask,
+                                     uint32_t * pulBuckets,
+                                     uint32_t * pulMax,
+                                     BaseType_t xReset ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_STACK_REPORT == 1 )
+
+/*
+ * The deepest stack use of xTask, in words, with the depth it was created with
+ * returned through puxStackDepth.
+ */
+    UBaseType_t uxTaskGetStackUsage( TaskHandle_t xTask,
+                                     UBaseType_t * puxStackDepth ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_KERNEL_PROFILING == 1 )
+
+/* The parts of the kernel that are timed, the uxSection parameter of
+ * ulTaskGetSchedulerProfile(). */
+    #define taskPROFILE_TICK            0
+    #define taskPROFILE_SWITCH          1
+    #define taskPROFILE_READY_INSERT    2
+    #define taskPROFILE_CRITICAL        3
+    #define taskPROFILE_SECTIONS        4
+
+/*
+ * The minimum, average and maximum portPROFILE_GET_TIME() counts spent in
+ * uxSection, cleared if xReset is pdTRUE.  Returns the number of times timed.
+ */
+    uint32_t ulTaskGetSchedulerProfile( UBaseType_t uxSection,
+                                        uint32_t * pulMin,
+                                        uint32_t * pulAverage,
+                                        uint32_t * pulMax,
+                                        BaseType_t xReset ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_ISR_LATENCY == 1 )
+
+/*
+ * Called first thing and last thing by an interrupt handler whose latency to
+ * the task it wakes is measured, uxSource being 0 to
+ * configISR_LATENCY_SOURCES - 1.
+ */
+    void vTaskLatencyEnterISR( UBaseType_t uxSource ) PRIVILEGED_FUNCTION;
+    void vTaskLatencyExitISR( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * As ulTaskGetSchedulerProfile(), for the latency of uxSource.
+ */
+    uint32_t ulTaskGetISRLatency( UBaseType_t uxSource,
+                                  uint32_t * pulMin,
+                                  uint32_t * pulAverage,
+                                  uint32_t * pulMax,
+                                  BaseType_t xReset ) PRIVILEGED_FUNCTION;
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+#endif /* INC_TASK_EXT_H */
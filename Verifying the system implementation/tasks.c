@@ -38,6 +38,7 @@
 /* FreeRTOS includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "task_ext.h"
 #include "timers.h"
 #include "stack_macros.h"
 
@@ -115,6 +116,589 @@
     #define configIDLE_TASK_NAME    "IDLE"
 #endif
 
+/* When set to 1 the delayed tasks are kept in a hashed timing wheel instead of
+ * the two sorted delayed lists.  A task goes into the slot of its wake time
+ * modulo configDELAYED_TASK_WHEEL_SIZE in constant time, and the tick only looks
+ * at the slot of the current tick.  Slots are not sorted, a task delayed for
+ * more than one turn of the wheel stays in its slot until its turn comes.  A
+ * bitmap of the slots that hold tasks lets the search for the next wake time
+ * skip the empty ones 32 at a time. */
+#ifndef configUSE_DELAYED_TASK_WHEEL
+    #define configUSE_DELAYED_TASK_WHEEL    0
+#endif
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    #ifndef configDELAYED_TASK_WHEEL_SIZE
+        #define configDELAYED_TASK_WHEEL_SIZE    64
+    #endif
+
+    #if ( ( configDELAYED_TASK_WHEEL_SIZE < 2 ) || ( ( configDELAYED_TASK_WHEEL_SIZE & ( configDELAYED_TASK_WHEEL_SIZE - 1 ) ) != 0 ) )
+        #error configDELAYED_TASK_WHEEL_SIZE must be a power of 2
+    #endif
+
+    #define taskDELAYED_TASK_WHEEL_INDEX( xTime )    ( ( UBaseType_t ) ( ( xTime ) & ( ( TickType_t ) configDELAYED_TASK_WHEEL_SIZE - ( TickType_t ) 1U ) ) )
+    #define taskDELAYED_TASK_WHEEL_SLOT( xTime )     ( &( xDelayedTaskWheel[ taskDELAYED_TASK_WHEEL_INDEX( xTime ) ] ) )
+    #define taskDELAYED_TASK_WHEEL_MAP_WORDS         ( ( configDELAYED_TASK_WHEEL_SIZE + 31 ) / 32 )
+#endif
+
+/* When set to 1 the tick interrupt is one-shot instead of periodic.  At the end
+ * of each tick interrupt, and of each context switch, the kernel passes the
+ * port the current tick count and the number of ticks to the next tick at which
+ * it has work to do through portSET_NEXT_TICK_EVENT( xTickNow, xTicksToEvent ).
+ * portGET_ELAPSED_TICKS() returns the whole ticks that went by since the last
+ * call, never counting the tick of the programmed event, which the tick
+ * interrupt counts itself.  The kernel calls it with interrupts masked before
+ * it uses the tick count. */
+#ifndef configUSE_EVENT_DRIVEN_TICK
+    #define configUSE_EVENT_DRIVEN_TICK    0
+#endif
+
+#if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+    #if ( configUSE_TICKLESS_IDLE != 0 )
+        #error configUSE_TICKLESS_IDLE must be 0 when configUSE_EVENT_DRIVEN_TICK is 1, the tick is already suppressed whenever it is not needed
+    #endif
+
+    #ifndef portGET_ELAPSED_TICKS
+        #error portGET_ELAPSED_TICKS() must be defined to use configUSE_EVENT_DRIVEN_TICK
+    #endif
+
+    #ifndef portSET_NEXT_TICK_EVENT
+        #error portSET_NEXT_TICK_EVENT() must be defined to use configUSE_EVENT_DRIVEN_TICK
+    #endif
+
+/* Bring the tick count up to date with the ticks that went by since the last
+ * tick interrupt.  Interrupts must be masked.  While the scheduler is suspended
+ * the ticks are held pending, as they would have been by the tick interrupt. */
+    #define taskCATCH_UP_EVENT_TICKS()                                       \
+    {                                                                        \
+        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )                \
+        {                                                                    \
+            xTickCount += ( TickType_t ) portGET_ELAPSED_TICKS();            \
+        }                                                                    \
+        else                                                                 \
+        {                                                                    \
+            xPendedTicks += ( TickType_t ) portGET_ELAPSED_TICKS();          \
+        }                                                                    \
+    }
+
+/* Program the next tick interrupt.  The pended ticks are part of the time
+ * already gone only while the scheduler is suspended, xTaskResumeAll() unwinds
+ * them one tick at a time after it has resumed the scheduler. */
+    #define taskSET_NEXT_TICK_EVENT()                                                                      \
+    {                                                                                                      \
+        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )                                              \
+        {                                                                                                  \
+            portSET_NEXT_TICK_EVENT( xTickCount, prvGetTicksToNextEvent() );                               \
+        }                                                                                                  \
+        else                                                                                               \
+        {                                                                                                  \
+            portSET_NEXT_TICK_EVENT( xTickCount + xPendedTicks, ( TickType_t ) 1U );                       \
+        }                                                                                                  \
+    }
+#else
+    #define taskCATCH_UP_EVENT_TICKS()
+#endif
+
+/* When set to 1 xTaskResumeAll(), and so xTaskCatchUpTicks(), count the ticks
+ * that went by while the scheduler was suspended in as few steps as possible:
+ * the ticks at which nothing is due are added in one go and only the others go
+ * through xTaskIncrementTick().  A periodic task waiting in xTaskDelayUntil()
+ * whose releases fell behind is released once, at the last release before the
+ * end of those ticks, and the releases it skipped are counted as deadline
+ * misses.  The same holds for the jobs of xTaskPeriodicJobCreate(), whose
+ * skipped releases are counted as misses of the job server. */
+#ifndef configUSE_BULK_TICK_CATCH_UP
+    #define configUSE_BULK_TICK_CATCH_UP    0
+#endif
+
+/* When set to 1 the tick interrupt samples the run time stats counter every
+ * configCPU_LOAD_SAMPLE_TICKS ticks and keeps the CPU load over three sliding
+ * windows: the last sample, the last configCPU_LOAD_WINDOW_SAMPLES samples and
+ * the last configCPU_LOAD_WINDOW_SAMPLES blocks of that many samples - 100 ms,
+ * 1 s and 10 s with the defaults and a 1 kHz tick.  The share of each periodic
+ * task over the last sample is kept too.  Loads are in tenths of a percent and
+ * only integer arithmetic is used. */
+#ifndef configUSE_CPU_LOAD_WINDOWS
+    #define configUSE_CPU_LOAD_WINDOWS    0
+#endif
+
+#ifndef configCPU_LOAD_SAMPLE_TICKS
+    #define configCPU_LOAD_SAMPLE_TICKS    ( ( TickType_t ) 100U )
+#endif
+
+#ifndef configCPU_LOAD_WINDOW_SAMPLES
+    #define configCPU_LOAD_WINDOW_SAMPLES    10
+#endif
+
+#if ( configUSE_CPU_LOAD_WINDOWS == 1 )
+    #if ( configGENERATE_RUN_TIME_STATS == 0 )
+        #error configGENERATE_RUN_TIME_STATS must be set to 1 to use configUSE_CPU_LOAD_WINDOWS
+    #endif
+
+    #if ( configCPU_LOAD_WINDOW_SAMPLES < 2 )
+        #error configCPU_LOAD_WINDOW_SAMPLES must be at least 2
+    #endif
+
+/* The windows uxTaskGetCpuLoad() reports on, and the value of a fully loaded
+ * window. */
+    #define taskLOAD_WINDOWS       ( ( UBaseType_t ) 3U )
+    #define taskLOAD_FULL_SCALE    ( ( configRUN_TIME_COUNTER_TYPE ) 1000U )
+#endif
+
+/* When set to 1 the kernel writes its scheduling events - switches, releases
+ * and their deadlines, blocks and deadline misses - into a ring buffer of
+ * configTRACE_RECORDER_RECORDS 8 byte records stamped with
+ * portTRACE_GET_TIME().  xTaskTraceRead() takes them out, for example from a
+ * low priority task that streams them to a host.  The records are written both
+ * from the tick interrupt and at task level, always with interrupts masked.
+ * The reader is never locked out, so a full buffer drops records and the number
+ * dropped is recorded once there is room again. */
+#ifndef configUSE_TRACE_RECORDER
+    #define configUSE_TRACE_RECORDER    0
+#endif
+
+#ifndef configTRACE_RECORDER_RECORDS
+    #define configTRACE_RECORDER_RECORDS    128
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+    #if ( ( configTRACE_RECORDER_RECORDS & ( configTRACE_RECORDER_RECORDS - 1 ) ) != 0 )
+        #error configTRACE_RECORDER_RECORDS must be a power of 2
+    #endif
+
+/* The records are stamped with the run time stats counter unless the port
+ * provides another free running timer. */
+    #ifndef portTRACE_GET_TIME
+        #if ( configGENERATE_RUN_TIME_STATS == 0 )
+            #error portTRACE_GET_TIME() must be defined to use configUSE_TRACE_RECORDER without configGENERATE_RUN_TIME_STATS
+        #endif
+        #define portTRACE_GET_TIME()    ( ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE() )
+    #endif
+
+/* The record types.  The 16 bit data of each one is:
+ * SWITCH_IN, SWITCH_OUT - the low 16 bits of the tick count.
+ * RELEASE - the low 16 bits of the release tick of the job.
+ * DEADLINE - the relative deadline of the job just released, in ticks.  The
+ *     absolute deadline tick is held in place of the time, the value the EDF
+ *     ready list orders the job by.
+ * DEADLINE_TIME - as DEADLINE, written instead of it when
+ *     configUSE_EDF_FINE_DEADLINES is 1.  The absolute deadline held in place
+ *     of the time is in portEDF_GET_DEADLINE_TIME() counts.
+ * BLOCK - the ticks the task blocks for, 0xFFFF for longer or for ever.
+ * MISS - the deadline misses just counted.
+ * CREATE - the priority of the task.
+ * NAME - the offset of the four name characters held in place of the time.
+ * OVERFLOW - the records dropped, the task is 0. */
+    #define taskTRACE_SWITCH_IN     ( ( uint8_t ) 1U )
+    #define taskTRACE_SWITCH_OUT    ( ( uint8_t ) 2U )
+    #define taskTRACE_RELEASE       ( ( uint8_t ) 3U )
+    #define taskTRACE_DEADLINE      ( ( uint8_t ) 4U )
+    #define taskTRACE_BLOCK         ( ( uint8_t ) 5U )
+    #define taskTRACE_MISS          ( ( uint8_t ) 6U )
+    #define taskTRACE_CREATE        ( ( uint8_t ) 7U )
+    #define taskTRACE_NAME          ( ( uint8_t ) 8U )
+    #define taskTRACE_OVERFLOW      ( ( uint8_t ) 9U )
+    #define taskTRACE_DEADLINE_TIME ( ( uint8_t ) 10U )
+
+    #define taskTRACE_RECORD( ucEvent, pxTCB, ulData )                  prvTraceRecord( ( ucEvent ), ( pxTCB ), ( uint32_t ) ( ulData ) )
+    #define taskTRACE_RECORD_VALUE( ucEvent, pxTCB, ulValue, ulData )    prvTraceRecordValue( ( ucEvent ), ( pxTCB ), ( uint32_t ) ( ulValue ), ( uint32_t ) ( ulData ) )
+#else
+    #define taskTRACE_RECORD( ucEvent, pxTCB, ulData )
+    #define taskTRACE_RECORD_VALUE( ucEvent, pxTCB, ulValue, ulData )
+#endif
+
+/* When set to 1 every job of a periodic task is timed on the run time stats
+ * counter, from the tick that releases it to its xTaskDelayUntil() call, and
+ * three histograms are kept in its TCB: response time, lateness past the
+ * deadline and release jitter (release to first switch in).  Bucket 0 counts
+ * 0 (a job on time for lateness), bucket n counts values from 2^(n-1) up to
+ * 2^n - 1 and the last bucket everything above.  ulTaskGetJobHistograms()
+ * reads, and can reset, them.  configRUN_TIME_COUNTER_HZ is the counter rate,
+ * needed to place the deadline. */
+#ifndef configUSE_JOB_HISTOGRAMS
+    #define configUSE_JOB_HISTOGRAMS    0
+#endif
+
+#ifndef configJOB_HISTOGRAM_BUCKETS
+    #define configJOB_HISTOGRAM_BUCKETS    16
+#endif
+
+#if ( configUSE_JOB_HISTOGRAMS == 1 )
+    #if ( configGENERATE_RUN_TIME_STATS == 0 )
+        #error configGENERATE_RUN_TIME_STATS must be set to 1 to use configUSE_JOB_HISTOGRAMS
+    #endif
+
+    #ifndef configRUN_TIME_COUNTER_HZ
+        #error configRUN_TIME_COUNTER_HZ must be defined to use configUSE_JOB_HISTOGRAMS
+    #endif
+
+    #if ( ( configJOB_HISTOGRAM_BUCKETS < 2 ) || ( configJOB_HISTOGRAM_BUCKETS > 33 ) )
+        #error configJOB_HISTOGRAM_BUCKETS must be between 2 and 33
+    #endif
+
+/* Start timing a new job of the periodic task pxTCB. */
+    #define taskJOB_STATS_RELEASE( pxTCB )                                           \
+    {                                                                                \
+        ( pxTCB )->ulJobReleaseTime = ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE(); \
+        ( pxTCB )->xJobStarted = pdFALSE;                                            \
+    }
+#else
+    #define taskJOB_STATS_RELEASE( pxTCB )
+#endif
+
+/* When set to 1 the number of the task switched in is put on output pins by
+ * portGPIO_TRACE_TASK(), 0 for the idle task and the others numbered from 1 in
+ * creation order.  portGPIO_TRACE_RELEASE() and portGPIO_TRACE_MISS() mark
+ * each job release and each deadline miss, for example with a pulse on a pin.
+ * A logic analyser on those pins then captures the whole schedule.  The macros
+ * run in the tick and the context switch, so they should only write set and
+ * clear registers, never read-modify-write a port another context drives. */
+#ifndef configUSE_GPIO_TASK_TRACE
+    #define configUSE_GPIO_TASK_TRACE    0
+#endif
+
+#if ( configUSE_GPIO_TASK_TRACE == 1 )
+    #ifndef portGPIO_TRACE_TASK
+        #error portGPIO_TRACE_TASK() must be defined to use configUSE_GPIO_TASK_TRACE
+    #endif
+
+    #define taskGPIO_TRACE_TASK( pxTCB )    portGPIO_TRACE_TASK( ( ( pxTCB ) == xIdleTaskHandle ) ? ( UBaseType_t ) 0U : ( pxTCB )->uxTCBNumber )
+#else
+    #define taskGPIO_TRACE_TASK( pxTCB )
+#endif
+
+#ifndef portGPIO_TRACE_RELEASE
+    #define portGPIO_TRACE_RELEASE()
+#endif
+
+#ifndef portGPIO_TRACE_MISS
+    #define portGPIO_TRACE_MISS()
+#endif
+
+/* The deadline record of a job released at xReleaseTime.  Under EDF it holds
+ * the deadline the kernel gave the job, so it must follow taskEDF_SET_RELEASE().
+ * The fixed priority scheduler keeps no deadline, the record holds the one
+ * xTaskDelayUntil() judges the job by. */
+#if ( configUSE_EDF_SCHEDULER == 0 )
+    #define taskTRACE_JOB_DEADLINE( pxTCB, xReleaseTime ) \
+    taskTRACE_RECORD_VALUE( taskTRACE_DEADLINE, ( pxTCB ), ( xReleaseTime ) + ( pxTCB )->xTaskRelativeDeadline, ( pxTCB )->xTaskRelativeDeadline )
+#elif ( configUSE_EDF_FINE_DEADLINES == 1 )
+    #define taskTRACE_JOB_DEADLINE( pxTCB, xReleaseTime ) \
+    taskTRACE_RECORD_VALUE( taskTRACE_DEADLINE_TIME, ( pxTCB ), ( pxTCB )->ulTaskAbsoluteDeadline, ( pxTCB )->xTaskRelativeDeadline )
+#else
+    #define taskTRACE_JOB_DEADLINE( pxTCB, xReleaseTime ) \
+    taskTRACE_RECORD_VALUE( taskTRACE_DEADLINE, ( pxTCB ), listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) ), ( pxTCB )->xTaskRelativeDeadline )
+#endif
+
+/* A periodic task leaving the Blocked state starts a new job, released at
+ * xReleaseTime. */
+#define taskJOB_RELEASED( pxTCB, xReleaseTime )                                                  \
+    {                                                                                            \
+        if( ( pxTCB )->xTaskPeriod != ( TickType_t ) 0U )                                        \
+        {                                                                                        \
+            taskTRACE_RECORD( taskTRACE_RELEASE, ( pxTCB ), ( xReleaseTime ) & 0xFFFFU );        \
+            taskTRACE_JOB_DEADLINE( ( pxTCB ), ( xReleaseTime ) );                               \
+            taskJOB_STATS_RELEASE( pxTCB );                                                      \
+            portGPIO_TRACE_RELEASE();                                                            \
+        }                                                                                        \
+    }
+
+/* uxMisses deadlines of pxTCB have just been counted as missed. */
+#define taskDEADLINES_MISSED( pxTCB, uxMisses )                     \
+    {                                                               \
+        taskTRACE_RECORD( taskTRACE_MISS, ( pxTCB ), ( uxMisses ) ); \
+        portGPIO_TRACE_MISS();                                      \
+    }
+
+/* When set to 1 the depth each task was created with is kept in its TCB, so
+ * uxTaskGetStackUsage() can tell how much of it the task has used at most and
+ * the stacks can be sized from a run of the application. */
+#ifndef configUSE_STACK_REPORT
+    #define configUSE_STACK_REPORT    0
+#endif
+
+#if ( ( configUSE_STACK_REPORT == 1 ) && ( INCLUDE_uxTaskGetStackHighWaterMark != 1 ) )
+    #error INCLUDE_uxTaskGetStackHighWaterMark must be set to 1 to use configUSE_STACK_REPORT
+#endif
+
+/* When set to 1 the kernel times its own overhead on portPROFILE_GET_TIME(), a
+ * free running 32 bit counter, ideally at the CPU clock: xTaskIncrementTick(),
+ * vTaskSwitchContext(), each insert into a ready list and each critical section
+ * of this file, from the outermost taskENTER_CRITICAL() to its
+ * taskEXIT_CRITICAL() less the time other tasks ran in between.
+ * ulTaskGetSchedulerProfile() returns the count, minimum, average and maximum
+ * of each.  The figures include one read of the counter. */
+#ifndef configUSE_KERNEL_PROFILING
+    #define configUSE_KERNEL_PROFILING    0
+#endif
+
+#if ( configUSE_KERNEL_PROFILING == 1 )
+    #ifndef portPROFILE_GET_TIME
+        #error portPROFILE_GET_TIME() must be defined to use configUSE_KERNEL_PROFILING
+    #endif
+
+/* The timed parts do not nest in themselves and run with interrupts masked, so
+ * one start time each is enough. */
+    #define taskPROFILE_START( uxSection )    ulProfileStart[ ( uxSection ) ] = portPROFILE_GET_TIME()
+    #define taskPROFILE_END( uxSection )      prvProfileAdd( &( xProfileStats[ ( uxSection ) ] ), portPROFILE_GET_TIME() - ulProfileStart[ ( uxSection ) ] )
+
+    #undef taskENTER_CRITICAL
+    #undef taskEXIT_CRITICAL
+    #define taskENTER_CRITICAL()    { portENTER_CRITICAL(); prvProfileCriticalEnter(); }
+    #define taskEXIT_CRITICAL()     { prvProfileCriticalExit(); portEXIT_CRITICAL(); }
+#else
+    #define taskPROFILE_START( uxSection )
+    #define taskPROFILE_END( uxSection )
+#endif
+
+/* When set to 1 the time from an interrupt to the first run of the task it
+ * wakes is measured on portLATENCY_GET_TIME(), a free running 32 bit counter.
+ * The interrupt calls vTaskLatencyEnterISR() with its source, 0 to
+ * configISR_LATENCY_SOURCES - 1, as it starts and vTaskLatencyExitISR() before
+ * it returns.  A task unblocked in between by a give or send from the ISR, a
+ * notification from the ISR or xTaskResumeFromISR() is stamped with the source
+ * and the entry time, and the latency is counted against the source when the
+ * task is next switched in.  A task woken again before it runs keeps the first
+ * stamp.  ulTaskGetISRLatency() returns the count, minimum, average and maximum
+ * for each source.  Interrupts must not nest. */
+#ifndef configUSE_ISR_LATENCY
+    #define configUSE_ISR_LATENCY    0
+#endif
+
+#ifndef configISR_LATENCY_SOURCES
+    #define configISR_LATENCY_SOURCES    4
+#endif
+
+#if ( configUSE_ISR_LATENCY == 1 )
+    #ifndef portLATENCY_GET_TIME
+        #error portLATENCY_GET_TIME() must be defined to use configUSE_ISR_LATENCY
+    #endif
+
+/* uxLatencySource is the source of the running ISR plus 1, 0 outside one. */
+    #define taskLATENCY_WOKEN( pxTCB )                                                                          \
+    {                                                                                                           \
+        if( ( uxLatencySource != ( UBaseType_t ) 0U ) && ( ( pxTCB )->uxLatencySource == ( UBaseType_t ) 0U ) ) \
+        {                                                                                                       \
+            ( pxTCB )->uxLatencySource = uxLatencySource;                                                       \
+            ( pxTCB )->ulLatencyStart = ulLatencyStart;                                                         \
+        }                                                                                                       \
+    }
+#else
+    #define taskLATENCY_WOKEN( pxTCB )
+#endif
+
+/* How EDF orders two ready tasks that have the same absolute deadline.  With
+ * FIFO the task that became ready first runs first and a task never preempts
+ * another one that has the same deadline.  The other policies run the task with
+ * the shorter period, or the task created first, and may preempt on a tie. */
+#define taskEDF_TIE_BREAK_FIFO               0
+#define taskEDF_TIE_BREAK_SHORTEST_PERIOD    1
+#define taskEDF_TIE_BREAK_LOWEST_ID          2
+
+#ifndef configEDF_TIE_BREAK
+    #define configEDF_TIE_BREAK    taskEDF_TIE_BREAK_FIFO
+#endif
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+/* The priority whose ready list is kept in deadline order.  Tasks created at
+ * any other priority are scheduled by fixed priority as normal, so a band above
+ * configEDF_PRIORITY_BAND always preempts the EDF tasks and a band below it only
+ * runs when no EDF task is ready.  This can be overridden by defining
+ * configEDF_PRIORITY_BAND in FreeRTOSConfig.h. */
+    #ifndef configEDF_PRIORITY_BAND
+        #define configEDF_PRIORITY_BAND    1
+    #endif
+
+    #if ( configEDF_PRIORITY_BAND >= configMAX_PRIORITIES )
+        #error configEDF_PRIORITY_BAND must be less than configMAX_PRIORITIES
+    #endif
+
+/* The idle task runs below the EDF band, so it is only selected once the EDF
+ * ready list is empty and never takes part in a deadline comparison. */
+    #if ( configEDF_PRIORITY_BAND < 1 )
+        #error configEDF_PRIORITY_BAND must be above the idle priority
+    #endif
+
+/* When set to 1 the periodic task set is analysed for
+ * configEDF_NUMBER_OF_CORES cores.  This is an analysis only: the kernel runs
+ * on one core with one EDF ready list, and the scheduler never reads the core
+ * given to a task.  Each core is a separate EDF system whose utilisation (or
+ * density when the deadline is shorter than the period) may not exceed one.
+ * The partition is made by first fit or worst fit over the tasks in decreasing
+ * utilisation order when the scheduler starts, and tasks created later are
+ * placed as they come.  A task set that does not fit fails a configASSERT() in
+ * vTaskStartScheduler(), and a task created later that does not fit is not
+ * created.  With one core, the default, this is the EDF admission test of this
+ * kernel.  With more it tells how the task set would be placed on a multicore
+ * target, and no longer protects this one.  Global EDF is not offered: with
+ * one EDF ready list on one core there is nothing to migrate between, and an
+ * admission test alone would admit task sets that nothing schedules that way.
+ *
+ * A periodic task created without an execution time, by xTaskPeriodicCreate(),
+ * is left out of the analysis and placed on no core. */
+    #ifndef configUSE_EDF_PARTITION_ANALYSIS
+        #define configUSE_EDF_PARTITION_ANALYSIS    0
+    #endif
+
+    #define taskEDF_FIRST_FIT_DECREASING    1
+    #define taskEDF_WORST_FIT_DECREASING    2
+
+    #ifndef configEDF_NUMBER_OF_CORES
+        #define configEDF_NUMBER_OF_CORES    1
+    #endif
+
+    #ifndef configEDF_PARTITIONING
+        #define configEDF_PARTITIONING    taskEDF_FIRST_FIT_DECREASING
+    #endif
+
+/* When set to 1 the partition analysis splits a task that fits on no single
+ * core when the scheduler starts over two cores with the C=D scheme.  Each job
+ * would run a first piece of xTaskSplitBudget ticks on uxTaskCore with a
+ * deadline equal to that budget, so the piece runs as soon as the job is
+ * released, then migrate to uxTaskSplitCore for the rest of its execution time
+ * with the rest of its deadline.  Both cores are checked with the exact
+ * processor demand test, as the density bound cannot admit such a piece.
+ *
+ * This is an analysis only, like the partition: the kernel never migrates a
+ * job and runs the whole task on its one core.  It needs at least two cores,
+ * and so only tells how the task set could be placed on a multicore target. */
+    #ifndef configEDF_SPLIT_TASK_ANALYSIS
+        #define configEDF_SPLIT_TASK_ANALYSIS    0
+    #endif
+
+    #if ( configEDF_SPLIT_TASK_ANALYSIS == 1 )
+        #if ( configUSE_EDF_PARTITION_ANALYSIS == 0 )
+            #error configEDF_SPLIT_TASK_ANALYSIS needs configUSE_EDF_PARTITION_ANALYSIS
+        #endif
+
+        #if ( configEDF_NUMBER_OF_CORES < 2 )
+            #error configEDF_SPLIT_TASK_ANALYSIS needs configEDF_NUMBER_OF_CORES to be at least 2
+        #endif
+    #endif
+
+/* When set to 1 xTaskPeriodicJobCreate() is available.  A job is a function
+ * called once per release that runs to completion without blocking.  All the
+ * jobs share one server task, and so one stack, which takes the deadline of the
+ * job it runs and is suspended while no job is released.  A job that calls
+ * vTaskPeriodicJobPreemptionPoint() lets the released jobs with earlier
+ * deadlines run nested on that stack. */
+    #ifndef configUSE_EDF_JOBS
+        #define configUSE_EDF_JOBS    0
+    #endif
+
+    #if ( configUSE_EDF_JOBS == 1 )
+        #if ( INCLUDE_vTaskSuspend != 1 )
+            #error INCLUDE_vTaskSuspend must be set to 1 to use configUSE_EDF_JOBS
+        #endif
+
+        #if ( configSUPPORT_DYNAMIC_ALLOCATION != 1 )
+            #error configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 to use configUSE_EDF_JOBS
+        #endif
+
+/* The shared stack has to hold the deepest chain of jobs nested at their
+ * preemption points, at most one job per distinct relative deadline. */
+        #ifndef configEDF_JOB_STACK_SIZE
+            #define configEDF_JOB_STACK_SIZE    configMINIMAL_STACK_SIZE
+        #endif
+
+        #ifndef configEDF_JOB_SERVER_NAME
+            #define configEDF_JOB_SERVER_NAME    "JOBS"
+        #endif
+    #endif /* configUSE_EDF_JOBS */
+
+/* When set to 1 a periodic task of the EDF band that calls xTaskDelayUntil()
+ * waits in a release queue, ordered by release time, instead of in the delayed
+ * list.  The tick moves every task released at that tick straight to the EDF
+ * ready list with its deadline, in one merge, and makes one preemption decision
+ * for the whole batch.  Going into the queue is still an ordered walk of the
+ * waiting tasks, as going into the delayed list is.  host/run.sh checks that
+ * the schedules are the same as without the queue. */
+    #ifndef configUSE_EDF_RELEASE_QUEUE
+        #define configUSE_EDF_RELEASE_QUEUE    0
+    #endif
+
+    #if ( ( configUSE_EDF_RELEASE_QUEUE == 1 ) && ( INCLUDE_xTaskDelayUntil != 1 ) )
+        #error INCLUDE_xTaskDelayUntil must be set to 1 to use configUSE_EDF_RELEASE_QUEUE
+    #endif
+
+/* When set to 1 the absolute deadlines of the EDF band are kept in the counts of
+ * a free running timer, read through portEDF_GET_DEADLINE_TIME(), instead of in
+ * ticks.  Tasks are still released by the tick, but a deadline is the timer
+ * count at the release tick plus a relative deadline in counts, so tasks whose
+ * deadlines fall in the same tick still run in true deadline order.
+ * configEDF_DEADLINE_TIMER_HZ is the count rate, used to convert deadlines given
+ * in ticks.  Deadlines may wrap, but must stay less than half the timer range
+ * apart. */
+    #ifndef configUSE_EDF_FINE_DEADLINES
+        #define configUSE_EDF_FINE_DEADLINES    0
+    #endif
+
+    #if ( configUSE_EDF_FINE_DEADLINES == 1 )
+        #ifndef portEDF_GET_DEADLINE_TIME
+            #error portEDF_GET_DEADLINE_TIME() must be defined to use configUSE_EDF_FINE_DEADLINES
+        #endif
+
+        #ifndef configEDF_DEADLINE_TIMER_HZ
+            #error configEDF_DEADLINE_TIMER_HZ must be defined to use configUSE_EDF_FINE_DEADLINES
+        #endif
+
+        #define taskEDF_TICKS_TO_COUNTS( xTicks )    ( ( uint32_t ) ( ( ( uint64_t ) ( xTicks ) * ( uint64_t ) configEDF_DEADLINE_TIMER_HZ ) / ( uint64_t ) configTICK_RATE_HZ ) )
+        #define taskEDF_COUNTS_TO_TICKS( ulCounts )  ( ( TickType_t ) ( ( ( uint64_t ) ( ulCounts ) * ( uint64_t ) configTICK_RATE_HZ ) / ( uint64_t ) configEDF_DEADLINE_TIMER_HZ ) )
+    #endif
+
+/* The core of a task that is not placed on any core, and the split core of a
+ * task that is not split. */
+    #define taskEDF_NO_CORE      ( ( UBaseType_t ) configEDF_NUMBER_OF_CORES )
+    #define taskEDF_NOT_SPLIT    ( ( UBaseType_t ) configEDF_NUMBER_OF_CORES )
+
+/* Utilisations are kept in units of 1/10000 of a core, rounded up so the sums
+ * are never below the exact ones and the analysis cannot admit too much. */
+    #define taskEDF_FULL_UTILISATION    ( ( uint32_t ) 10000UL )
+    #define taskEDF_UTILISATION( xWCET, xRelativeDeadline ) \
+    ( ( uint32_t ) ( ( ( ( uint32_t ) ( xWCET ) * taskEDF_FULL_UTILISATION ) + ( uint32_t ) ( xRelativeDeadline ) - ( uint32_t ) 1U ) / ( uint32_t ) ( xRelativeDeadline ) ) )
+
+/* Inside the EDF band the head of the ready list holds the earliest deadline,
+ * every other band keeps the usual round robin between equal priority tasks. */
+    #define taskSELECT_FROM_READY_LIST( uxPriority )                                                \
+    {                                                                                               \
+        if( ( uxPriority ) == configEDF_PRIORITY_BAND )                                             \
+        {                                                                                           \
+            pxCurrentTCB = listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyTasksLists[ ( uxPriority ) ] ) ); \
+        }                                                                                           \
+        else                                                                                        \
+        {                                                                                           \
+            listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ ( uxPriority ) ] ) );  \
+        }                                                                                           \
+    } /* taskSELECT_FROM_READY_LIST */
+
+#else /* configUSE_EDF_SCHEDULER */
+
+    #define taskSELECT_FROM_READY_LIST( uxPriority )    listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ ( uxPriority ) ] ) )
+
+/* Without EDF the priorities of periodic tasks are assigned automatically,
+ * either rate monotonic (shorter period = higher priority) or deadline
+ * monotonic (shorter relative deadline = higher priority). */
+    #define taskPERIODIC_RATE_MONOTONIC        1
+    #define taskPERIODIC_DEADLINE_MONOTONIC    2
+
+    #ifndef configPERIODIC_PRIORITY_ASSIGNMENT
+        #define configPERIODIC_PRIORITY_ASSIGNMENT    taskPERIODIC_RATE_MONOTONIC
+    #endif
+
+/* The highest priority the assignment hands out.  Priorities above it are left
+ * free for application tasks that must preempt every periodic task. */
+    #ifndef configPERIODIC_MAX_PRIORITY
+        #define configPERIODIC_MAX_PRIORITY    ( configMAX_PRIORITIES - 1 )
+    #endif
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+/* The number of periodic tasks that can exist at the same time. */
+#ifndef configMAX_PERIODIC_TASKS
+    #define configMAX_PERIODIC_TASKS    10
+#endif
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -146,7 +730,7 @@
                                                                               \
         /* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of \
          * the  same priority get an equal share of the processor time. */                    \
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) ); \
+        taskSELECT_FROM_READY_LIST( uxTopPriority );                                          \
         uxTopReadyPriority = uxTopPriority;                                                   \
     } /* taskSELECT_HIGHEST_PRIORITY_TASK */
 
@@ -176,7 +760,7 @@
         /* Find the highest priority list that contains ready tasks. */                         \
         portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );                          \
         configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 ); \
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );   \
+        taskSELECT_FROM_READY_LIST( uxTopPriority );                                            \
     } /* taskSELECT_HIGHEST_PRIORITY_TASK() */
 
 /*-----------------------------------------------------------*/
@@ -196,6 +780,18 @@
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/* The wheel keeps the tasks delayed past an overflow in the same slots, so only
+ * xNextTaskUnblockTime, which leaves them out until the overflow, changes. */
+    #define taskSWITCH_DELAYED_LISTS() \
+    {                                  \
+        xNumOfOverflows++;             \
+        prvResetNextTaskUnblockTime(); \
+    }
+
+#else
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
  * count overflows. */
 #define taskSWITCH_DELAYED_LISTS()                                                \
@@ -212,6 +808,27 @@
         prvResetNextTaskUnblockTime();                                            \
     }
 
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+
+/* pxReleaseList and pxOverflowReleaseList are switched with the delayed
+ * lists. */
+    #define taskSWITCH_RELEASE_LISTS()                                        \
+    {                                                                         \
+        List_t * pxTemp;                                                      \
+                                                                              \
+        /* Every release before the overflow has been made by now. */         \
+        configASSERT( ( listLIST_IS_EMPTY( pxReleaseList ) ) );               \
+                                                                              \
+        pxTemp = pxReleaseList;                                               \
+        pxReleaseList = pxOverflowReleaseList;                                \
+        pxOverflowReleaseList = pxTemp;                                       \
+        prvResetNextReleaseTime();                                            \
+    }
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -223,16 +840,108 @@
 /*prvAddTaskToReadyList() method that adds a task to the Ready List is then modified*/
 #if configUSE_EDF_SCHEDULER == 0 
 #define prvAddTaskToReadyList( pxTCB )                                                                \
+		taskPROFILE_START( taskPROFILE_READY_INSERT );                                                     \
 		traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
 		taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
 		listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
-		tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+		tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                      \
+		taskPROFILE_END( taskPROFILE_READY_INSERT )
 		
 #else 
 #define prvAddTaskToReadyList( pxTCB ) /*xGenericListIteam must contain the deadline value */ \
+		taskPROFILE_START( taskPROFILE_READY_INSERT );															\
 		traceMOVED_TASK_TO_READY_STATE( pxTCB );																\
-		vListInsert( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) );										\
-		tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+		taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );														\
+		if( ( pxTCB )->uxPriority == configEDF_PRIORITY_BAND )													\
+		{																										\
+			prvInsertEDFReady( pxTCB );																			\
+		}																										\
+		else																									\
+		{																										\
+			listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) );	\
+		}																										\
+		tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );															\
+		taskPROFILE_END( taskPROFILE_READY_INSERT )
+
+/* pdTRUE if the EDF task pxA goes ahead of the EDF task pxB: its deadline is
+ * earlier, or it is the same and configEDF_TIE_BREAK prefers pxA. */
+#if ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_FIFO )
+	#define taskEDF_TIE_BREAK( pxA, pxB )    pdFALSE
+#elif ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_SHORTEST_PERIOD )
+	#define taskEDF_TIE_BREAK( pxA, pxB )    ( ( pxA )->xTaskPeriod < ( pxB )->xTaskPeriod )
+#elif ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_LOWEST_ID )
+	#define taskEDF_TIE_BREAK( pxA, pxB )    ( ( pxA )->uxTCBNumber < ( pxB )->uxTCBNumber )
+#else
+	#error configEDF_TIE_BREAK must be one of the taskEDF_TIE_BREAK_ values
+#endif
+
+/* pdTRUE if the tick deadline xA comes before xB.  The difference is taken so
+ * that deadlines keep their order when the tick count wraps. */
+#define taskEDF_TICK_BEFORE( xA, xB )    ( ( TickType_t ) ( ( xA ) - ( xB ) ) > ( portMAX_DELAY >> 1 ) )
+
+/* The deadline the EDF ready list is ordered by, the deadline of each job
+ * relative to its release, and how a release sets the deadline. */
+#if ( configUSE_EDF_FINE_DEADLINES == 1 )
+	#define taskEDF_DEADLINE( pxTCB )                   ( ( pxTCB )->ulTaskAbsoluteDeadline )
+	#define taskEDF_DEADLINE_BEFORE( ulA, ulB )         ( ( uint32_t ) ( ( ulA ) - ( ulB ) ) > ( uint32_t ) 0x7FFFFFFFUL )
+	#define taskEDF_RELATIVE_DEADLINE( pxTCB )          ( ( pxTCB )->ulTaskRelativeDeadline )
+	#define taskEDF_SET_DEADLINE( pxTCB, xDeadline )																\
+	{																											\
+		const TickType_t xJobDeadline = ( xDeadline );															\
+		( pxTCB )->ulTaskAbsoluteDeadline = prvEDFTickToTime( xJobDeadline );									\
+		listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), xJobDeadline );								\
+	}
+	#define taskEDF_SET_RELEASE( pxTCB, xReleaseTime )																\
+	{																											\
+		const TickType_t xRelease = ( xReleaseTime );															\
+		( pxTCB )->ulTaskAbsoluteDeadline = prvEDFTickToTime( xRelease ) + ( pxTCB )->ulTaskRelativeDeadline;	\
+		listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), xRelease + ( pxTCB )->xTaskRelativeDeadline );	\
+	}
+#else
+	#define taskEDF_DEADLINE( pxTCB )                   listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) )
+	#define taskEDF_DEADLINE_BEFORE( xA, xB )           taskEDF_TICK_BEFORE( xA, xB )
+	#define taskEDF_RELATIVE_DEADLINE( pxTCB )          ( ( pxTCB )->xTaskRelativeDeadline )
+	#define taskEDF_SET_DEADLINE( pxTCB, xDeadline )    listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( xDeadline ) )
+	#define taskEDF_SET_RELEASE( pxTCB, xReleaseTime )																\
+		listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( xReleaseTime ) + ( pxTCB )->xTaskRelativeDeadline )
+#endif
+
+/* A task without a period has no deadline.  If it is created in the EDF band it
+ * runs after every task that has one, in FIFO order with the other tasks that
+ * have none.  The job server has no period, but runs at the deadline of a job
+ * once the tick has given it one. */
+#if ( configUSE_EDF_JOBS == 1 )
+	#define taskEDF_HAS_DEADLINE( pxTCB )																		\
+		( ( ( pxTCB )->xTaskPeriod != ( TickType_t ) 0U ) ||													\
+		  ( ( ( pxTCB ) == xJobServerHandle ) && ( xJobServerHasDeadline != pdFALSE ) ) )
+#else
+	#define taskEDF_HAS_DEADLINE( pxTCB )    ( ( pxTCB )->xTaskPeriod != ( TickType_t ) 0U )
+#endif
+
+#define taskEDF_RUNS_BEFORE( pxA, pxB )																			\
+		( ( taskEDF_HAS_DEADLINE( pxA ) ) &&																	\
+		  ( ( !( taskEDF_HAS_DEADLINE( pxB ) ) ) ||																\
+		    ( taskEDF_DEADLINE_BEFORE( taskEDF_DEADLINE( pxA ), taskEDF_DEADLINE( pxB ) ) ) ||					\
+		    ( ( taskEDF_DEADLINE( pxA ) == taskEDF_DEADLINE( pxB ) ) &&											\
+		      ( taskEDF_TIE_BREAK( pxA, pxB ) ) ) ) )
+
+/* pdTRUE if the ready task pxTCB should preempt the running task.  A higher
+ * priority always wins, and between two tasks of the EDF band the one that
+ * goes ahead in the ready list wins, so the running task is always the head of
+ * the EDF ready list. */
+#define taskEDF_SHOULD_PREEMPT( pxTCB )																			\
+		( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) ||												\
+		  ( ( ( pxTCB )->uxPriority == pxCurrentTCB->uxPriority ) &&											\
+		    ( ( ( pxTCB )->uxPriority != configEDF_PRIORITY_BAND ) ||											\
+		      ( taskEDF_RUNS_BEFORE( pxTCB, pxCurrentTCB ) ) ) ) )
+
+/* The same for the paths that, outside the EDF band, only switch to a task of
+ * a strictly higher priority. */
+#define taskEDF_SHOULD_PREEMPT_STRICT( pxTCB )																	\
+		( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) ||												\
+		  ( ( ( pxTCB )->uxPriority == configEDF_PRIORITY_BAND ) &&												\
+		    ( pxCurrentTCB->uxPriority == configEDF_PRIORITY_BAND ) &&											\
+		    ( taskEDF_RUNS_BEFORE( pxTCB, pxCurrentTCB ) ) ) )
 #endif
 /*-----------------------------------------------------------*/
 /***********************************************************************/
@@ -285,8 +994,51 @@ order to insert it in the correct position. The deadline is calculated as: T ASK
 tickcur + T ASKperiod, so every task needs to store its period value. A new variable is added in
 the tskTaskControlBlock structure (TCB)*/
 	/* E.C. : the period of a task */
-#if ( configUSE_EDF_SCHEDULER == 1 )
-	TickType_t xTaskPeriod; /*< Stores the period in tick of the task. > */
+	TickType_t xTaskPeriod;           /*< Stores the period in tick of the task, 0 if the task is not periodic. > */
+	TickType_t xTaskRelativeDeadline; /*< Deadline of each job in ticks, relative to its release. > */
+	TickType_t xTaskWCET;             /*< Worst case execution time in ticks, 0 if unknown. > */
+	UBaseType_t uxTaskDeadlineMisses; /*< Jobs that completed after their deadline or were skipped by a catch-up. > */
+#if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+	TickType_t * pxTaskReleaseTime;   /*< The wake time given to xTaskDelayUntil() while the task waits for its next release in it, else NULL. > */
+#endif
+#if ( configUSE_JOB_HISTOGRAMS == 1 )
+	uint32_t ulJobReleaseTime;        /*< The run time counter when the current job was released. > */
+	uint32_t ulJobRelativeDeadline;   /*< xTaskRelativeDeadline in run time counter counts. > */
+	BaseType_t xJobStarted;           /*< pdTRUE once the current job has been switched in. > */
+	uint32_t ulJobCount;              /*< Jobs in the histograms. > */
+	uint32_t ulJobMax[ taskJOB_HISTOGRAMS ];                                      /*< The largest value seen by each histogram. > */
+	uint32_t ulJobHistogram[ taskJOB_HISTOGRAMS ][ configJOB_HISTOGRAM_BUCKETS ]; /*< Saturating counts. > */
+#endif
+#if ( configUSE_CPU_LOAD_WINDOWS == 1 )
+	configRUN_TIME_COUNTER_TYPE ulTaskLoadRunTime; /*< The run time counter at the last load sample. > */
+	UBaseType_t uxTaskLoadShare;      /*< Tenths of a percent of the last load sample spent running the task, periodic tasks only. > */
+#endif
+#if ( configUSE_STACK_REPORT == 1 )
+	configSTACK_DEPTH_TYPE uxStackDepth; /*< The stack size given at creation, in words. > */
+#endif
+#if ( configUSE_KERNEL_PROFILING == 1 )
+	UBaseType_t uxProfileCriticalNesting; /*< The task's taskENTER_CRITICAL() calls not yet exited. > */
+	uint32_t ulProfileCriticalStart;      /*< The profile time the task entered its critical section or was last switched in inside it. > */
+	uint32_t ulProfileCriticalTime;       /*< The time spent in the critical section before the task was last switched out inside it. > */
+#endif
+#if ( configUSE_ISR_LATENCY == 1 )
+	UBaseType_t uxLatencySource;          /*< The source plus 1 of the ISR that woke the task, 0 once the task has run since. > */
+	uint32_t ulLatencyStart;              /*< The entry time of that ISR. > */
+#endif
+#if ( configUSE_EDF_SCHEDULER == 0 )
+	TickType_t xTaskResponseTime;     /*< Worst case response time found by the analysis, portMAX_DELAY if it misses its deadline. > */
+#else
+	#if ( configUSE_EDF_PARTITION_ANALYSIS == 1 )
+		UBaseType_t uxTaskCore;           /*< The core the analysis placed the task on. > */
+	#endif
+	#if ( configEDF_SPLIT_TASK_ANALYSIS == 1 )
+		UBaseType_t uxTaskSplitCore;  /*< The core the split analysis gave the second piece of each job, taskEDF_NOT_SPLIT if the task is not split. > */
+		TickType_t xTaskSplitBudget;  /*< Execution time, and deadline, the split analysis gave the first piece of each job on uxTaskCore. > */
+	#endif
+	#if ( configUSE_EDF_FINE_DEADLINES == 1 )
+		uint32_t ulTaskRelativeDeadline; /*< Deadline of each job in timer counts, relative to its release. > */
+		uint32_t ulTaskAbsoluteDeadline; /*< Deadline of the current job in timer counts, the EDF ready list order. > */
+	#endif
 #endif
 
 /*************************************************************/
@@ -300,8 +1052,11 @@ the tskTaskControlBlock structure (TCB)*/
         UBaseType_t uxCriticalNesting; /*< Holds the critical section nesting depth for ports that do not maintain their own count in the port layer. */
     #endif
 
+    #if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_LOWEST_ID ) || ( configUSE_TRACE_RECORDER == 1 ) || ( configUSE_GPIO_TASK_TRACE == 1 ) )
+        UBaseType_t uxTCBNumber;  /*< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated.  Also the task ID used to break EDF deadline ties and in trace records. */
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
-        UBaseType_t uxTCBNumber;  /*< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated. */
         UBaseType_t uxTaskNumber; /*< Stores a number specifically for use by third party trace code. */
     #endif
 
@@ -370,10 +1125,15 @@ PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
  * doing so breaks some kernel aware debuggers and debuggers that rely on removing
  * the static qualifier. */
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ]; /*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;                         /*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;                         /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    PRIVILEGED_DATA static List_t xDelayedTaskWheel[ configDELAYED_TASK_WHEEL_SIZE ];             /*< Delayed tasks, in the slot of their wake time. */
+    PRIVILEGED_DATA static uint32_t ulDelayedTaskWheelMap[ taskDELAYED_TASK_WHEEL_MAP_WORDS ] = { 0U }; /*< A bit set for each slot a task was put in, cleared once the slot is found empty. */
+#else
+    PRIVILEGED_DATA static List_t xDelayedTaskList1;                    /*< Delayed tasks. */
+    PRIVILEGED_DATA static List_t xDelayedTaskList2;                    /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+    PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;         /*< Points to the delayed task list currently being used. */
+    PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList; /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#endif
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 /**********************************************************/
@@ -382,9 +1142,128 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tas
 		/* OUR EDF */
 #if ( configUSE_EDF_SCHEDULER == 1 )
 
-		PRIVILEGED_DATA static List_t xReadyTasksListEDF; /*< Ready tasks ordered by their deadline. */
-		PRIVILEGED_DATA static TickType_t volatile xIDLEPeriod =0;
+		/* The ready list of the EDF band holds its tasks ordered by deadline, so
+		 * the band is tracked by uxTopReadyPriority like any other priority. */
+		#define xReadyTasksListEDF    ( pxReadyTasksLists[ configEDF_PRIORITY_BAND ] ) /*< Ready tasks ordered by their deadline. */
+
+#endif
+
+/* Tasks created by xTaskPeriodicCreate(), in creation order. */
+PRIVILEGED_DATA static TCB_t * pxPeriodicTasks[ configMAX_PERIODIC_TASKS ];
+PRIVILEGED_DATA static UBaseType_t uxPeriodicTaskCount = ( UBaseType_t ) 0U;
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOBS == 1 ) )
+
+/*
+ * A periodic job created by xTaskPeriodicJobCreate().  Its list item is in
+ * xJobReleaseList with the time of the next release while it waits, or in
+ * xJobReadyList with its absolute deadline once released.  It is in neither
+ * list while it runs.
+ */
+    typedef struct tskEDFJob
+    {
+        ListItem_t xJobListItem;
+        TaskFunction_t pxJobCode;
+        void * pvParameters;
+        TickType_t xPeriod;
+        TickType_t xRelativeDeadline;
+        TickType_t xNextRelease;
+    } EDFJob_t;
+
+    PRIVILEGED_DATA static List_t xJobReleaseList;               /*< Jobs waiting for their next release, in release order. */
+    PRIVILEGED_DATA static List_t xJobReadyList;                 /*< Released jobs, in deadline order. */
+    PRIVILEGED_DATA static TaskHandle_t xJobServerHandle = NULL; /*< The task that runs the jobs. */
+    PRIVILEGED_DATA static BaseType_t xJobServerHasDeadline = pdFALSE; /*< pdTRUE once the server has been given the deadline of a job. */
+    PRIVILEGED_DATA static EDFJob_t * pxRunningJob = NULL;       /*< The innermost job the server is running, NULL if none. */
+
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+
+/* Periodic tasks waiting for their next release.  The state list item holds
+ * the release time, and tasks released at the same tick are kept in the order
+ * they go into the EDF ready list. */
+    PRIVILEGED_DATA static List_t xReleaseList1;                                    /*< Waiting periodic tasks. */
+    PRIVILEGED_DATA static List_t xReleaseList2;                                    /*< Waiting periodic tasks (two lists are used - one for releases that have overflowed the current tick count. */
+    PRIVILEGED_DATA static List_t * volatile pxReleaseList;                         /*< Points to the release list currently being used. */
+    PRIVILEGED_DATA static List_t * volatile pxOverflowReleaseList;                 /*< Points to the release list holding the releases that have overflowed the current tick count. */
+    PRIVILEGED_DATA static volatile TickType_t xNextReleaseTime = portMAX_DELAY; /*< The release time at the head of pxReleaseList. */
+
+#endif
+
+#if ( configUSE_CPU_LOAD_WINDOWS == 1 )
+
+/* The run time stats counts that went by over part of a load window, and how
+ * many of them were spent outside the idle task. */
+    typedef struct xLOAD_SLOT
+    {
+        configRUN_TIME_COUNTER_TYPE ulElapsed;
+        configRUN_TIME_COUNTER_TYPE ulBusy;
+    } LoadSlot_t;
+
+    PRIVILEGED_DATA static TickType_t xLoadSampleTick = ( TickType_t ) configINITIAL_TICK_COUNT;         /*< The tick count of the last load sample. */
+    PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulLoadSampleTime = ( configRUN_TIME_COUNTER_TYPE ) 0; /*< The run time counter at the last load sample. */
+    PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulLoadIdleRunTime = ( configRUN_TIME_COUNTER_TYPE ) 0; /*< The idle task's run time at the last load sample. */
+    PRIVILEGED_DATA static LoadSlot_t xLoadSamples[ configCPU_LOAD_WINDOW_SAMPLES ];                    /*< The last samples, oldest at uxLoadSampleIndex. */
+    PRIVILEGED_DATA static LoadSlot_t xLoadBlocks[ configCPU_LOAD_WINDOW_SAMPLES ];                     /*< The last blocks of configCPU_LOAD_WINDOW_SAMPLES samples, oldest at uxLoadBlockIndex. */
+    PRIVILEGED_DATA static LoadSlot_t xLoadWindows[ taskLOAD_WINDOWS ];                                 /*< The last sample, then the running sums of xLoadSamples and xLoadBlocks. */
+    PRIVILEGED_DATA static UBaseType_t uxLoadSampleIndex = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static UBaseType_t uxLoadBlockIndex = ( UBaseType_t ) 0U;
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+/* One trace record, 8 bytes with no padding.  ulTime holds the characters of a
+ * NAME record. */
+    typedef struct xTRACE_RECORD
+    {
+        uint32_t ulTime;
+        uint8_t ucEvent;
+        uint8_t ucTask;
+        uint16_t usData;
+    } TraceRecord_t;
+
+    PRIVILEGED_DATA static TraceRecord_t xTraceRecords[ configTRACE_RECORDER_RECORDS ];
+    PRIVILEGED_DATA static volatile uint32_t ulTraceHead = 0UL;    /*< Records written, only moved by the kernel once the record is complete. */
+    PRIVILEGED_DATA static volatile uint32_t ulTraceTail = 0UL;    /*< Records read, only moved by xTaskTraceRead(). */
+    PRIVILEGED_DATA static uint32_t ulTraceDropped = 0UL;          /*< Records dropped since the last OVERFLOW record. */
+#endif
+
+#if ( ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 ) )
+
+/* What is kept for each timed part of the kernel and each latency source. */
+    typedef struct xPROFILE_STATS
+    {
+        uint32_t ulCount;
+        uint32_t ulMin;
+        uint32_t ulMax;
+        uint64_t ullTotal;
+    } ProfileStats_t;
+#endif
+
+#if ( configUSE_KERNEL_PROFILING == 1 )
+    PRIVILEGED_DATA static ProfileStats_t xProfileStats[ taskPROFILE_SECTIONS ];
+    PRIVILEGED_DATA static uint32_t ulProfileStart[ taskPROFILE_SECTIONS ]; /*< The profile time each part was entered. */
+#endif
+
+#if ( configUSE_ISR_LATENCY == 1 )
+    PRIVILEGED_DATA static ProfileStats_t xLatencyStats[ configISR_LATENCY_SOURCES ];
+    PRIVILEGED_DATA static UBaseType_t uxLatencySource = ( UBaseType_t ) 0U; /*< The source of the running ISR plus 1, 0 outside one. */
+    PRIVILEGED_DATA static uint32_t ulLatencyStart = 0UL;                    /*< The entry time of the running ISR. */
+#endif
+
+#if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+    PRIVILEGED_DATA static TickType_t xCatchUpEnd = ( TickType_t ) 0U; /*< The tick count the pended ticks are being caught up to. */
+    PRIVILEGED_DATA static BaseType_t xCatchingUp = pdFALSE;           /*< pdTRUE while xTaskResumeAll() catches up the pended ticks. */
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_DEADLINES == 1 ) )
+    PRIVILEGED_DATA static volatile uint32_t ulTickTime = 0UL;                                         /*< The deadline timer count read at the start of xTickTimeTick, 0 until the scheduler starts. */
+    PRIVILEGED_DATA static volatile TickType_t xTickTimeTick = ( TickType_t ) configINITIAL_TICK_COUNT; /*< The last tick processed by the tick interrupt. */
+#endif
 
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) )
+    PRIVILEGED_DATA static uint32_t ulCoreUtilisation[ configEDF_NUMBER_OF_CORES ]; /*< Sum of the utilisations of the periodic tasks placed on each core. */
 #endif
 /**********************************************************/
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -478,44 +1357,111 @@ static void prvInitialiseTaskLists( void ) PRIVILEGED_FUNCTION;
  */
 static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters ) PRIVILEGED_FUNCTION;
 
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOBS == 1 ) )
+
 /*
- * Utility to free all memory allocated by the scheduler to hold a TCB,
- * including the stack pointed to by the TCB.
- *
- * This does not free memory allocated by the task itself (i.e. memory
- * allocated by calls to pvPortMalloc from within the tasks application code).
+ * The task that runs the released jobs earliest deadline first, each to
+ * completion or to a preemption point.
  */
-#if ( INCLUDE_vTaskDelete == 1 )
+    static portTASK_FUNCTION_PROTO( prvJobServerTask, pvParameters ) PRIVILEGED_FUNCTION;
 
-    static void prvDeleteTCB( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+/*
+ * Take the released job with the earliest deadline if it is due before
+ * pxPreempted, or take any released job if pxPreempted is NULL, and give the
+ * server the deadline of the job it then runs.  Returns the job taken, or NULL
+ * if the server goes on with pxPreempted.  Must be called from a critical
+ * section by the server.
+ */
+    static EDFJob_t * prvStartReleasedJob( EDFJob_t * const pxPreempted ) PRIVILEGED_FUNCTION;
 
-#endif
+/*
+ * Remove and return the released job with the earliest deadline, or NULL if no
+ * job is released.  Must be called from a critical section.
+ */
+    static EDFJob_t * prvTakeReleasedJob( void ) PRIVILEGED_FUNCTION;
 
 /*
- * Used only by the idle task.  This checks to see if anything has been placed
- * in the list of tasks waiting to be deleted.  If so the task is cleaned up
- * and its TCB deleted.
+ * Put a job that has run back to wait for its next release.
  */
-static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
+    static void prvRequeueJob( EDFJob_t * pxJob ) PRIVILEGED_FUNCTION;
 
 /*
- * The currently executing task is entering the Blocked state.  Add the task to
- * either the current or the overflow delayed task list.
+ * Insert pxJob into xJobReleaseList or xJobReadyList by the tick held in its
+ * list item value, behind the jobs with the same tick.  vListInsert() is not
+ * used as its comparison does not survive the tick count wrapping.
  */
-static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
-                                            const BaseType_t xCanBlockIndefinitely ) PRIVILEGED_FUNCTION;
+    static void prvInsertJob( List_t * const pxList,
+                              EDFJob_t * const pxJob ) PRIVILEGED_FUNCTION;
 
 /*
- * Fills an TaskStatus_t structure with information on each task that is
- * referenced from the pxList list (which may be a ready list, a delayed list,
- * a suspended list, etc.).
- *
- * THIS FUNCTION IS INTENDED FOR DEBUGGING ONLY, AND SHOULD NOT BE CALLED FROM
- * NORMAL APPLICATION CODE.
+ * Called from the tick to release the jobs that are due and to make the job
+ * server as urgent as the earliest released job.  Returns pdTRUE if a context
+ * switch is required.
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+    static BaseType_t prvReleaseJobs( void ) PRIVILEGED_FUNCTION;
 
-    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+
+/*
+ * The currently executing periodic task is waiting for its next release at
+ * xTimeToRelease.  Add it to either the current or the overflow release list.
+ */
+    static void prvAddCurrentTaskToReleaseList( const TickType_t xTimeToRelease,
+                                                const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from the tick to move every periodic task released by xConstTickCount
+ * to the EDF ready list.  Returns pdTRUE if a context switch is required.
+ */
+    static BaseType_t prvReleasePeriodicTasks( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Set xNextReleaseTime from the head of pxReleaseList.
+ */
+    static void prvResetNextReleaseTime( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Utility to free all memory allocated by the scheduler to hold a TCB,
+ * including the stack pointed to by the TCB.
+ *
+ * This does not free memory allocated by the task itself (i.e. memory
+ * allocated by calls to pvPortMalloc from within the tasks application code).
+ */
+#if ( INCLUDE_vTaskDelete == 1 )
+
+    static void prvDeleteTCB( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Used only by the idle task.  This checks to see if anything has been placed
+ * in the list of tasks waiting to be deleted.  If so the task is cleaned up
+ * and its TCB deleted.
+ */
+static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * The currently executing task is entering the Blocked state.  Add the task to
+ * either the current or the overflow delayed task list.
+ */
+static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
+                                            const BaseType_t xCanBlockIndefinitely ) PRIVILEGED_FUNCTION;
+
+/*
+ * Fills an TaskStatus_t structure with information on each task that is
+ * referenced from the pxList list (which may be a ready list, a delayed list,
+ * a suspended list, etc.).
+ *
+ * THIS FUNCTION IS INTENDED FOR DEBUGGING ONLY, AND SHOULD NOT BE CALLED FROM
+ * NORMAL APPLICATION CODE.
+ */
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
                                                      List_t * pxList,
                                                      eTaskState eState ) PRIVILEGED_FUNCTION;
 
@@ -558,12 +1504,144 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
 
 #endif
 
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+/*
+ * Append a record to the trace buffer, or count it as dropped if the buffer is
+ * full.  Can be called from an interrupt.
+ */
+    static void prvTraceRecord( uint8_t ucEvent,
+                                const TCB_t * pxTCB,
+                                uint32_t ulData ) PRIVILEGED_FUNCTION;
+
+/*
+ * As prvTraceRecord(), with ulValue in place of the time.
+ */
+    static void prvTraceRecordValue( uint8_t ucEvent,
+                                     const TCB_t * pxTCB,
+                                     uint32_t ulValue,
+                                     uint32_t ulData ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_JOB_HISTOGRAMS == 1 )
+
+/*
+ * Count ulValue in histogram uxHistogram of pxTCB.
+ */
+    static void prvJobHistogramAdd( TCB_t * pxTCB,
+                                    UBaseType_t uxHistogram,
+                                    uint32_t ulValue ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 ) )
+
+/*
+ * Count ulElapsed in pxStats.  Called with interrupts masked.
+ */
+    static void prvProfileAdd( ProfileStats_t * pxStats,
+                               uint32_t ulElapsed ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy out, and optionally reset, pxStats.  Returns its count.
+ */
+    static uint32_t prvProfileRead( ProfileStats_t * pxStats,
+                                    uint32_t * pulMin,
+                                    uint32_t * pulAverage,
+                                    uint32_t * pulMax,
+                                    BaseType_t xReset ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_KERNEL_PROFILING == 1 )
+
+/*
+ * Called just after a critical section is entered and just before it is
+ * exited, to time the outermost one of the running task.
+ */
+    static void prvProfileCriticalEnter( void ) PRIVILEGED_FUNCTION;
+    static void prvProfileCriticalExit( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_CPU_LOAD_WINDOWS == 1 )
+
+/*
+ * Close the current load sample: add it to the load windows and work out the
+ * share of each periodic task.  Called from the tick interrupt.
+ */
+    static void prvSampleCpuLoad( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return ulPart as tenths of a percent of ulWhole.
+ */
+    static UBaseType_t prvGetLoadPermille( configRUN_TIME_COUNTER_TYPE ulPart,
+                                           configRUN_TIME_COUNTER_TYPE ulWhole ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configUSE_TICKLESS_IDLE != 0 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) || ( configUSE_BULK_TICK_CATCH_UP == 1 ) )
+
+/*
+ * Return the number of ticks until the next tick that unblocks a task or
+ * releases a periodic task or job.
+ */
+    static TickType_t prvGetTicksToNextWake( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+
+/*
+ * Return the number of ticks until the next tick interrupt the kernel needs,
+ * at least 1.
+ */
+    static TickType_t prvGetTicksToNextEvent( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+
+/*
+ * Count xTicksToCatchUp ticks, calling xTaskIncrementTick() only for the ticks
+ * at which something is due.  Returns pdTRUE if a context switch is required.
+ */
+    static BaseType_t prvCatchUpTicks( TickType_t xTicksToCatchUp ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the release time of a task the tick unblocks.  For a periodic task
+ * released while the ticks are caught up that is the last of its releases
+ * before the end of the catch-up.  The releases skipped are counted as misses
+ * and the task's wake time is moved on.
+ */
+    static TickType_t prvSkipMissedReleases( TCB_t * pxTCB,
+                                             TickType_t xReleaseTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Set xNextTaskUnblockTime to the time at which the next Blocked state task
  * will exit the Blocked state.
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/*
+ * Put the currently executing task in the wheel slot of xTimeToWake.
+ */
+    static void prvAddCurrentTaskToDelayedTaskWheel( TickType_t xTimeToWake,
+                                                     const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return a task of the current slot whose wake time is xConstTickCount, or
+ * NULL if there is none left.
+ */
+    static TCB_t * prvGetExpiredDelayedTask( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 /*
@@ -594,6 +1672,136 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
+/*
+ * Remove a deleted task from the table of periodic tasks.
+ */
+static void prvRemovePeriodicTask( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+/*
+ * Create a periodic task.  ulRelativeDeadline is the deadline in timer counts
+ * when configUSE_EDF_FINE_DEADLINES is 1, xRelativeDeadline the same deadline
+ * in ticks for the admission test.
+ */
+    static BaseType_t prvCreatePeriodicTask( TaskFunction_t pxTaskCode,
+                                             const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                             const configSTACK_DEPTH_TYPE usStackDepth,
+                                             void * const pvParameters,
+                                             UBaseType_t uxPriority,
+                                             TaskHandle_t * const pxCreatedTask,
+                                             TickType_t uxPeriod,
+                                             TickType_t xRelativeDeadline,
+                                             TickType_t xWCET,
+                                             uint32_t ulRelativeDeadline ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+/*
+ * Insert a task of the EDF band into the EDF ready list, in deadline order with
+ * ties broken as set by configEDF_TIE_BREAK.
+ */
+    static void prvInsertEDFReady( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a task of the EDF band into the EDF ready list, searching forward from
+ * pxFrom, which must not be behind the task's place.  Returns the item the
+ * task was placed in front of, where the search for a task that goes after
+ * this one can start.
+ */
+    static ListItem_t * prvInsertEDFReadyFrom( TCB_t * pxTCB,
+                                               ListItem_t * pxFrom ) PRIVILEGED_FUNCTION;
+
+/*
+ * Link pxNewListItem into pxList in front of pxPosition, as vListInsert()
+ * does once it has found the place.
+ */
+    static void prvInsertListItemBefore( List_t * const pxList,
+                                         ListItem_t * const pxNewListItem,
+                                         ListItem_t * const pxPosition ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_EDF_FINE_DEADLINES == 1 )
+
+/*
+ * Return the deadline timer count at the start of tick xTick, taken from the
+ * count read by the last tick interrupt.
+ */
+        static uint32_t prvEDFTickToTime( TickType_t xTick ) PRIVILEGED_FUNCTION;
+
+    #endif
+
+    #if ( configUSE_EDF_PARTITION_ANALYSIS == 1 )
+
+/*
+ * Return the core a task of the given utilisation is placed on by
+ * configEDF_PARTITIONING, or configEDF_NUMBER_OF_CORES if it fits on none.
+ */
+        static UBaseType_t prvSelectCore( uint32_t ulUtilisation ) PRIVILEGED_FUNCTION;
+
+/*
+ * Partition all the periodic tasks over the cores in decreasing utilisation
+ * order, leaving out the tasks without an execution time.  Returns pdFAIL if
+ * a task does not fit.
+ */
+        static BaseType_t prvPartitionPeriodicTasks( void ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_EDF_PARTITION_ANALYSIS */
+
+    #if ( configEDF_SPLIT_TASK_ANALYSIS == 1 )
+
+/*
+ * Split a task that fits on no single core over two cores.  Returns pdFAIL if
+ * the two pieces do not fit either.
+ */
+        static BaseType_t prvSplitPeriodicTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Get the execution time and relative deadline of the part of pxTCB that runs
+ * on uxCore.  Returns pdFALSE if none of it does.
+ */
+        static BaseType_t prvGetPieceOnCore( const TCB_t * pxTCB,
+                                             UBaseType_t uxCore,
+                                             TickType_t * pxExecutionTime,
+                                             TickType_t * pxRelativeDeadline ) PRIVILEGED_FUNCTION;
+
+/*
+ * Processor demand test of the tasks placed on uxCore together with one more
+ * piece.  Returns pdPASS if EDF meets every deadline on the core.
+ */
+        static BaseType_t prvCoreDemandTest( UBaseType_t uxCore,
+                                             TickType_t xExecutionTime,
+                                             TickType_t xRelativeDeadline,
+                                             TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+    #endif
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+#if ( configUSE_EDF_SCHEDULER == 0 )
+
+/*
+ * Rank every periodic task by period (rate monotonic) or relative deadline
+ * (deadline monotonic) and give it the matching priority.
+ */
+    static void prvAssignPeriodicPriorities( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move a task that may already be in a ready list to a new priority.  Must be
+ * called from a critical section.
+ */
+    static void prvSetPeriodicPriority( TCB_t * pxTCB,
+                                        UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * Classic response time analysis of the periodic tasks at their assigned
+ * priorities.  The result is stored in each task's xTaskResponseTime.
+ */
+    static void prvAnalysePeriodicResponseTimes( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_SCHEDULER */
+
 /*
  * freertos_tasks_c_additions_init() should only be called if the user definable
  * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
@@ -858,7 +2066,7 @@ task’s xGenericListItem is initialized to the value of the next task deadline.
 
 /******************************************************************************/
 
-#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 && configUSE_EDF_SCHEDULER == 1 ) /* special for EDF */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) /* special for EDF */
 
 		BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
 				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
@@ -867,9 +2075,107 @@ task’s xGenericListItem is initialized to the value of the next task deadline.
 				UBaseType_t uxPriority,
 				TaskHandle_t * const pxCreatedTask,
 				TickType_t uxPeriod	)
+		{
+			/* Implicit deadline (equal to the period) and unknown execution time. */
+			return xTaskPeriodicCreateConstrained( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, uxPeriod, uxPeriod, ( TickType_t ) 0U );
+		}
+
+		BaseType_t xTaskPeriodicCreateConstrained( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TickType_t uxPeriod,
+				TickType_t xRelativeDeadline,
+				TickType_t xWCET )
+		{
+			#if ( configUSE_EDF_FINE_DEADLINES == 1 )
+				return prvCreatePeriodicTask( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, uxPeriod, xRelativeDeadline, xWCET, taskEDF_TICKS_TO_COUNTS( xRelativeDeadline ) );
+			#else
+				return prvCreatePeriodicTask( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, uxPeriod, xRelativeDeadline, xWCET, 0UL );
+			#endif
+		}
+
+		#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_DEADLINES == 1 ) )
+
+			BaseType_t xTaskPeriodicCreateFine( TaskFunction_t pxTaskCode,
+					const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+					const configSTACK_DEPTH_TYPE usStackDepth,
+					void * const pvParameters,
+					UBaseType_t uxPriority,
+					TaskHandle_t * const pxCreatedTask,
+					TickType_t uxPeriod,
+					uint32_t ulRelativeDeadline,
+					TickType_t xWCET )
+			{
+				/* Releases stay on the tick, so only the deadline is given in
+				 * timer counts.  The admission test works in ticks and is given
+				 * the deadline rounded down, which keeps it safe. */
+				return prvCreatePeriodicTask( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, uxPeriod, taskEDF_COUNTS_TO_TICKS( ulRelativeDeadline ), xWCET, ulRelativeDeadline );
+			}
+
+		#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_DEADLINES == 1 ) */
+
+		static BaseType_t prvCreatePeriodicTask( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TickType_t uxPeriod,
+				TickType_t xRelativeDeadline,
+				TickType_t xWCET,
+				uint32_t ulRelativeDeadline )
 		{
 			TCB_t * pxNewTCB;
 			BaseType_t xReturn;
+			#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) )
+				UBaseType_t uxCore = taskEDF_NO_CORE;
+			#endif
+
+			configASSERT( uxPeriod > ( TickType_t ) 0U );
+			configASSERT( xRelativeDeadline > ( TickType_t ) 0U );
+			configASSERT( xRelativeDeadline <= uxPeriod );
+			configASSERT( xWCET <= xRelativeDeadline );
+
+			#if ( configUSE_EDF_SCHEDULER == 1 )
+				/* Every periodic task is in the EDF band, the caller cannot pick
+				 * another priority for it.  A task that must preempt the periodic
+				 * tasks is created with xTaskCreate() above the band. */
+				configASSERT( uxPriority == ( UBaseType_t ) configEDF_PRIORITY_BAND );
+			#endif
+
+			/* The table is only changed by task creation and deletion. */
+			if( uxPeriodicTaskCount >= ( UBaseType_t ) configMAX_PERIODIC_TASKS )
+			{
+				return errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+			}
+
+			#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) )
+				if( ( xSchedulerRunning != pdFALSE ) && ( xWCET > ( TickType_t ) 0U ) )
+				{
+					/* The tasks are already partitioned, so the new task must
+					 * fit next to them.  Its utilisation is reserved now and
+					 * given back if the task cannot be allocated.  A task
+					 * without an execution time is left on no core. */
+					taskENTER_CRITICAL();
+					{
+						uxCore = prvSelectCore( taskEDF_UTILISATION( xWCET, xRelativeDeadline ) );
+
+						if( uxCore < ( UBaseType_t ) configEDF_NUMBER_OF_CORES )
+						{
+							ulCoreUtilisation[ uxCore ] += taskEDF_UTILISATION( xWCET, xRelativeDeadline );
+						}
+					}
+					taskEXIT_CRITICAL();
+
+					if( uxCore >= ( UBaseType_t ) configEDF_NUMBER_OF_CORES )
+					{
+						return pdFAIL;
+					}
+				}
+			#endif
 
 			/* If the stack grows down then allocate the stack then the TCB so the stack
 			 * does not grow into the TCB.  Likewise if the stack grows up then allocate
@@ -937,18 +2243,95 @@ task’s xGenericListItem is initialized to the value of the next task deadline.
 				}
 #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
-				prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+				/* Periodic tasks are scheduled by deadline inside the EDF band,
+				 * or get the priority of their rank when the fixed-priority
+				 * scheduler is used. */
+				#if ( configUSE_EDF_SCHEDULER == 1 )
+					prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, configEDF_PRIORITY_BAND, pxCreatedTask, pxNewTCB, NULL );
+				#else
+					/* The rank sets the priority, uxPriority is not used. */
+					( void ) uxPriority;
+					prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, tskIDLE_PRIORITY, pxCreatedTask, pxNewTCB, NULL );
+				#endif
 
 				
 				pxNewTCB->xTaskPeriod = uxPeriod;
-				listSET_LIST_ITEM_VALUE( &( ( pxNewTCB )->xStateListItem ), ( pxNewTCB)->xTaskPeriod + xTickCount);
-				
+				pxNewTCB->xTaskRelativeDeadline = xRelativeDeadline;
+				pxNewTCB->xTaskWCET = xWCET;
+				#if ( configUSE_JOB_HISTOGRAMS == 1 )
+					pxNewTCB->ulJobRelativeDeadline = ( uint32_t ) ( ( ( uint64_t ) xRelativeDeadline * ( uint64_t ) configRUN_TIME_COUNTER_HZ ) / ( uint64_t ) configTICK_RATE_HZ );
+				#endif
+				#if ( configUSE_EDF_SCHEDULER == 1 )
+					#if ( configUSE_EDF_PARTITION_ANALYSIS == 1 )
+						pxNewTCB->uxTaskCore = uxCore;
+					#endif
+					#if ( configEDF_SPLIT_TASK_ANALYSIS == 1 )
+						pxNewTCB->uxTaskSplitCore = taskEDF_NOT_SPLIT;
+						pxNewTCB->xTaskSplitBudget = xWCET;
+					#endif
+					#if ( configUSE_EDF_FINE_DEADLINES == 1 )
+						pxNewTCB->ulTaskRelativeDeadline = ulRelativeDeadline;
+					#endif
+					taskEDF_SET_RELEASE( pxNewTCB, xTickCount );
+				#endif
+
+				#if ( ( configUSE_EDF_SCHEDULER == 0 ) || ( configUSE_EDF_FINE_DEADLINES == 0 ) )
+					( void ) ulRelativeDeadline;
+				#endif
+
+				taskENTER_CRITICAL();
+				{
+					pxPeriodicTasks[ uxPeriodicTaskCount ] = pxNewTCB;
+					uxPeriodicTaskCount++;
+
+					#if ( configUSE_EDF_SCHEDULER == 0 )
+						{
+							/* Rank the new task among the existing ones before it
+							 * becomes ready, the others are moved if need be. */
+							prvAssignPeriodicPriorities();
+							prvAnalysePeriodicResponseTimes();
+						}
+					#endif
+				}
+				taskEXIT_CRITICAL();
 
 				prvAddNewTaskToReadyList( pxNewTCB );
+
+				#if ( configUSE_EDF_SCHEDULER == 0 )
+					{
+						if( xSchedulerRunning == pdFALSE )
+						{
+							/* The task picked to run first may have lost its rank
+							 * to the new task, choose again. */
+							taskENTER_CRITICAL();
+							{
+								taskSELECT_HIGHEST_PRIORITY_TASK();
+							}
+							taskEXIT_CRITICAL();
+						}
+						else
+						{
+							/* Priorities of running tasks may have changed. */
+							taskYIELD_IF_USING_PREEMPTION();
+						}
+					}
+				#endif
+
 				xReturn = pdPASS;
 			}
 			else
 			{
+				#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) )
+					if( uxCore < ( UBaseType_t ) configEDF_NUMBER_OF_CORES )
+					{
+						taskENTER_CRITICAL();
+						{
+							ulCoreUtilisation[ uxCore ] -= taskEDF_UTILISATION( xWCET, xRelativeDeadline );
+						}
+						taskEXIT_CRITICAL();
+					}
+				#endif
+
 				xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
 			}
 
@@ -956,3665 +2339,6240 @@ task’s xGenericListItem is initialized to the value of the next task deadline.
 		}
 
 #endif /* configSUPPORT_EDF_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
 
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOBS == 1 ) )
 
-/********************************************************************************/
-
-static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
-                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-                                  const uint32_t ulStackDepth,
-                                  void * const pvParameters,
-                                  UBaseType_t uxPriority,
-                                  TaskHandle_t * const pxCreatedTask,
-                                  TCB_t * pxNewTCB,
-                                  const MemoryRegion_t * const xRegions )
-{
-    StackType_t * pxTopOfStack;
-    UBaseType_t x;
+    BaseType_t xTaskPeriodicJobCreate( TaskFunction_t pxJobCode,
+                                       void * const pvParameters,
+                                       TickType_t xPeriod,
+                                       TickType_t xRelativeDeadline )
+    {
+        EDFJob_t * pxNewJob;
+        BaseType_t xReturn = pdPASS;
 
-    #if ( portUSING_MPU_WRAPPERS == 1 )
-        /* Should the task be created in privileged mode? */
-        BaseType_t xRunPrivileged;
+        configASSERT( pxJobCode != NULL );
+        configASSERT( xPeriod > ( TickType_t ) 0U );
+        configASSERT( ( xRelativeDeadline > ( TickType_t ) 0U ) && ( xRelativeDeadline <= xPeriod ) );
 
-        if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
+        if( xJobServerHandle == NULL )
         {
-            xRunPrivileged = pdTRUE;
+            vListInitialise( &xJobReleaseList );
+            vListInitialise( &xJobReadyList );
+
+            /* The server has no deadline until the first job is released. */
+            xReturn = xTaskCreate( prvJobServerTask, configEDF_JOB_SERVER_NAME, configEDF_JOB_STACK_SIZE, NULL, configEDF_PRIORITY_BAND, &xJobServerHandle );
         }
         else
         {
-            xRunPrivileged = pdFALSE;
-        }
-        uxPriority &= ~portPRIVILEGE_BIT;
-    #endif /* portUSING_MPU_WRAPPERS == 1 */
-
-    /* Avoid dependency on memset() if it is not required. */
-    #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
-        {
-            /* Fill the stack with a known value to assist debugging. */
-            ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+            mtCOVERAGE_TEST_MARKER();
         }
-    #endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
 
-    /* Calculate the top of stack address.  This depends on whether the stack
-     * grows from high memory to low (as per the 80x86) or vice versa.
-     * portSTACK_GROWTH is used to make the result positive or negative as required
-     * by the port. */
-    #if ( portSTACK_GROWTH < 0 )
+        if( xReturn == pdPASS )
         {
-            pxTopOfStack = &( pxNewTCB->pxStack[ ulStackDepth - ( uint32_t ) 1 ] );
-            pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type.  Checked by assert(). */
+            pxNewJob = ( EDFJob_t * ) pvPortMalloc( sizeof( EDFJob_t ) );
 
-            /* Check the alignment of the calculated top of stack is correct. */
-            configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+            if( pxNewJob != NULL )
+            {
+                pxNewJob->pxJobCode = pxJobCode;
+                pxNewJob->pvParameters = pvParameters;
+                pxNewJob->xPeriod = xPeriod;
+                pxNewJob->xRelativeDeadline = xRelativeDeadline;
+                vListInitialiseItem( &( pxNewJob->xJobListItem ) );
+                listSET_LIST_ITEM_OWNER( &( pxNewJob->xJobListItem ), pxNewJob );
 
-            #if ( configRECORD_STACK_HIGH_ADDRESS == 1 )
+                taskENTER_CRITICAL();
                 {
-                    /* Also record the stack's high address, which may assist
-                     * debugging. */
-                    pxNewTCB->pxEndOfStack = pxTopOfStack;
+                    /* The first release is on the next tick. */
+                    pxNewJob->xNextRelease = xTickCount + ( TickType_t ) 1U;
+                    listSET_LIST_ITEM_VALUE( &( pxNewJob->xJobListItem ), pxNewJob->xNextRelease );
+                    prvInsertJob( &xJobReleaseList, pxNewJob );
                 }
-            #endif /* configRECORD_STACK_HIGH_ADDRESS */
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+            }
         }
-    #else /* portSTACK_GROWTH */
+        else
         {
-            pxTopOfStack = pxNewTCB->pxStack;
-
-            /* Check the alignment of the stack buffer is correct. */
-            configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
-
-            /* The other extreme of the stack space is required if stack checking is
-             * performed. */
-            pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
+            mtCOVERAGE_TEST_MARKER();
         }
-    #endif /* portSTACK_GROWTH */
 
-    /* Store the task name in the TCB. */
-    if( pcName != NULL )
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvReleaseJobs( void )
     {
-        for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+        EDFJob_t * pxJob;
+        TCB_t * const pxServerTCB = xJobServerHandle;
+        TickType_t xDeadline;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        #if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+            TickType_t xBehind, xSkipped;
+        #endif
+
+        if( pxServerTCB != NULL )
         {
-            pxNewTCB->pcTaskName[ x ] = pcName[ x ];
+            /* A release is due unless it is still ahead of the tick count,
+             * compared by difference as the release ticks wrap. */
+            while( ( listLIST_IS_EMPTY( &xJobReleaseList ) == pdFALSE ) &&
+                   ( taskEDF_TICK_BEFORE( xTickCount, listGET_ITEM_VALUE_OF_HEAD_ENTRY( &xJobReleaseList ) ) == pdFALSE ) )
+            {
+                pxJob = listGET_OWNER_OF_HEAD_ENTRY( &xJobReleaseList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                listREMOVE_ITEM( &( pxJob->xJobListItem ) );
 
-            /* Don't copy all configMAX_TASK_NAME_LEN if the string is shorter than
-             * configMAX_TASK_NAME_LEN characters just in case the memory after the
-             * string is not accessible (extremely unlikely). */
-            if( pcName[ x ] == ( char ) 0x00 )
+                #if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+                    {
+                        /* As for a periodic task, a job whose releases fell
+                         * behind while the ticks are caught up is released
+                         * once, at its last release before the end of the
+                         * catch-up.  The releases it skipped are counted as
+                         * misses of the server. */
+                        xBehind = xCatchUpEnd - pxJob->xNextRelease;
+
+                        if( ( xCatchingUp != pdFALSE ) && ( xBehind >= pxJob->xPeriod ) && ( xBehind <= ( portMAX_DELAY >> 1 ) ) )
+                        {
+                            xSkipped = xBehind / pxJob->xPeriod;
+                            pxJob->xNextRelease += xSkipped * pxJob->xPeriod;
+                            pxServerTCB->uxTaskDeadlineMisses += ( UBaseType_t ) xSkipped;
+                            taskDEADLINES_MISSED( pxServerTCB, xSkipped );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif
+
+                /* The deadline is taken from the release time, not from
+                 * xTickCount, so a late release does not shift it. */
+                xDeadline = pxJob->xNextRelease + pxJob->xRelativeDeadline;
+                pxJob->xNextRelease += pxJob->xPeriod;
+                listSET_LIST_ITEM_VALUE( &( pxJob->xJobListItem ), xDeadline );
+                prvInsertJob( &xJobReadyList, pxJob );
+            }
+
+            if( listLIST_IS_EMPTY( &xJobReadyList ) == pdFALSE )
             {
-                break;
+                xDeadline = listGET_ITEM_VALUE_OF_HEAD_ENTRY( &xJobReadyList );
+
+                if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxServerTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    /* The server was waiting for a release. */
+                    listREMOVE_ITEM( &( pxServerTCB->xStateListItem ) );
+                    taskEDF_SET_DEADLINE( pxServerTCB, xDeadline );
+                    xJobServerHasDeadline = pdTRUE;
+                    prvAddTaskToReadyList( pxServerTCB );
+                }
+                else if( ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxServerTCB->xStateListItem ) ) != pdFALSE ) &&
+                         ( ( xJobServerHasDeadline == pdFALSE ) ||
+                           ( taskEDF_TICK_BEFORE( xDeadline, listGET_LIST_ITEM_VALUE( &( pxServerTCB->xStateListItem ) ) ) ) ) )
+                {
+                    /* The server is busy with a job that is due later.  The
+                     * new job only runs at that job's next preemption point,
+                     * or when it completes, but the server moves up to the
+                     * earlier deadline so that the new job is not held up by
+                     * other tasks as well. */
+                    listREMOVE_ITEM( &( pxServerTCB->xStateListItem ) );
+                    taskEDF_SET_DEADLINE( pxServerTCB, xDeadline );
+                    xJobServerHasDeadline = pdTRUE;
+                    prvAddTaskToReadyList( pxServerTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                #if ( configUSE_PREEMPTION == 1 )
+                    {
+                        if( ( pxServerTCB != pxCurrentTCB ) &&
+                            ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxServerTCB->xStateListItem ) ) != pdFALSE ) &&
+                            ( taskEDF_SHOULD_PREEMPT( pxServerTCB ) ) )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* configUSE_PREEMPTION */
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
         }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        /* Ensure the name string is terminated in the case that the string length
-         * was greater or equal to configMAX_TASK_NAME_LEN. */
-        pxNewTCB->pcTaskName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
+        return xSwitchRequired;
     }
-    else
+/*-----------------------------------------------------------*/
+
+    static EDFJob_t * prvTakeReleasedJob( void )
     {
-        /* The task has not been given a name, so just ensure there is a NULL
-         * terminator when it is read out. */
-        pxNewTCB->pcTaskName[ 0 ] = 0x00;
-    }
+        EDFJob_t * pxJob = NULL;
 
-    /* This is used as an array index so must ensure it's not too large. */
-    configASSERT( uxPriority < configMAX_PRIORITIES );
+        if( listLIST_IS_EMPTY( &xJobReadyList ) == pdFALSE )
+        {
+            pxJob = listGET_OWNER_OF_HEAD_ENTRY( &xJobReadyList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            listREMOVE_ITEM( &( pxJob->xJobListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-    if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
-    {
-        uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+        return pxJob;
     }
-    else
+/*-----------------------------------------------------------*/
+
+    static void prvRequeueJob( EDFJob_t * pxJob )
     {
-        mtCOVERAGE_TEST_MARKER();
+        taskENTER_CRITICAL();
+        {
+            listSET_LIST_ITEM_VALUE( &( pxJob->xJobListItem ), pxJob->xNextRelease );
+            prvInsertJob( &xJobReleaseList, pxJob );
+        }
+        taskEXIT_CRITICAL();
     }
+/*-----------------------------------------------------------*/
 
-    pxNewTCB->uxPriority = uxPriority;
-    #if ( configUSE_MUTEXES == 1 )
+    static void prvInsertJob( List_t * const pxList,
+                              EDFJob_t * const pxJob )
+    {
+        const TickType_t xValue = listGET_LIST_ITEM_VALUE( &( pxJob->xJobListItem ) );
+        ListItem_t * pxIterator;
+
+        /* The ticks in one list are all within half the tick range of each
+         * other, so their differences keep the order across a wrap. */
+        for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != listGET_END_MARKER( pxList ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
         {
-            pxNewTCB->uxBasePriority = uxPriority;
-            pxNewTCB->uxMutexesHeld = 0;
+            if( taskEDF_TICK_BEFORE( xValue, listGET_LIST_ITEM_VALUE( pxIterator ) ) )
+            {
+                break;
+            }
         }
-    #endif /* configUSE_MUTEXES */
 
-    vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
-    vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
+        prvInsertListItemBefore( pxList, &( pxJob->xJobListItem ), pxIterator );
+    }
+/*-----------------------------------------------------------*/
 
-    /* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
-     * back to  the containing TCB from a generic item in a list. */
-    listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
+    static portTASK_FUNCTION( prvJobServerTask, pvParameters )
+    {
+        EDFJob_t * pxJob;
 
-    /* Event lists are always in priority order. */
-    listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-    listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
+        /* Stop warnings. */
+        ( void ) pvParameters;
 
-    #if ( portCRITICAL_NESTING_IN_TCB == 1 )
+        for( ; ; )
         {
-            pxNewTCB->uxCriticalNesting = ( UBaseType_t ) 0U;
-        }
-    #endif /* portCRITICAL_NESTING_IN_TCB */
+            taskENTER_CRITICAL();
+            {
+                pxJob = prvStartReleasedJob( NULL );
 
-    #if ( configUSE_APPLICATION_TASK_TAG == 1 )
-        {
-            pxNewTCB->pxTaskTag = NULL;
-        }
-    #endif /* configUSE_APPLICATION_TASK_TAG */
+                if( pxJob == NULL )
+                {
+                    /* Nothing to run until the tick releases a job, and the
+                     * tick gives the server that job's deadline. */
+                    vTaskSuspend( NULL );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
 
-    #if ( configGENERATE_RUN_TIME_STATS == 1 )
-        {
-            pxNewTCB->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
+            if( pxJob != NULL )
+            {
+                pxJob->pxJobCode( pxJob->pvParameters );
+                prvRequeueJob( pxJob );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-    #endif /* configGENERATE_RUN_TIME_STATS */
+    }
+/*-----------------------------------------------------------*/
 
-    #if ( portUSING_MPU_WRAPPERS == 1 )
+    static EDFJob_t * prvStartReleasedJob( EDFJob_t * const pxPreempted )
+    {
+        EDFJob_t * pxJob = NULL;
+
+        if( ( listLIST_IS_EMPTY( &xJobReadyList ) == pdFALSE ) &&
+            ( ( pxPreempted == NULL ) ||
+              ( taskEDF_TICK_BEFORE( listGET_ITEM_VALUE_OF_HEAD_ENTRY( &xJobReadyList ), listGET_LIST_ITEM_VALUE( &( pxPreempted->xJobListItem ) ) ) ) ) )
         {
-            vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
+            pxJob = prvTakeReleasedJob();
+            pxRunningJob = pxJob;
         }
-    #else
+        else
         {
-            /* Avoid compiler warning about unreferenced parameter. */
-            ( void ) xRegions;
+            pxRunningJob = pxPreempted;
         }
-    #endif
 
-    #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+        if( pxRunningJob != NULL )
         {
-            memset( ( void * ) &( pxNewTCB->pvThreadLocalStoragePointers[ 0 ] ), 0x00, sizeof( pxNewTCB->pvThreadLocalStoragePointers ) );
-        }
-    #endif
+            /* Run at the deadline of the job that runs.  The list item of a
+             * running job still holds its deadline.  A later deadline than
+             * before may let another task go first. */
+            listREMOVE_ITEM( &( pxCurrentTCB->xStateListItem ) );
+            taskEDF_SET_DEADLINE( pxCurrentTCB, listGET_LIST_ITEM_VALUE( &( pxRunningJob->xJobListItem ) ) );
+            xJobServerHasDeadline = pdTRUE;
+            prvAddTaskToReadyList( pxCurrentTCB );
 
-    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
-        {
-            memset( ( void * ) &( pxNewTCB->ulNotifiedValue[ 0 ] ), 0x00, sizeof( pxNewTCB->ulNotifiedValue ) );
-            memset( ( void * ) &( pxNewTCB->ucNotifyState[ 0 ] ), 0x00, sizeof( pxNewTCB->ucNotifyState ) );
+            if( listGET_OWNER_OF_HEAD_ENTRY( &xReadyTasksListEDF ) != pxCurrentTCB )
+            {
+                taskYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-    #endif
-
-    #if ( configUSE_NEWLIB_REENTRANT == 1 )
+        else
         {
-            /* Initialise this task's Newlib reent structure.
-             * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-             * for additional information. */
-            _REENT_INIT_PTR( ( &( pxNewTCB->xNewLib_reent ) ) );
+            mtCOVERAGE_TEST_MARKER();
         }
-    #endif
 
-    #if ( INCLUDE_xTaskAbortDelay == 1 )
+        return pxJob;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskPeriodicJobPreemptionPoint( void )
+    {
+        EDFJob_t * const pxPreempted = pxRunningJob;
+        EDFJob_t * pxJob;
+
+        /* Only a job can be preempted, from the server's own stack. */
+        configASSERT( ( pxCurrentTCB == xJobServerHandle ) && ( pxPreempted != NULL ) );
+
+        do
         {
-            pxNewTCB->ucDelayAborted = pdFALSE;
-        }
-    #endif
+            taskENTER_CRITICAL();
+            {
+                /* When no earlier job is left the server gets the
+                 * deadline of pxPreempted back in the same critical
+                 * section, so a release cannot slip in between. */
+                pxJob = prvStartReleasedJob( pxPreempted );
+            }
+            taskEXIT_CRITICAL();
 
-    /* Initialize the TCB stack to look as if the task was already running,
-     * but had been interrupted by the scheduler.  The return address is set
-     * to the start of the task function. Once the stack has been initialised
-     * the top of stack variable is updated. */
-    #if ( portUSING_MPU_WRAPPERS == 1 )
+            if( pxJob != NULL )
+            {
+                /* The job runs nested on top of pxPreempted, and can
+                 * itself be preempted at its own preemption points. */
+                pxJob->pxJobCode( pxJob->pvParameters );
+                prvRequeueJob( pxJob );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } while( pxJob != NULL );
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOBS == 1 ) */
+/*-----------------------------------------------------------*/
+
+static void prvRemovePeriodicTask( const TCB_t * pxTCB )
+{
+    UBaseType_t uxIndex;
+
+    for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
+    {
+        if( pxPeriodicTasks[ uxIndex ] == pxTCB )
         {
-            /* If the port has capability to detect stack overflow,
-             * pass the stack end address to the stack initialization
-             * function as well. */
-            #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+            /* Keep the table in creation order. */
+            for( ; uxIndex < ( uxPeriodicTaskCount - ( UBaseType_t ) 1U ); uxIndex++ )
+            {
+                pxPeriodicTasks[ uxIndex ] = pxPeriodicTasks[ uxIndex + ( UBaseType_t ) 1U ];
+            }
+
+            uxPeriodicTaskCount--;
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) )
                 {
-                    #if ( portSTACK_GROWTH < 0 )
+                    #if ( configEDF_SPLIT_TASK_ANALYSIS == 1 )
+                        if( pxTCB->uxTaskSplitCore != taskEDF_NOT_SPLIT )
                         {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
+                            /* Each piece was accounted on its own core. */
+                            ulCoreUtilisation[ pxTCB->uxTaskCore ] -= taskEDF_UTILISATION( pxTCB->xTaskSplitBudget, pxTCB->xTaskSplitBudget );
+                            ulCoreUtilisation[ pxTCB->uxTaskSplitCore ] -= taskEDF_UTILISATION( pxTCB->xTaskWCET - pxTCB->xTaskSplitBudget,
+                                                                                                pxTCB->xTaskRelativeDeadline - pxTCB->xTaskSplitBudget );
                         }
-                    #else /* portSTACK_GROWTH */
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
-                        }
-                    #endif /* portSTACK_GROWTH */
-                }
-            #else /* portHAS_STACK_OVERFLOW_CHECKING */
-                {
-                    pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+                        else
+                    #endif /* configEDF_SPLIT_TASK_ANALYSIS */
+
+                    if( pxTCB->uxTaskCore != taskEDF_NO_CORE )
+                    {
+                        ulCoreUtilisation[ pxTCB->uxTaskCore ] -= taskEDF_UTILISATION( pxTCB->xTaskWCET, pxTCB->xTaskRelativeDeadline );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
-            #endif /* portHAS_STACK_OVERFLOW_CHECKING */
+            #endif
+
+            break;
         }
-    #else /* portUSING_MPU_WRAPPERS */
+        else
         {
-            /* If the port has capability to detect stack overflow,
-             * pass the stack end address to the stack initialization
-             * function as well. */
-            #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
-                {
-                    #if ( portSTACK_GROWTH < 0 )
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
-                        }
-                    #else /* portSTACK_GROWTH */
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
-                        }
-                    #endif /* portSTACK_GROWTH */
-                }
-            #else /* portHAS_STACK_OVERFLOW_CHECKING */
-                {
-                    pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
-                }
-            #endif /* portHAS_STACK_OVERFLOW_CHECKING */
+            mtCOVERAGE_TEST_MARKER();
         }
-    #endif /* portUSING_MPU_WRAPPERS */
-
-    if( pxCreatedTask != NULL )
-    {
-        /* Pass the handle out in an anonymous way.  The handle can be used to
-         * change the created task's priority, delete the created task, etc.*/
-        *pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
-    }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
     }
 }
 /*-----------------------------------------------------------*/
 
-static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
-{
-    /* Ensure interrupts don't access the task lists while the lists are being
-     * updated. */
-    taskENTER_CRITICAL();
+#if ( configUSE_EDF_SCHEDULER == 0 )
+
+    static void prvAssignPeriodicPriorities( void )
     {
-        uxCurrentNumberOfTasks++;
+        TCB_t * pxRanked[ configMAX_PERIODIC_TASKS ];
+        TCB_t * pxTCB;
+        TickType_t xKey, xPreviousKey = ( TickType_t ) 0U;
+        UBaseType_t uxIndex, uxInsert, uxPriority = ( UBaseType_t ) configPERIODIC_MAX_PRIORITY;
 
-        if( pxCurrentTCB == NULL )
+        /* Insertion sort on the period or relative deadline.  Equal keys stay in
+         * creation order. */
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
         {
-            /* There are no other tasks, or all the other tasks are in
-             * the suspended state - make this the current task. */
-            pxCurrentTCB = pxNewTCB;
+            pxTCB = pxPeriodicTasks[ uxIndex ];
 
-            if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
-            {
-                /* This is the first task to be created so do the preliminary
-                 * initialisation required.  We will not recover if this call
-                 * fails, but we will report the failure. */
-                prvInitialiseTaskLists();
-            }
-            else
+            #if ( configPERIODIC_PRIORITY_ASSIGNMENT == taskPERIODIC_DEADLINE_MONOTONIC )
+                xKey = pxTCB->xTaskRelativeDeadline;
+            #else
+                xKey = pxTCB->xTaskPeriod;
+            #endif
+
+            for( uxInsert = uxIndex; uxInsert > ( UBaseType_t ) 0U; uxInsert-- )
             {
-                mtCOVERAGE_TEST_MARKER();
+                #if ( configPERIODIC_PRIORITY_ASSIGNMENT == taskPERIODIC_DEADLINE_MONOTONIC )
+                    if( pxRanked[ uxInsert - ( UBaseType_t ) 1U ]->xTaskRelativeDeadline <= xKey )
+                #else
+                    if( pxRanked[ uxInsert - ( UBaseType_t ) 1U ]->xTaskPeriod <= xKey )
+                #endif
+                {
+                    break;
+                }
+
+                pxRanked[ uxInsert ] = pxRanked[ uxInsert - ( UBaseType_t ) 1U ];
             }
+
+            pxRanked[ uxInsert ] = pxTCB;
         }
-        else
+
+        /* Hand out one priority per distinct key from the top down.  When there
+         * are more distinct keys than priorities the lowest ranks share
+         * tskIDLE_PRIORITY + 1, which keeps the ordering safe but pessimistic. */
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
         {
-            /* If the scheduler is not already running, make this task the
-             * current task if it is the highest priority task to be created
-             * so far. */
-			 
-            if( xSchedulerRunning == pdFALSE )
+            pxTCB = pxRanked[ uxIndex ];
+
+            #if ( configPERIODIC_PRIORITY_ASSIGNMENT == taskPERIODIC_DEADLINE_MONOTONIC )
+                xKey = pxTCB->xTaskRelativeDeadline;
+            #else
+                xKey = pxTCB->xTaskPeriod;
+            #endif
+
+            if( ( uxIndex > ( UBaseType_t ) 0U ) && ( xKey != xPreviousKey ) && ( uxPriority > ( tskIDLE_PRIORITY + ( UBaseType_t ) 1U ) ) )
             {
-				/*******************************************************************/
-                /* Select Current Task if not Running */ 
-				#if (configUSE_EDF_SCHEDULER == 0)
-                    if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
-                    {
-                        pxCurrentTCB = pxNewTCB;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-				#else
-				    if( pxCurrentTCB->xStateListItem.xItemValue > pxNewTCB->xStateListItem.xItemValue )
-                    {
-						/* Update Current Task : It means its deadline is close */
-                        pxCurrentTCB = pxNewTCB;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-				#endif
+                uxPriority--;
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
-        }
-
-        uxTaskNumber++;
-/*******************************************************************/
-
-        #if ( configUSE_TRACE_FACILITY == 1 )
-            {
-                /* Add a counter into the TCB for tracing only. */
-                pxNewTCB->uxTCBNumber = uxTaskNumber;
-            }
-        #endif /* configUSE_TRACE_FACILITY */
-        traceTASK_CREATE( pxNewTCB );
-
-        prvAddTaskToReadyList( pxNewTCB );
-
-        portSETUP_TCB( pxNewTCB );
-    }
-    taskEXIT_CRITICAL();
 
-    if( xSchedulerRunning != pdFALSE )
-    {
-        /* If the created task is of a higher priority than the current task
-         * then it should run now. */
-        if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
-        {
-            taskYIELD_IF_USING_PREEMPTION();
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
+            xPreviousKey = xKey;
+            prvSetPeriodicPriority( pxTCB, uxPriority );
         }
     }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
-    }
-}
+
+#endif /* configUSE_EDF_SCHEDULER */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+#if ( configUSE_EDF_SCHEDULER == 0 )
 
-    void vTaskDelete( TaskHandle_t xTaskToDelete )
+    static void prvSetPeriodicPriority( TCB_t * pxTCB,
+                                        UBaseType_t uxNewPriority )
     {
-        TCB_t * pxTCB;
+        BaseType_t xWasReady;
 
-        taskENTER_CRITICAL();
+        if( pxTCB->uxPriority != uxNewPriority )
         {
-            /* If null is passed in here then it is the calling task that is
-             * being deleted. */
-            pxTCB = prvGetTCBFromHandle( xTaskToDelete );
+            /* A task still being created is not in any list yet. */
+            xWasReady = ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) ? pdTRUE : pdFALSE;
 
-            /* Remove task from the ready/delayed list. */
-            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            if( xWasReady != pdFALSE )
             {
-                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+                if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                {
+                    portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            /* Is the task waiting on an event also? */
-            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-            {
-                ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+            pxTCB->uxPriority = uxNewPriority;
 
-            /* Increment the uxTaskNumber also so kernel aware debuggers can
-             * detect that the task lists need re-generating.  This is done before
-             * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
-             * not return. */
-            uxTaskNumber++;
+            #if ( configUSE_MUTEXES == 1 )
+                {
+                    pxTCB->uxBasePriority = uxNewPriority;
+                }
+            #endif
 
-            if( pxTCB == pxCurrentTCB )
+            if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
             {
-                /* A task is deleting itself.  This cannot complete within the
-                 * task itself, as a context switch to another task is required.
-                 * Place the task in the termination list.  The idle task will
-                 * check the termination list and free up any memory allocated by
-                 * the scheduler for the TCB and stack of the deleted task. */
-                vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
-
-                /* Increment the ucTasksDeleted variable so the idle task knows
-                 * there is a task that has been deleted and that it should therefore
-                 * check the xTasksWaitingTermination list. */
-                ++uxDeletedTasksWaitingCleanUp;
-
-                /* Call the delete hook before portPRE_TASK_DELETE_HOOK() as
-                 * portPRE_TASK_DELETE_HOOK() does not return in the Win32 port. */
-                traceTASK_DELETE( pxTCB );
-
-                /* The pre-delete hook is primarily for the Windows simulator,
-                 * in which Windows specific clean up operations are performed,
-                 * after which it is not possible to yield away from this task -
-                 * hence xYieldPending is used to latch that a context switch is
-                 * required. */
-                portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
             }
             else
             {
-                --uxCurrentNumberOfTasks;
-                traceTASK_DELETE( pxTCB );
-
-                /* Reset the next expected unblock time in case it referred to
-                 * the task that has just been deleted. */
-                prvResetNextTaskUnblockTime();
+                mtCOVERAGE_TEST_MARKER();
             }
-        }
-        taskEXIT_CRITICAL();
-
-        /* If the task is not deleting itself, call prvDeleteTCB from outside of
-         * critical section. If a task deletes itself, prvDeleteTCB is called
-         * from prvCheckTasksWaitingTermination which is called from Idle task. */
-        if( pxTCB != pxCurrentTCB )
-        {
-            prvDeleteTCB( pxTCB );
-        }
 
-        /* Force a reschedule if it is the currently running task that has just
-         * been deleted. */
-        if( xSchedulerRunning != pdFALSE )
-        {
-            if( pxTCB == pxCurrentTCB )
+            if( xWasReady != pdFALSE )
             {
-                configASSERT( uxSchedulerSuspended == 0 );
-                portYIELD_WITHIN_API();
+                prvAddTaskToReadyList( pxTCB );
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
         }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
 
-#endif /* INCLUDE_vTaskDelete */
+#endif /* configUSE_EDF_SCHEDULER */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskDelayUntil == 1 )
+#if ( configUSE_EDF_SCHEDULER == 0 )
 
-    BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
-                                const TickType_t xTimeIncrement )
+    static void prvAnalysePeriodicResponseTimes( void )
     {
-        TickType_t xTimeToWake;
-        BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
-
-        configASSERT( pxPreviousWakeTime );
-        configASSERT( ( xTimeIncrement > 0U ) );
-        configASSERT( uxSchedulerSuspended == 0 );
+        TCB_t * pxTCB;
+        TCB_t * pxOther;
+        TickType_t xResponse, xInterference;
+        UBaseType_t uxIndex, uxOther;
+        BaseType_t xKnown;
 
-        vTaskSuspendAll();
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
         {
-            /* Minor optimisation.  The tick count cannot change in this
-             * block. */
-            const TickType_t xConstTickCount = xTickCount;
+            pxTCB = pxPeriodicTasks[ uxIndex ];
 
-            /* Generate the tick time at which the task wants to wake. */
-            xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+            /* Tasks sharing a priority can delay each other, so they count as
+             * interference as well as the higher priority ones. */
+            xResponse = pxTCB->xTaskWCET;
+            xKnown = ( pxTCB->xTaskWCET != ( TickType_t ) 0U ) ? pdTRUE : pdFALSE;
 
-            if( xConstTickCount < *pxPreviousWakeTime )
+            for( uxOther = ( UBaseType_t ) 0U; uxOther < uxPeriodicTaskCount; uxOther++ )
             {
-                /* The tick count has overflowed since this function was
-                 * lasted called.  In this case the only time we should ever
-                 * actually delay is if the wake time has also  overflowed,
-                 * and the wake time is greater than the tick time.  When this
-                 * is the case it is as if neither time had overflowed. */
-                if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
-                {
-                    xShouldDelay = pdTRUE;
-                }
-                else
+                pxOther = pxPeriodicTasks[ uxOther ];
+
+                if( ( pxOther != pxTCB ) && ( pxOther->uxPriority >= pxTCB->uxPriority ) )
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    xResponse += pxOther->xTaskWCET;
+
+                    if( pxOther->xTaskWCET == ( TickType_t ) 0U )
+                    {
+                        xKnown = pdFALSE;
+                    }
                 }
             }
-            else
+
+            /* An execution time of 0 is not known, so neither is the response
+             * time of that task or of any task it can delay. */
+            if( xKnown == pdFALSE )
             {
-                /* The tick time has not overflowed.  In this case we will
-                 * delay if either the wake time has overflowed, and/or the
-                 * tick time is less than the wake time. */
-                if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+                pxTCB->xTaskResponseTime = taskRESPONSE_TIME_UNKNOWN;
+                continue;
+            }
+
+            /* R = C + sum( ceil( R / Tj ) * Cj ), iterated until it settles or
+             * passes the deadline. */
+            for( ; ; )
+            {
+                if( xResponse > pxTCB->xTaskRelativeDeadline )
                 {
-                    xShouldDelay = pdTRUE;
+                    xResponse = portMAX_DELAY;
+                    break;
                 }
-                else
+
+                xInterference = pxTCB->xTaskWCET;
+
+                for( uxOther = ( UBaseType_t ) 0U; uxOther < uxPeriodicTaskCount; uxOther++ )
                 {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
+                    pxOther = pxPeriodicTasks[ uxOther ];
 
-            /* Update the wake time ready for the next call. */
-            *pxPreviousWakeTime = xTimeToWake;
+                    if( ( pxOther != pxTCB ) && ( pxOther->uxPriority >= pxTCB->uxPriority ) )
+                    {
+                        xInterference += ( ( xResponse + pxOther->xTaskPeriod - ( TickType_t ) 1U ) / pxOther->xTaskPeriod ) * pxOther->xTaskWCET;
+                    }
+                }
 
-            if( xShouldDelay != pdFALSE )
-            {
-                traceTASK_DELAY_UNTIL( xTimeToWake );
+                if( xInterference == xResponse )
+                {
+                    break;
+                }
 
-                /* prvAddCurrentTaskToDelayedList() needs the block time, not
-                 * the time to wake, so subtract the current tick count. */
-                prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
+                xResponse = xInterference;
             }
-        }
-        xAlreadyYielded = xTaskResumeAll();
 
-        /* Force a reschedule if xTaskResumeAll has not already done so, we may
-         * have put ourselves to sleep. */
-        if( xAlreadyYielded == pdFALSE )
-        {
-            portYIELD_WITHIN_API();
+            pxTCB->xTaskResponseTime = xResponse;
         }
-        else
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 0 )
+
+    TickType_t xTaskPeriodicGetResponseTime( TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+        TickType_t xReturn;
+
+        taskENTER_CRITICAL();
         {
-            mtCOVERAGE_TEST_MARKER();
+            pxTCB = prvGetTCBFromHandle( xTask );
+            xReturn = pxTCB->xTaskResponseTime;
         }
+        taskEXIT_CRITICAL();
 
-        return xShouldDelay;
+        return xReturn;
     }
 
-#endif /* INCLUDE_xTaskDelayUntil */
+#endif /* configUSE_EDF_SCHEDULER */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelay == 1 )
+UBaseType_t uxTaskPeriodicGetMisses( TaskHandle_t xTask )
+{
+    TCB_t const * pxTCB;
+    UBaseType_t uxReturn;
 
-    void vTaskDelay( const TickType_t xTicksToDelay )
+    taskENTER_CRITICAL();
     {
-        BaseType_t xAlreadyYielded = pdFALSE;
+        pxTCB = prvGetTCBFromHandle( xTask );
+        uxReturn = pxTCB->uxTaskDeadlineMisses;
+    }
+    taskEXIT_CRITICAL();
 
-        /* A delay time of zero just forces a reschedule. */
-        if( xTicksToDelay > ( TickType_t ) 0U )
-        {
-            configASSERT( uxSchedulerSuspended == 0 );
-            vTaskSuspendAll();
-            {
-                traceTASK_DELAY();
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
 
-                /* A task that is removed from the event list while the
-                 * scheduler is suspended will not get placed in the ready
-                 * list or removed from the blocked list until the scheduler
-                 * is resumed.
-                 *
-                 * This task cannot be in an event list as it is the currently
-                 * executing task. */
-                prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
-            }
-            xAlreadyYielded = xTaskResumeAll();
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
+TaskHandle_t xTaskPeriodicGetHandle( UBaseType_t uxIndex )
+{
+    TaskHandle_t xReturn = NULL;
 
-        /* Force a reschedule if xTaskResumeAll has not already done so, we may
-         * have put ourselves to sleep. */
-        if( xAlreadyYielded == pdFALSE )
+    taskENTER_CRITICAL();
+    {
+        if( uxIndex < uxPeriodicTaskCount )
         {
-            portYIELD_WITHIN_API();
+            xReturn = ( TaskHandle_t ) pxPeriodicTasks[ uxIndex ];
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
     }
+    taskEXIT_CRITICAL();
 
-#endif /* INCLUDE_vTaskDelay */
+    return xReturn;
+}
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_xTaskAbortDelay == 1 ) )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) )
 
-    eTaskState eTaskGetState( TaskHandle_t xTask )
+    static UBaseType_t prvSelectCore( uint32_t ulUtilisation )
     {
-        eTaskState eReturn;
-        List_t const * pxStateList, * pxDelayedList, * pxOverflowedDelayedList;
-        const TCB_t * const pxTCB = xTask;
-
-        configASSERT( pxTCB );
+        UBaseType_t uxCore, uxReturn = ( UBaseType_t ) configEDF_NUMBER_OF_CORES;
 
-        if( pxTCB == pxCurrentTCB )
-        {
-            /* The task calling this function is querying its own state. */
-            eReturn = eRunning;
-        }
-        else
+        for( uxCore = ( UBaseType_t ) 0U; uxCore < ( UBaseType_t ) configEDF_NUMBER_OF_CORES; uxCore++ )
         {
-            taskENTER_CRITICAL();
+            if( ( ulCoreUtilisation[ uxCore ] + ulUtilisation ) <= taskEDF_FULL_UTILISATION )
             {
-                pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
-                pxDelayedList = pxDelayedTaskList;
-                pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+                #if ( configEDF_PARTITIONING == taskEDF_WORST_FIT_DECREASING )
+                    {
+                        /* The least loaded core that still fits. */
+                        if( ( uxReturn == ( UBaseType_t ) configEDF_NUMBER_OF_CORES ) ||
+                            ( ulCoreUtilisation[ uxCore ] < ulCoreUtilisation[ uxReturn ] ) )
+                        {
+                            uxReturn = uxCore;
+                        }
+                    }
+                #else
+                    {
+                        /* The first core that fits. */
+                        uxReturn = uxCore;
+                        break;
+                    }
+                #endif
             }
-            taskEXIT_CRITICAL();
-
-            if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+            else
             {
-                /* The task being queried is referenced from one of the Blocked
-                 * lists. */
-                eReturn = eBlocked;
+                mtCOVERAGE_TEST_MARKER();
             }
+        }
 
-            #if ( INCLUDE_vTaskSuspend == 1 )
-                else if( pxStateList == &xSuspendedTaskList )
-                {
-                    /* The task being queried is referenced from the suspended
-                     * list.  Is it genuinely suspended or is it blocked
-                     * indefinitely? */
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
-                    {
-                        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
-                            {
-                                BaseType_t x;
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
 
-                                /* The task does not appear on the event list item of
-                                 * and of the RTOS objects, but could still be in the
-                                 * blocked state if it is waiting on its notification
-                                 * rather than waiting on an object.  If not, is
-                                 * suspended. */
-                                eReturn = eSuspended;
+    static BaseType_t prvPartitionPeriodicTasks( void )
+    {
+        TCB_t * pxRanked[ configMAX_PERIODIC_TASKS ];
+        TCB_t * pxTCB;
+        uint32_t ulUtilisation;
+        UBaseType_t uxIndex, uxInsert, uxCore;
+        BaseType_t xReturn = pdPASS;
 
-                                for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
-                                {
-                                    if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
-                                    {
-                                        eReturn = eBlocked;
-                                        break;
-                                    }
-                                }
-                            }
-                        #else /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
-                            {
-                                eReturn = eSuspended;
-                            }
-                        #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
-                    }
-                    else
-                    {
-                        eReturn = eBlocked;
-                    }
-                }
-            #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+        /* Insertion sort on decreasing utilisation.  Equal utilisations stay in
+         * creation order. */
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
+        {
+            pxTCB = pxPeriodicTasks[ uxIndex ];
+            ulUtilisation = taskEDF_UTILISATION( pxTCB->xTaskWCET, pxTCB->xTaskRelativeDeadline );
 
-            #if ( INCLUDE_vTaskDelete == 1 )
-                else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
+            for( uxInsert = uxIndex; uxInsert > ( UBaseType_t ) 0U; uxInsert-- )
+            {
+                if( taskEDF_UTILISATION( pxRanked[ uxInsert - ( UBaseType_t ) 1U ]->xTaskWCET,
+                                         pxRanked[ uxInsert - ( UBaseType_t ) 1U ]->xTaskRelativeDeadline ) >= ulUtilisation )
                 {
-                    /* The task being queried is referenced from the deleted
-                     * tasks list, or it is not referenced from any lists at
-                     * all. */
-                    eReturn = eDeleted;
+                    break;
                 }
-            #endif
 
-            else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
-            {
-                /* If the task is not in any other state, it must be in the
-                 * Ready (including pending ready) state. */
-                eReturn = eReady;
+                pxRanked[ uxInsert ] = pxRanked[ uxInsert - ( UBaseType_t ) 1U ];
             }
-        }
 
-        return eReturn;
-    } /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+            pxRanked[ uxInsert ] = pxTCB;
 
-#endif /* INCLUDE_eTaskGetState */
-/*-----------------------------------------------------------*/
+            /* Not placed yet, so left out of the demand tests. */
+            pxTCB->uxTaskCore = taskEDF_NO_CORE;
 
-#if ( INCLUDE_uxTaskPriorityGet == 1 )
+            #if ( configEDF_SPLIT_TASK_ANALYSIS == 1 )
+                pxTCB->uxTaskSplitCore = taskEDF_NOT_SPLIT;
+                pxTCB->xTaskSplitBudget = pxTCB->xTaskWCET;
+            #endif
+        }
 
-    UBaseType_t uxTaskPriorityGet( const TaskHandle_t xTask )
-    {
-        TCB_t const * pxTCB;
-        UBaseType_t uxReturn;
+        for( uxCore = ( UBaseType_t ) 0U; uxCore < ( UBaseType_t ) configEDF_NUMBER_OF_CORES; uxCore++ )
+        {
+            ulCoreUtilisation[ uxCore ] = ( uint32_t ) 0UL;
+        }
 
-        taskENTER_CRITICAL();
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
         {
-            /* If null is passed in here then it is the priority of the task
-             * that called uxTaskPriorityGet() that is being queried. */
-            pxTCB = prvGetTCBFromHandle( xTask );
-            uxReturn = pxTCB->uxPriority;
+            pxTCB = pxRanked[ uxIndex ];
+
+            if( pxTCB->xTaskWCET == ( TickType_t ) 0U )
+            {
+                /* The execution time is not known, so the task is left out.
+                 * It sorts last, as do all the tasks after it. */
+                break;
+            }
+
+            ulUtilisation = taskEDF_UTILISATION( pxTCB->xTaskWCET, pxTCB->xTaskRelativeDeadline );
+            uxCore = prvSelectCore( ulUtilisation );
+
+            if( uxCore < ( UBaseType_t ) configEDF_NUMBER_OF_CORES )
+            {
+                pxTCB->uxTaskCore = uxCore;
+                ulCoreUtilisation[ uxCore ] += ulUtilisation;
+            }
+            else
+            {
+                #if ( configEDF_SPLIT_TASK_ANALYSIS == 1 )
+                    xReturn = prvSplitPeriodicTask( pxTCB );
+                #else
+                    xReturn = pdFAIL;
+                #endif
+
+                if( xReturn == pdFAIL )
+                {
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
         }
-        taskEXIT_CRITICAL();
 
-        return uxReturn;
+        return xReturn;
     }
-
-#endif /* INCLUDE_uxTaskPriorityGet */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskPriorityGet == 1 )
+    #if ( configEDF_SPLIT_TASK_ANALYSIS == 1 )
 
-    UBaseType_t uxTaskPriorityGetFromISR( const TaskHandle_t xTask )
-    {
-        TCB_t const * pxTCB;
-        UBaseType_t uxReturn, uxSavedInterruptState;
+        static BaseType_t prvSplitPeriodicTask( TCB_t * pxTCB )
+        {
+            UBaseType_t uxFirst, uxSecond;
+            TickType_t xLow, xHigh, xMiddle, xBudget;
+            BaseType_t xReturn = pdFAIL;
 
-        /* RTOS ports that support interrupt nesting have the concept of a
-         * maximum  system call (or maximum API call) interrupt priority.
-         * Interrupts that are  above the maximum system call priority are keep
-         * permanently enabled, even when the RTOS kernel is in a critical section,
-         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-         * is defined in FreeRTOSConfig.h then
-         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-         * failure if a FreeRTOS API function is called from an interrupt that has
-         * been assigned a priority above the configured maximum system call
-         * priority.  Only FreeRTOS functions that end in FromISR can be called
-         * from interrupts  that have been assigned a priority at or (logically)
-         * below the maximum system call interrupt priority.  FreeRTOS maintains a
-         * separate interrupt safe API to ensure interrupt entry is as fast and as
-         * simple as possible.  More information (albeit Cortex-M specific) is
-         * provided on the following link:
-         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
-
-        uxSavedInterruptState = portSET_INTERRUPT_MASK_FROM_ISR();
-        {
-            /* If null is passed in here then it is the priority of the calling
-             * task that is being queried. */
-            pxTCB = prvGetTCBFromHandle( xTask );
-            uxReturn = pxTCB->uxPriority;
-        }
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptState );
-
-        return uxReturn;
-    }
-
-#endif /* INCLUDE_uxTaskPriorityGet */
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_vTaskPrioritySet == 1 )
-
-    void vTaskPrioritySet( TaskHandle_t xTask,
-                           UBaseType_t uxNewPriority )
-    {
-        TCB_t * pxTCB;
-        UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
-        BaseType_t xYieldRequired = pdFALSE;
-
-        configASSERT( uxNewPriority < configMAX_PRIORITIES );
-
-        /* Ensure the new priority is valid. */
-        if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
-        {
-            uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
-
-        taskENTER_CRITICAL();
-        {
-            /* If null is passed in here then it is the priority of the calling
-             * task that is being changed. */
-            pxTCB = prvGetTCBFromHandle( xTask );
-
-            traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+            for( uxFirst = ( UBaseType_t ) 0U; ( uxFirst < ( UBaseType_t ) configEDF_NUMBER_OF_CORES ) && ( xReturn == pdFAIL ); uxFirst++ )
+            {
+                /* Binary search for the largest first piece the core can take,
+                 * the demand only grows with the budget.  At least one tick has
+                 * to be left for the second piece. */
+                xBudget = ( TickType_t ) 0U;
+                xLow = ( TickType_t ) 1U;
+                xHigh = pxTCB->xTaskWCET - ( TickType_t ) 1U;
 
-            #if ( configUSE_MUTEXES == 1 )
-                {
-                    uxCurrentBasePriority = pxTCB->uxBasePriority;
-                }
-            #else
+                while( ( xLow <= xHigh ) && ( xHigh > ( TickType_t ) 0U ) )
                 {
-                    uxCurrentBasePriority = pxTCB->uxPriority;
+                    xMiddle = xLow + ( ( xHigh - xLow ) / ( TickType_t ) 2U );
+
+                    if( prvCoreDemandTest( uxFirst, xMiddle, xMiddle, pxTCB->xTaskPeriod ) == pdPASS )
+                    {
+                        xBudget = xMiddle;
+                        xLow = xMiddle + ( TickType_t ) 1U;
+                    }
+                    else
+                    {
+                        xHigh = xMiddle - ( TickType_t ) 1U;
+                    }
                 }
-            #endif
 
-            if( uxCurrentBasePriority != uxNewPriority )
-            {
-                /* The priority change may have readied a task of higher
-                 * priority than the calling task. */
-                if( uxNewPriority > uxCurrentBasePriority )
+                if( xBudget > ( TickType_t ) 0U )
                 {
-                    if( pxTCB != pxCurrentTCB )
+                    /* The first other core that takes the rest. */
+                    for( uxSecond = ( UBaseType_t ) 0U; uxSecond < ( UBaseType_t ) configEDF_NUMBER_OF_CORES; uxSecond++ )
                     {
-                        /* The priority of a task other than the currently
-                         * running task is being raised.  Is the priority being
-                         * raised above that of the running task? */
-                        if( uxNewPriority >= pxCurrentTCB->uxPriority )
+                        if( ( uxSecond != uxFirst ) &&
+                            ( prvCoreDemandTest( uxSecond, pxTCB->xTaskWCET - xBudget, pxTCB->xTaskRelativeDeadline - xBudget, pxTCB->xTaskPeriod ) == pdPASS ) )
                         {
-                            xYieldRequired = pdTRUE;
+                            pxTCB->uxTaskCore = uxFirst;
+                            pxTCB->uxTaskSplitCore = uxSecond;
+                            pxTCB->xTaskSplitBudget = xBudget;
+
+                            /* Accounted by density, which keeps the first
+                             * core closed to tasks placed later. */
+                            ulCoreUtilisation[ uxFirst ] += taskEDF_UTILISATION( xBudget, xBudget );
+                            ulCoreUtilisation[ uxSecond ] += taskEDF_UTILISATION( pxTCB->xTaskWCET - xBudget, pxTCB->xTaskRelativeDeadline - xBudget );
+                            xReturn = pdPASS;
+                            break;
                         }
                         else
                         {
                             mtCOVERAGE_TEST_MARKER();
                         }
                     }
-                    else
-                    {
-                        /* The priority of the running task is being raised,
-                         * but the running task must already be the highest
-                         * priority task able to run so no yield is required. */
-                    }
-                }
-                else if( pxTCB == pxCurrentTCB )
-                {
-                    /* Setting the priority of the running task down means
-                     * there may now be another task of higher priority that
-                     * is ready to execute. */
-                    xYieldRequired = pdTRUE;
                 }
                 else
                 {
-                    /* Setting the priority of any other task down does not
-                     * require a yield as the running task must be above the
-                     * new priority of the task being modified. */
+                    mtCOVERAGE_TEST_MARKER();
                 }
+            }
 
-                /* Remember the ready list the task might be referenced from
-                 * before its uxPriority member is changed so the
-                 * taskRESET_READY_PRIORITY() macro can function correctly. */
-                uxPriorityUsedOnEntry = pxTCB->uxPriority;
-
-                #if ( configUSE_MUTEXES == 1 )
-                    {
-                        /* Only change the priority being used if the task is not
-                         * currently using an inherited priority. */
-                        if( pxTCB->uxBasePriority == pxTCB->uxPriority )
-                        {
-                            pxTCB->uxPriority = uxNewPriority;
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
 
-                        /* The base priority gets set whatever. */
-                        pxTCB->uxBasePriority = uxNewPriority;
-                    }
-                #else /* if ( configUSE_MUTEXES == 1 ) */
-                    {
-                        pxTCB->uxPriority = uxNewPriority;
-                    }
-                #endif /* if ( configUSE_MUTEXES == 1 ) */
+        static BaseType_t prvGetPieceOnCore( const TCB_t * pxTCB,
+                                             UBaseType_t uxCore,
+                                             TickType_t * pxExecutionTime,
+                                             TickType_t * pxRelativeDeadline )
+        {
+            BaseType_t xReturn = pdTRUE;
 
-                /* Only reset the event list item value if the value is not
-                 * being used for anything else. */
-                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+            if( pxTCB->uxTaskCore != uxCore )
+            {
+                if( pxTCB->uxTaskSplitCore == uxCore )
                 {
-                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                    *pxExecutionTime = pxTCB->xTaskWCET - pxTCB->xTaskSplitBudget;
+                    *pxRelativeDeadline = pxTCB->xTaskRelativeDeadline - pxTCB->xTaskSplitBudget;
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    xReturn = pdFALSE;
                 }
+            }
+            else if( pxTCB->uxTaskSplitCore != taskEDF_NOT_SPLIT )
+            {
+                *pxExecutionTime = pxTCB->xTaskSplitBudget;
+                *pxRelativeDeadline = pxTCB->xTaskSplitBudget;
+            }
+            else
+            {
+                *pxExecutionTime = pxTCB->xTaskWCET;
+                *pxRelativeDeadline = pxTCB->xTaskRelativeDeadline;
+            }
 
-                /* If the task is in the blocked or suspended list we need do
-                 * nothing more than change its priority variable. However, if
-                 * the task is in a ready list it needs to be removed and placed
-                 * in the list appropriate to its new priority. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        static BaseType_t prvCoreDemandTest( UBaseType_t uxCore,
+                                             TickType_t xExecutionTime,
+                                             TickType_t xRelativeDeadline,
+                                             TickType_t xPeriod )
+        {
+            /* Demand is summed in 32 bits whatever the tick type, and the busy
+             * period is given up on before the sum can overflow. */
+            const uint32_t ulHorizon = ( uint32_t ) 0x7fffffffUL / ( uint32_t ) ( configMAX_PERIODIC_TASKS + 1 );
+            uint32_t ulBusyPeriod, ulNext, ulDeadline, ulDemand;
+            TickType_t xC, xD, xT, xOtherC, xOtherD;
+            UBaseType_t uxIndex, uxOther;
+            BaseType_t xReturn = pdPASS, xOnCore;
+
+            /* The synchronous busy period bounds the instants that need to be
+             * checked.  It is the fixed point of w = sum( ceil( w / T ) * C ). */
+            ulBusyPeriod = ( uint32_t ) xExecutionTime;
+
+            for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
+            {
+                if( prvGetPieceOnCore( pxPeriodicTasks[ uxIndex ], uxCore, &xC, &xD ) != pdFALSE )
                 {
-                    /* The task is currently in its ready list - remove before
-                     * adding it to its new ready list.  As we are in a critical
-                     * section we can do this even if the scheduler is suspended. */
-                    if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-                    {
-                        /* It is known that the task is in its ready list so
-                         * there is no need to check again and the port level
-                         * reset macro can be called directly. */
-                        portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
-                    }
-                    else
+                    ulBusyPeriod += ( uint32_t ) xC;
+                }
+            }
+
+            for( ; ; )
+            {
+                ulNext = ( ( ulBusyPeriod + ( uint32_t ) xPeriod - 1UL ) / ( uint32_t ) xPeriod ) * ( uint32_t ) xExecutionTime;
+
+                for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
+                {
+                    if( prvGetPieceOnCore( pxPeriodicTasks[ uxIndex ], uxCore, &xC, &xD ) != pdFALSE )
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        ulNext += ( ( ulBusyPeriod + ( uint32_t ) pxPeriodicTasks[ uxIndex ]->xTaskPeriod - 1UL ) / ( uint32_t ) pxPeriodicTasks[ uxIndex ]->xTaskPeriod ) * ( uint32_t ) xC;
                     }
+                }
 
-                    prvAddTaskToReadyList( pxTCB );
+                if( ulNext == ulBusyPeriod )
+                {
+                    break;
+                }
+                else if( ulNext > ulHorizon )
+                {
+                    /* Utilisation above one, the busy period never ends. */
+                    xReturn = pdFAIL;
+                    break;
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    ulBusyPeriod = ulNext;
                 }
+            }
 
-                if( xYieldRequired != pdFALSE )
+            /* Every absolute deadline in the busy period must have no more
+             * demand before it than there is time.  uxIndex equal to the task
+             * count stands for the new piece. */
+            for( uxIndex = ( UBaseType_t ) 0U; ( uxIndex <= uxPeriodicTaskCount ) && ( xReturn == pdPASS ); uxIndex++ )
+            {
+                if( uxIndex == uxPeriodicTaskCount )
                 {
-                    taskYIELD_IF_USING_PREEMPTION();
+                    xD = xRelativeDeadline;
+                    xT = xPeriod;
+                    xOnCore = pdTRUE;
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    xT = pxPeriodicTasks[ uxIndex ]->xTaskPeriod;
+                    xOnCore = prvGetPieceOnCore( pxPeriodicTasks[ uxIndex ], uxCore, &xC, &xD );
                 }
 
-                /* Remove compiler warning about unused variables when the port
-                 * optimised task selection is not being used. */
-                ( void ) uxPriorityUsedOnEntry;
+                if( xOnCore != pdFALSE )
+                {
+                    for( ulDeadline = ( uint32_t ) xD; ( ulDeadline <= ulBusyPeriod ) && ( xReturn == pdPASS ); ulDeadline += ( uint32_t ) xT )
+                    {
+                        /* Demand of the jobs released and due in
+                         * [ 0, ulDeadline ]. */
+                        ulDemand = 0UL;
+
+                        if( ulDeadline >= ( uint32_t ) xRelativeDeadline )
+                        {
+                            ulDemand = ( ( ( ulDeadline - ( uint32_t ) xRelativeDeadline ) / ( uint32_t ) xPeriod ) + 1UL ) * ( uint32_t ) xExecutionTime;
+                        }
+
+                        for( uxOther = ( UBaseType_t ) 0U; uxOther < uxPeriodicTaskCount; uxOther++ )
+                        {
+                            if( ( prvGetPieceOnCore( pxPeriodicTasks[ uxOther ], uxCore, &xOtherC, &xOtherD ) != pdFALSE ) && ( ulDeadline >= ( uint32_t ) xOtherD ) )
+                            {
+                                ulDemand += ( ( ( ulDeadline - ( uint32_t ) xOtherD ) / ( uint32_t ) pxPeriodicTasks[ uxOther ]->xTaskPeriod ) + 1UL ) * ( uint32_t ) xOtherC;
+                            }
+                        }
+
+                        if( ulDemand > ulDeadline )
+                        {
+                            xReturn = pdFAIL;
+                        }
+                    }
+                }
             }
+
+            return xReturn;
         }
-        taskEXIT_CRITICAL();
-    }
 
-#endif /* INCLUDE_vTaskPrioritySet */
+    #endif /* configEDF_SPLIT_TASK_ANALYSIS */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
-
-    void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+    UBaseType_t uxTaskPeriodicGetCore( TaskHandle_t xTask )
     {
-        TCB_t * pxTCB;
+        TCB_t const * pxTCB;
+        UBaseType_t uxReturn;
 
         taskENTER_CRITICAL();
         {
-            /* If null is passed in here then it is the running task that is
-             * being suspended. */
-            pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+            pxTCB = prvGetTCBFromHandle( xTask );
+            uxReturn = pxTCB->uxTaskCore;
+        }
+        taskEXIT_CRITICAL();
 
-            traceTASK_SUSPEND( pxTCB );
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
 
-            /* Remove task from the ready/delayed list and place in the
-             * suspended list. */
-            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-            {
-                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+    uint32_t ulTaskPeriodicGetCoreUtilisation( UBaseType_t uxCore )
+    {
+        uint32_t ulReturn;
 
-            /* Is the task waiting on an event also? */
-            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-            {
-                ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+        configASSERT( uxCore < ( UBaseType_t ) configEDF_NUMBER_OF_CORES );
 
-            vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+        taskENTER_CRITICAL();
+        {
+            ulReturn = ulCoreUtilisation[ uxCore ];
+        }
+        taskEXIT_CRITICAL();
 
-            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
-                {
-                    BaseType_t x;
+        return ulReturn;
+    }
 
-                    for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
-                    {
-                        if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
-                        {
-                            /* The task was blocked to wait for a notification, but is
-                             * now suspended, so no notification was received. */
-                            pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
-                        }
-                    }
-                }
-            #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
-        }
-        taskEXIT_CRITICAL();
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) */
 
-        if( xSchedulerRunning != pdFALSE )
+
+/********************************************************************************/
+
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
+                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                  const uint32_t ulStackDepth,
+                                  void * const pvParameters,
+                                  UBaseType_t uxPriority,
+                                  TaskHandle_t * const pxCreatedTask,
+                                  TCB_t * pxNewTCB,
+                                  const MemoryRegion_t * const xRegions )
+{
+    StackType_t * pxTopOfStack;
+    UBaseType_t x;
+
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        /* Should the task be created in privileged mode? */
+        BaseType_t xRunPrivileged;
+
+        if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
         {
-            /* Reset the next expected unblock time in case it referred to the
-             * task that is now in the Suspended state. */
-            taskENTER_CRITICAL();
-            {
-                prvResetNextTaskUnblockTime();
-            }
-            taskEXIT_CRITICAL();
+            xRunPrivileged = pdTRUE;
         }
         else
         {
-            mtCOVERAGE_TEST_MARKER();
+            xRunPrivileged = pdFALSE;
         }
+        uxPriority &= ~portPRIVILEGE_BIT;
+    #endif /* portUSING_MPU_WRAPPERS == 1 */
 
-        if( pxTCB == pxCurrentTCB )
+    /* Avoid dependency on memset() if it is not required. */
+    #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
         {
-            if( xSchedulerRunning != pdFALSE )
-            {
-                /* The current task has just been suspended. */
-                configASSERT( uxSchedulerSuspended == 0 );
-                portYIELD_WITHIN_API();
-            }
-            else
-            {
-                /* The scheduler is not running, but the task that was pointed
-                 * to by pxCurrentTCB has just been suspended and pxCurrentTCB
-                 * must be adjusted to point to a different task. */
-                if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
-                {
-                    /* No other tasks are ready, so set pxCurrentTCB back to
-                     * NULL so when the next task is created pxCurrentTCB will
-                     * be set to point to it no matter what its relative priority
-                     * is. */
-                    pxCurrentTCB = NULL;
-                }
-                else
+            /* Fill the stack with a known value to assist debugging. */
+            ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+        }
+    #endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
+
+    /* Calculate the top of stack address.  This depends on whether the stack
+     * grows from high memory to low (as per the 80x86) or vice versa.
+     * portSTACK_GROWTH is used to make the result positive or negative as required
+     * by the port. */
+    #if ( portSTACK_GROWTH < 0 )
+        {
+            pxTopOfStack = &( pxNewTCB->pxStack[ ulStackDepth - ( uint32_t ) 1 ] );
+            pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type.  Checked by assert(). */
+
+            /* Check the alignment of the calculated top of stack is correct. */
+            configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+
+            #if ( configRECORD_STACK_HIGH_ADDRESS == 1 )
                 {
-                    vTaskSwitchContext();
+                    /* Also record the stack's high address, which may assist
+                     * debugging. */
+                    pxNewTCB->pxEndOfStack = pxTopOfStack;
                 }
-            }
+            #endif /* configRECORD_STACK_HIGH_ADDRESS */
         }
-        else
+    #else /* portSTACK_GROWTH */
         {
-            mtCOVERAGE_TEST_MARKER();
-        }
-    }
+            pxTopOfStack = pxNewTCB->pxStack;
 
-#endif /* INCLUDE_vTaskSuspend */
-/*-----------------------------------------------------------*/
+            /* Check the alignment of the stack buffer is correct. */
+            configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+            /* The other extreme of the stack space is required if stack checking is
+             * performed. */
+            pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
+        }
+    #endif /* portSTACK_GROWTH */
 
-    static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
+    /* Store the task name in the TCB. */
+    if( pcName != NULL )
     {
-        BaseType_t xReturn = pdFALSE;
-        const TCB_t * const pxTCB = xTask;
-
-        /* Accesses xPendingReadyList so must be called from a critical
-         * section. */
-
-        /* It does not make sense to check if the calling task is suspended. */
-        configASSERT( xTask );
-
-        /* Is the task being resumed actually in the suspended list? */
-        if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+        for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
         {
-            /* Has the task already been resumed from within an ISR? */
-            if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+            pxNewTCB->pcTaskName[ x ] = pcName[ x ];
+
+            /* Don't copy all configMAX_TASK_NAME_LEN if the string is shorter than
+             * configMAX_TASK_NAME_LEN characters just in case the memory after the
+             * string is not accessible (extremely unlikely). */
+            if( pcName[ x ] == ( char ) 0x00 )
             {
-                /* Is it in the suspended list because it is in the Suspended
-                 * state, or because is is blocked with no timeout? */
-                if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE ) /*lint !e961.  The cast is only redundant when NULL is used. */
-                {
-                    xReturn = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                break;
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
 
-        return xReturn;
-    } /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
-
-#endif /* INCLUDE_vTaskSuspend */
-/*-----------------------------------------------------------*/
+        /* Ensure the name string is terminated in the case that the string length
+         * was greater or equal to configMAX_TASK_NAME_LEN. */
+        pxNewTCB->pcTaskName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
+    }
+    else
+    {
+        /* The task has not been given a name, so just ensure there is a NULL
+         * terminator when it is read out. */
+        pxNewTCB->pcTaskName[ 0 ] = 0x00;
+    }
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+    /* This is used as an array index so must ensure it's not too large. */
+    configASSERT( uxPriority < configMAX_PRIORITIES );
 
-    void vTaskResume( TaskHandle_t xTaskToResume )
+    if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
     {
-        TCB_t * const pxTCB = xTaskToResume;
-
-        /* It does not make sense to resume the calling task. */
-        configASSERT( xTaskToResume );
+        uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
 
-        /* The parameter cannot be NULL as it is impossible to resume the
-         * currently executing task. */
-        if( ( pxTCB != pxCurrentTCB ) && ( pxTCB != NULL ) )
+    pxNewTCB->uxPriority = uxPriority;
+    #if ( configUSE_MUTEXES == 1 )
         {
-            taskENTER_CRITICAL();
-            {
-                if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
-                {
-                    traceTASK_RESUME( pxTCB );
+            pxNewTCB->uxBasePriority = uxPriority;
+            pxNewTCB->uxMutexesHeld = 0;
+        }
+    #endif /* configUSE_MUTEXES */
 
-                    /* The ready list can be accessed even if the scheduler is
-                     * suspended because this is inside a critical section. */
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+    vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
+    vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
-                    /* A higher priority task may have just been resumed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-                    {
-                        /* This yield may not cause the task just resumed to run,
-                         * but will leave the lists in the correct state for the
-                         * next yield. */
-                        taskYIELD_IF_USING_PREEMPTION();
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-            taskEXIT_CRITICAL();
-        }
-        else
+    /* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
+     * back to  the containing TCB from a generic item in a list. */
+    listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
+
+    /* Event lists are always in priority order. */
+    listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+    listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
+
+    #if ( portCRITICAL_NESTING_IN_TCB == 1 )
         {
-            mtCOVERAGE_TEST_MARKER();
+            pxNewTCB->uxCriticalNesting = ( UBaseType_t ) 0U;
         }
-    }
+    #endif /* portCRITICAL_NESTING_IN_TCB */
 
-#endif /* INCLUDE_vTaskSuspend */
+    /* Tasks not created by xTaskPeriodicCreate() have no period. */
+    pxNewTCB->xTaskPeriod = ( TickType_t ) 0U;
+    pxNewTCB->xTaskRelativeDeadline = ( TickType_t ) 0U;
+    pxNewTCB->xTaskWCET = ( TickType_t ) 0U;
+    pxNewTCB->uxTaskDeadlineMisses = ( UBaseType_t ) 0U;
+    #if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+        {
+            pxNewTCB->pxTaskReleaseTime = NULL;
+        }
+    #endif
+    #if ( configUSE_JOB_HISTOGRAMS == 1 )
+        {
+            pxNewTCB->ulJobReleaseTime = 0UL;
+            pxNewTCB->ulJobRelativeDeadline = 0UL;
+            pxNewTCB->xJobStarted = pdFALSE;
+            pxNewTCB->ulJobCount = 0UL;
+            ( void ) memset( ( void * ) pxNewTCB->ulJobMax, 0x00, sizeof( pxNewTCB->ulJobMax ) );
+            ( void ) memset( ( void * ) pxNewTCB->ulJobHistogram, 0x00, sizeof( pxNewTCB->ulJobHistogram ) );
+        }
+    #endif
+    #if ( configUSE_CPU_LOAD_WINDOWS == 1 )
+        {
+            pxNewTCB->ulTaskLoadRunTime = ( configRUN_TIME_COUNTER_TYPE ) 0;
+            pxNewTCB->uxTaskLoadShare = ( UBaseType_t ) 0U;
+        }
+    #endif
+    #if ( configUSE_STACK_REPORT == 1 )
+        {
+            pxNewTCB->uxStackDepth = ( configSTACK_DEPTH_TYPE ) ulStackDepth;
+        }
+    #endif
+    #if ( configUSE_KERNEL_PROFILING == 1 )
+        {
+            pxNewTCB->uxProfileCriticalNesting = ( UBaseType_t ) 0U;
+            pxNewTCB->ulProfileCriticalStart = 0UL;
+            pxNewTCB->ulProfileCriticalTime = 0UL;
+        }
+    #endif
+    #if ( configUSE_ISR_LATENCY == 1 )
+        {
+            pxNewTCB->uxLatencySource = ( UBaseType_t ) 0U;
+            pxNewTCB->ulLatencyStart = 0UL;
+        }
+    #endif
+    #if ( configUSE_EDF_SCHEDULER == 0 )
+        {
+            pxNewTCB->xTaskResponseTime = ( TickType_t ) 0U;
+        }
+    #elif ( configUSE_EDF_FINE_DEADLINES == 1 )
+        {
+            pxNewTCB->ulTaskRelativeDeadline = 0UL;
+            pxNewTCB->ulTaskAbsoluteDeadline = 0UL;
+        }
+    #endif /* configUSE_EDF_SCHEDULER */
 
-/*-----------------------------------------------------------*/
+    #if ( configUSE_APPLICATION_TASK_TAG == 1 )
+        {
+            pxNewTCB->pxTaskTag = NULL;
+        }
+    #endif /* configUSE_APPLICATION_TASK_TAG */
 
-#if ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
-
-    BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume )
-    {
-        BaseType_t xYieldRequired = pdFALSE;
-        TCB_t * const pxTCB = xTaskToResume;
-        UBaseType_t uxSavedInterruptStatus;
+    #if ( configGENERATE_RUN_TIME_STATS == 1 )
+        {
+            pxNewTCB->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
+        }
+    #endif /* configGENERATE_RUN_TIME_STATS */
 
-        configASSERT( xTaskToResume );
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        {
+            vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
+        }
+    #else
+        {
+            /* Avoid compiler warning about unreferenced parameter. */
+            ( void ) xRegions;
+        }
+    #endif
 
-        /* RTOS ports that support interrupt nesting have the concept of a
-         * maximum  system call (or maximum API call) interrupt priority.
-         * Interrupts that are  above the maximum system call priority are keep
-         * permanently enabled, even when the RTOS kernel is in a critical section,
-         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-         * is defined in FreeRTOSConfig.h then
-         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-         * failure if a FreeRTOS API function is called from an interrupt that has
-         * been assigned a priority above the configured maximum system call
-         * priority.  Only FreeRTOS functions that end in FromISR can be called
-         * from interrupts  that have been assigned a priority at or (logically)
-         * below the maximum system call interrupt priority.  FreeRTOS maintains a
-         * separate interrupt safe API to ensure interrupt entry is as fast and as
-         * simple as possible.  More information (albeit Cortex-M specific) is
-         * provided on the following link:
-         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+    #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+        {
+            memset( ( void * ) &( pxNewTCB->pvThreadLocalStoragePointers[ 0 ] ), 0x00, sizeof( pxNewTCB->pvThreadLocalStoragePointers ) );
+        }
+    #endif
 
-        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
         {
-            if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
-            {
-                traceTASK_RESUME_FROM_ISR( pxTCB );
+            memset( ( void * ) &( pxNewTCB->ulNotifiedValue[ 0 ] ), 0x00, sizeof( pxNewTCB->ulNotifiedValue ) );
+            memset( ( void * ) &( pxNewTCB->ucNotifyState[ 0 ] ), 0x00, sizeof( pxNewTCB->ucNotifyState ) );
+        }
+    #endif
 
-                /* Check the ready lists can be accessed. */
-                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-                {
-                    /* Ready lists can be accessed so move the task from the
-                     * suspended list to the ready list directly. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-                    {
-                        xYieldRequired = pdTRUE;
+    #if ( configUSE_NEWLIB_REENTRANT == 1 )
+        {
+            /* Initialise this task's Newlib reent structure.
+             * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+             * for additional information. */
+            _REENT_INIT_PTR( ( &( pxNewTCB->xNewLib_reent ) ) );
+        }
+    #endif
 
-                        /* Mark that a yield is pending in case the user is not
-                         * using the return value to initiate a context switch
-                         * from the ISR using portYIELD_FROM_ISR. */
-                        xYieldPending = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+    #if ( INCLUDE_xTaskAbortDelay == 1 )
+        {
+            pxNewTCB->ucDelayAborted = pdFALSE;
+        }
+    #endif
 
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+    /* Initialize the TCB stack to look as if the task was already running,
+     * but had been interrupted by the scheduler.  The return address is set
+     * to the start of the task function. Once the stack has been initialised
+     * the top of stack variable is updated. */
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        {
+            /* If the port has capability to detect stack overflow,
+             * pass the stack end address to the stack initialization
+             * function as well. */
+            #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+                {
+                    #if ( portSTACK_GROWTH < 0 )
+                        {
+                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
+                        }
+                    #else /* portSTACK_GROWTH */
+                        {
+                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+                        }
+                    #endif /* portSTACK_GROWTH */
                 }
-                else
+            #else /* portHAS_STACK_OVERFLOW_CHECKING */
                 {
-                    /* The delayed or ready lists cannot be accessed so the task
-                     * is held in the pending ready list until the scheduler is
-                     * unsuspended. */
-                    vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                    pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
                 }
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+            #endif /* portHAS_STACK_OVERFLOW_CHECKING */
         }
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    #else /* portUSING_MPU_WRAPPERS */
+        {
+            /* If the port has capability to detect stack overflow,
+             * pass the stack end address to the stack initialization
+             * function as well. */
+            #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+                {
+                    #if ( portSTACK_GROWTH < 0 )
+                        {
+                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
+                        }
+                    #else /* portSTACK_GROWTH */
+                        {
+                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
+                        }
+                    #endif /* portSTACK_GROWTH */
+                }
+            #else /* portHAS_STACK_OVERFLOW_CHECKING */
+                {
+                    pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+                }
+            #endif /* portHAS_STACK_OVERFLOW_CHECKING */
+        }
+    #endif /* portUSING_MPU_WRAPPERS */
 
-        return xYieldRequired;
+    if( pxCreatedTask != NULL )
+    {
+        /* Pass the handle out in an anonymous way.  The handle can be used to
+         * change the created task's priority, delete the created task, etc.*/
+        *pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
     }
-
-#endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
 /*-----------------------------------------------------------*/
 
-void vTaskStartScheduler( void )
+static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 {
-    BaseType_t xReturn;
+    /* Ensure interrupts don't access the task lists while the lists are being
+     * updated. */
+    taskENTER_CRITICAL();
+    {
+        uxCurrentNumberOfTasks++;
 
-    /* Add the idle task at the lowest priority. */
-    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        if( pxCurrentTCB == NULL )
         {
-            StaticTask_t * pxIdleTaskTCBBuffer = NULL;
-            StackType_t * pxIdleTaskStackBuffer = NULL;
-            uint32_t ulIdleTaskStackSize;
-
-            /* The Idle task is created using user provided RAM - obtain the
-             * address of the RAM then create the idle task. */
-            vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
-            xIdleTaskHandle = xTaskCreateStatic( prvIdleTask,
-                                                 configIDLE_TASK_NAME,
-                                                 ulIdleTaskStackSize,
-                                                 ( void * ) NULL,       /*lint !e961.  The cast is not redundant for all compilers. */
-                                                 portPRIVILEGE_BIT,     /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-                                                 pxIdleTaskStackBuffer,
-                                                 pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+            /* There are no other tasks, or all the other tasks are in
+             * the suspended state - make this the current task. */
+            pxCurrentTCB = pxNewTCB;
 
-            if( xIdleTaskHandle != NULL )
+            if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
             {
-                xReturn = pdPASS;
+                /* This is the first task to be created so do the preliminary
+                 * initialisation required.  We will not recover if this call
+                 * fails, but we will report the failure. */
+                prvInitialiseTaskLists();
             }
             else
             {
-                xReturn = pdFAIL;
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-    #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
-	/***************************************************************/
-	/* initializes the IDLE task and inserts it into the Ready List */ 
-        {
-            #if (configUSE_EDF_SCHEDULER == 1)
-				{
-				 xIDLEPeriod = 200;
-
-					xReturn = xTaskPeriodicCreate( prvIdleTask,
-							configIDLE_TASK_NAME,
-							configMINIMAL_STACK_SIZE,
-							( void * ) NULL,
-							portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-							&xIdleTaskHandle, /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
-							xIDLEPeriod);
-				}
-				
-#else
-				{
-					/* The Idle task is being created using dynamically allocated RAM. */
-					xReturn = xTaskCreate( prvIdleTask,
-							configIDLE_TASK_NAME,
-							configMINIMAL_STACK_SIZE,
-							( void * ) NULL,
-							portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-							&xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
-
-				}
-#endif
-			}
-#endif /* configSUPPORT_STATIC_ALLOCATION */
-
-    #if ( configUSE_TIMERS == 1 )
+        else
         {
-            if( xReturn == pdPASS )
+            /* If the scheduler is not already running, make this task the
+             * current task if it is the highest priority task to be created
+             * so far. */
+			 
+            if( xSchedulerRunning == pdFALSE )
             {
-                xReturn = xTimerCreateTimerTask();
+				/*******************************************************************/
+                /* Select Current Task if not Running */ 
+				#if (configUSE_EDF_SCHEDULER == 0)
+                    if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
+                    {
+                        pxCurrentTCB = pxNewTCB;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+				#else
+					/* Selected once the task is in its ready list, below. */
+					mtCOVERAGE_TEST_MARKER();
+				#endif
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-    #endif /* configUSE_TIMERS */
 
-    if( xReturn == pdPASS )
-    {
-        /* freertos_tasks_c_additions_init() should only be called if the user
-         * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
-         * the only macro called by the function. */
-        #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+        uxTaskNumber++;
+/*******************************************************************/
+
+        #if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_LOWEST_ID ) || ( configUSE_TRACE_RECORDER == 1 ) || ( configUSE_GPIO_TASK_TRACE == 1 ) )
             {
-                freertos_tasks_c_additions_init();
+                /* Add a counter into the TCB for tracing, and as the ID that
+                 * breaks EDF deadline ties. */
+                pxNewTCB->uxTCBNumber = uxTaskNumber;
             }
-        #endif
-
-        /* Interrupts are turned off here, to ensure a tick does not occur
-         * before or during the call to xPortStartScheduler().  The stacks of
-         * the created tasks contain a status word with interrupts switched on
-         * so interrupts will automatically get re-enabled when the first task
-         * starts to run. */
-        portDISABLE_INTERRUPTS();
+        #endif /* configUSE_TRACE_FACILITY */
+        traceTASK_CREATE( pxNewTCB );
 
-        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+        #if ( configUSE_TRACE_RECORDER == 1 )
             {
-                /* Switch Newlib's _impure_ptr variable to point to the _reent
-                 * structure specific to the task that will run first.
-                 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-                 * for additional information. */
-                _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+                UBaseType_t uxChar, uxLength;
+
+                /* The name goes with the ID so the host can tell the tasks
+                 * apart, four characters to a record, the terminator
+                 * included. */
+                taskTRACE_RECORD( taskTRACE_CREATE, pxNewTCB, pxNewTCB->uxPriority );
+
+                for( uxLength = ( UBaseType_t ) 0U; ( uxLength < ( UBaseType_t ) configMAX_TASK_NAME_LEN ) && ( pxNewTCB->pcTaskName[ uxLength ] != ( char ) 0x00 ); uxLength++ )
+                {
+                }
+
+                for( uxChar = ( UBaseType_t ) 0U; ( uxChar <= uxLength ) && ( uxChar < ( UBaseType_t ) configMAX_TASK_NAME_LEN ); uxChar += ( UBaseType_t ) 4U )
+                {
+                    taskTRACE_RECORD( taskTRACE_NAME, pxNewTCB, uxChar );
+                }
             }
-        #endif /* configUSE_NEWLIB_REENTRANT */
+        #endif
 
-        xNextTaskUnblockTime = portMAX_DELAY;
-        xSchedulerRunning = pdTRUE;
-        xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+        /* The first job of a periodic task is released now. */
+        taskJOB_RELEASED( pxNewTCB, xTickCount );
 
-        /* If configGENERATE_RUN_TIME_STATS is defined then the following
-         * macro must be defined to configure the timer/counter used to generate
-         * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
-         * is set to 0 and the following line fails to build then ensure you do not
-         * have portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() defined in your
-         * FreeRTOSConfig.h file. */
-        portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+        prvAddTaskToReadyList( pxNewTCB );
 
-        traceTASK_SWITCHED_IN();
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            if( xSchedulerRunning == pdFALSE )
+            {
+                /* Start with the task the scheduler itself would select, so
+                 * deadline ties are broken the same way as at run time. */
+                taskSELECT_HIGHEST_PRIORITY_TASK();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        #endif
 
-        /* Setting up the timer tick is hardware specific and thus in the
-         * portable interface. */
-        if( xPortStartScheduler() != pdFALSE )
+        portSETUP_TCB( pxNewTCB );
+    }
+    taskEXIT_CRITICAL();
+
+    if( xSchedulerRunning != pdFALSE )
+    {
+        /* If the created task is of a higher priority than the current task
+         * then it should run now. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            if( ( pxNewTCB != pxCurrentTCB ) && ( taskEDF_SHOULD_PREEMPT( pxNewTCB ) ) )
+        #else
+            if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+        #endif
         {
-            /* Should not reach here as if the scheduler is running the
-             * function will not return. */
+            taskYIELD_IF_USING_PREEMPTION();
         }
         else
         {
-            /* Should only reach here if a task calls xTaskEndScheduler(). */
+            mtCOVERAGE_TEST_MARKER();
         }
     }
     else
     {
-        /* This line will only be reached if the kernel could not be started,
-         * because there was not enough FreeRTOS heap to create the idle task
-         * or the timer task. */
-        configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
+        mtCOVERAGE_TEST_MARKER();
     }
-
-    /* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
-     * meaning xIdleTaskHandle is not used anywhere else. */
-    ( void ) xIdleTaskHandle;
-
-    /* OpenOCD makes use of uxTopUsedPriority for thread debugging. Prevent uxTopUsedPriority
-     * from getting optimized out as it is no longer used by the kernel. */
-    ( void ) uxTopUsedPriority;
 }
 /*-----------------------------------------------------------*/
 
-void vTaskEndScheduler( void )
-{
-    /* Stop the scheduler interrupts and call the portable scheduler end
-     * routine so the original ISRs can be restored if necessary.  The port
-     * layer must ensure interrupts enable  bit is left in the correct state. */
-    portDISABLE_INTERRUPTS();
-    xSchedulerRunning = pdFALSE;
-    vPortEndScheduler();
-}
-/*----------------------------------------------------------*/
+#if ( INCLUDE_vTaskDelete == 1 )
 
-void vTaskSuspendAll( void )
-{
-    /* A critical section is not required as the variable is of type
-     * BaseType_t.  Please read Richard Barry's reply in the following link to a
-     * post in the FreeRTOS support forum before reporting this as a bug! -
-     * https://goo.gl/wu4acr */
+    void vTaskDelete( TaskHandle_t xTaskToDelete )
+    {
+        TCB_t * pxTCB;
 
-    /* portSOFTWARE_BARRIER() is only implemented for emulated/simulated ports that
-     * do not otherwise exhibit real time behaviour. */
-    portSOFTWARE_BARRIER();
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the calling task that is
+             * being deleted. */
+            pxTCB = prvGetTCBFromHandle( xTaskToDelete );
 
-    /* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
-     * is used to allow calls to vTaskSuspendAll() to nest. */
-    ++uxSchedulerSuspended;
+            if( pxTCB->xTaskPeriod != ( TickType_t ) 0U )
+            {
+                prvRemovePeriodicTask( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-    /* Enforces ordering for ports and optimised compilers that may otherwise place
-     * the above increment elsewhere. */
-    portMEMORY_BARRIER();
-}
-/*----------------------------------------------------------*/
+            /* Remove task from the ready/delayed list. */
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
+            /* Is the task waiting on an event also? */
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+            {
+                ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-    static TickType_t prvGetExpectedIdleTime( void )
-    {
-        TickType_t xReturn;
-        UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+            /* Increment the uxTaskNumber also so kernel aware debuggers can
+             * detect that the task lists need re-generating.  This is done before
+             * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
+             * not return. */
+            uxTaskNumber++;
 
-        /* uxHigherPriorityReadyTasks takes care of the case where
-         * configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
-         * task that are in the Ready state, even though the idle task is
-         * running. */
-        #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+            if( pxTCB == pxCurrentTCB )
             {
-                if( uxTopReadyPriority > tskIDLE_PRIORITY )
-                {
-                    uxHigherPriorityReadyTasks = pdTRUE;
-                }
+                /* A task is deleting itself.  This cannot complete within the
+                 * task itself, as a context switch to another task is required.
+                 * Place the task in the termination list.  The idle task will
+                 * check the termination list and free up any memory allocated by
+                 * the scheduler for the TCB and stack of the deleted task. */
+                vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
+
+                /* Increment the ucTasksDeleted variable so the idle task knows
+                 * there is a task that has been deleted and that it should therefore
+                 * check the xTasksWaitingTermination list. */
+                ++uxDeletedTasksWaitingCleanUp;
+
+                /* Call the delete hook before portPRE_TASK_DELETE_HOOK() as
+                 * portPRE_TASK_DELETE_HOOK() does not return in the Win32 port. */
+                traceTASK_DELETE( pxTCB );
+
+                /* The pre-delete hook is primarily for the Windows simulator,
+                 * in which Windows specific clean up operations are performed,
+                 * after which it is not possible to yield away from this task -
+                 * hence xYieldPending is used to latch that a context switch is
+                 * required. */
+                portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
             }
-        #else
+            else
             {
-                const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
+                --uxCurrentNumberOfTasks;
+                traceTASK_DELETE( pxTCB );
 
-                /* When port optimised task selection is used the uxTopReadyPriority
-                 * variable is used as a bit map.  If bits other than the least
-                 * significant bit are set then there are tasks that have a priority
-                 * above the idle priority that are in the Ready state.  This takes
-                 * care of the case where the co-operative scheduler is in use. */
-                if( uxTopReadyPriority > uxLeastSignificantBit )
-                {
-                    uxHigherPriorityReadyTasks = pdTRUE;
-                }
+                /* Reset the next expected unblock time in case it referred to
+                 * the task that has just been deleted. */
+                prvResetNextTaskUnblockTime();
             }
-        #endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
-
-        if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
-        {
-            xReturn = 0;
-        }
-        else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
-        {
-            /* There are other idle priority tasks in the ready state.  If
-             * time slicing is used then the very next tick interrupt must be
-             * processed. */
-            xReturn = 0;
         }
-        else if( uxHigherPriorityReadyTasks != pdFALSE )
+        taskEXIT_CRITICAL();
+
+        /* If the task is not deleting itself, call prvDeleteTCB from outside of
+         * critical section. If a task deletes itself, prvDeleteTCB is called
+         * from prvCheckTasksWaitingTermination which is called from Idle task. */
+        if( pxTCB != pxCurrentTCB )
         {
-            /* There are tasks in the Ready state that have a priority above the
-             * idle priority.  This path can only be reached if
-             * configUSE_PREEMPTION is 0. */
-            xReturn = 0;
+            prvDeleteTCB( pxTCB );
         }
-        else
+
+        /* Force a reschedule if it is the currently running task that has just
+         * been deleted. */
+        if( xSchedulerRunning != pdFALSE )
         {
-            xReturn = xNextTaskUnblockTime - xTickCount;
+            if( pxTCB == pxCurrentTCB )
+            {
+                configASSERT( uxSchedulerSuspended == 0 );
+                portYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-
-        return xReturn;
     }
 
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
-
-BaseType_t xTaskResumeAll( void )
-{
-    TCB_t * pxTCB = NULL;
-    BaseType_t xAlreadyYielded = pdFALSE;
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
 
-    /* If uxSchedulerSuspended is zero then this function does not match a
-     * previous call to vTaskSuspendAll(). */
-    configASSERT( uxSchedulerSuspended );
+#if ( INCLUDE_xTaskDelayUntil == 1 )
 
-    /* It is possible that an ISR caused a task to be removed from an event
-     * list while the scheduler was suspended.  If this was the case then the
-     * removed task will have been added to the xPendingReadyList.  Once the
-     * scheduler has been resumed it is safe to move all the pending ready
-     * tasks from this list into their appropriate ready list. */
-    taskENTER_CRITICAL();
+    BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
+                                const TickType_t xTimeIncrement )
     {
-        --uxSchedulerSuspended;
+        TickType_t xTimeToWake;
+        BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
 
-        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+        configASSERT( pxPreviousWakeTime );
+        configASSERT( ( xTimeIncrement > 0U ) );
+        configASSERT( uxSchedulerSuspended == 0 );
+
+        vTaskSuspendAll();
         {
-            if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
-            {
-                /* Move any readied tasks from the pending list into the
-                 * appropriate ready list. */
-                while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
+            /* Minor optimisation.  The tick count cannot change in this
+             * block. */
+            TickType_t xConstTickCount;
+
+            #if ( configUSE_EVENT_DRIVEN_TICK == 1 )
                 {
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
-                    portMEMORY_BARRIER();
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+                    /* The ticks since the last tick interrupt are held
+                     * pending, as the scheduler is suspended. */
+                    taskENTER_CRITICAL();
+                    taskCATCH_UP_EVENT_TICKS();
+                    taskEXIT_CRITICAL();
+                }
+            #endif
 
-                    /* If the moved task has a priority higher than or equal to
-                     * the current task then a yield must be performed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-                    {
-                        xYieldPending = pdTRUE;
-                    }
-                    else
+            xConstTickCount = xTickCount;
+
+            if( ( pxCurrentTCB->xTaskPeriod != ( TickType_t ) 0U ) && ( xTimeIncrement == pxCurrentTCB->xTaskPeriod ) )
+            {
+                /* A periodic task completes the job released at
+                 * *pxPreviousWakeTime.  It missed its deadline if that has
+                 * already gone. */
+                if( ( TickType_t ) ( ( *pxPreviousWakeTime + pxCurrentTCB->xTaskRelativeDeadline ) - xConstTickCount ) > ( portMAX_DELAY >> 1 ) )
+                {
+                    /* Suspending the scheduler does not stop the tick
+                     * interrupt counting misses and recording too. */
+                    taskENTER_CRITICAL();
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        ( pxCurrentTCB->uxTaskDeadlineMisses )++;
+                        taskDEADLINES_MISSED( pxCurrentTCB, 1U );
                     }
+                    taskEXIT_CRITICAL();
                 }
-
-                if( pxTCB != NULL )
+                else
                 {
-                    /* A task was unblocked while the scheduler was suspended,
-                     * which may have prevented the next unblock time from being
-                     * re-calculated, in which case re-calculate it now.  Mainly
-                     * important for low power tickless implementations, where
-                     * this can prevent an unnecessary exit from low power
-                     * state. */
-                    prvResetNextTaskUnblockTime();
+                    mtCOVERAGE_TEST_MARKER();
                 }
 
-                /* If any ticks occurred while the scheduler was suspended then
-                 * they should be processed now.  This ensures the tick count does
-                 * not  slip, and that any delayed tasks are resumed at the correct
-                 * time. */
-                {
-                    TickType_t xPendedCounts = xPendedTicks; /* Non-volatile copy. */
-
-                    if( xPendedCounts > ( TickType_t ) 0U )
+                #if ( configUSE_JOB_HISTOGRAMS == 1 )
                     {
-                        do
-                        {
-                            if( xTaskIncrementTick() != pdFALSE )
-                            {
-                                xYieldPending = pdTRUE;
-                            }
-                            else
-                            {
-                                mtCOVERAGE_TEST_MARKER();
-                            }
+                        uint32_t ulResponse;
 
-                            --xPendedCounts;
-                        } while( xPendedCounts > ( TickType_t ) 0U );
+                        ulResponse = ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE() - pxCurrentTCB->ulJobReleaseTime;
 
-                        xPendedTicks = 0;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
+                        prvJobHistogramAdd( pxCurrentTCB, taskJOB_RESPONSE_TIME, ulResponse );
+                        prvJobHistogramAdd( pxCurrentTCB, taskJOB_LATENESS, ( ulResponse > pxCurrentTCB->ulJobRelativeDeadline ) ? ( ulResponse - pxCurrentTCB->ulJobRelativeDeadline ) : 0UL );
+                        ( pxCurrentTCB->ulJobCount )++;
                     }
-                }
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-                if( xYieldPending != pdFALSE )
+            /* Generate the tick time at which the task wants to wake. */
+            xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+
+            if( xConstTickCount < *pxPreviousWakeTime )
+            {
+                /* The tick count has overflowed since this function was
+                 * lasted called.  In this case the only time we should ever
+                 * actually delay is if the wake time has also  overflowed,
+                 * and the wake time is greater than the tick time.  When this
+                 * is the case it is as if neither time had overflowed. */
+                if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
                 {
-                    #if ( configUSE_PREEMPTION != 0 )
-                        {
-                            xAlreadyYielded = pdTRUE;
-                        }
-                    #endif
-                    taskYIELD_IF_USING_PREEMPTION();
+                    xShouldDelay = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* The tick time has not overflowed.  In this case we will
+                 * delay if either the wake time has overflowed, and/or the
+                 * tick time is less than the wake time. */
+                if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+                {
+                    xShouldDelay = pdTRUE;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
+
+            /* Update the wake time ready for the next call. */
+            *pxPreviousWakeTime = xTimeToWake;
+
+            if( xShouldDelay != pdFALSE )
+            {
+                traceTASK_DELAY_UNTIL( xTimeToWake );
+
+                #if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+                    {
+                        if( ( pxCurrentTCB->xTaskPeriod != ( TickType_t ) 0U ) && ( xTimeIncrement == pxCurrentTCB->xTaskPeriod ) )
+                        {
+                            /* Lets a catch-up move the wake time on past the
+                             * releases the task has to skip. */
+                            pxCurrentTCB->pxTaskReleaseTime = pxPreviousWakeTime;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif
+
+                #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+                    if( ( pxCurrentTCB->xTaskPeriod != ( TickType_t ) 0U ) && ( pxCurrentTCB->uxPriority == configEDF_PRIORITY_BAND ) )
+                    {
+                        /* A periodic task waits for its next release in the
+                         * release queue. */
+                        prvAddCurrentTaskToReleaseList( xTimeToWake, xConstTickCount );
+                    }
+                    else
+                #endif
+                {
+                    /* prvAddCurrentTaskToDelayedList() needs the block time,
+                     * not the time to wake, so subtract the current tick
+                     * count. */
+                    prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        /* Force a reschedule if xTaskResumeAll has not already done so, we may
+         * have put ourselves to sleep. */
+        if( xAlreadyYielded == pdFALSE )
+        {
+            portYIELD_WITHIN_API();
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
-    }
-    taskEXIT_CRITICAL();
-
-    return xAlreadyYielded;
-}
-/*-----------------------------------------------------------*/
 
-TickType_t xTaskGetTickCount( void )
-{
-    TickType_t xTicks;
+        #if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+            {
+                /* The task runs again, so no catch-up may write the wake
+                 * time any more. */
+                pxCurrentTCB->pxTaskReleaseTime = NULL;
+            }
+        #endif
 
-    /* Critical section required if running on a 16 bit processor. */
-    portTICK_TYPE_ENTER_CRITICAL();
-    {
-        xTicks = xTickCount;
+        return xShouldDelay;
     }
-    portTICK_TYPE_EXIT_CRITICAL();
 
-    return xTicks;
-}
+#endif /* INCLUDE_xTaskDelayUntil */
 /*-----------------------------------------------------------*/
 
-TickType_t xTaskGetTickCountFromISR( void )
-{
-    TickType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
-
-    /* RTOS ports that support interrupt nesting have the concept of a maximum
-     * system call (or maximum API call) interrupt priority.  Interrupts that are
-     * above the maximum system call priority are kept permanently enabled, even
-     * when the RTOS kernel is in a critical section, but cannot make any calls to
-     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-     * failure if a FreeRTOS API function is called from an interrupt that has been
-     * assigned a priority above the configured maximum system call priority.
-     * Only FreeRTOS functions that end in FromISR can be called from interrupts
-     * that have been assigned a priority at or (logically) below the maximum
-     * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
-     * safe API to ensure interrupt entry is as fast and as simple as possible.
-     * More information (albeit Cortex-M specific) is provided on the following
-     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+#if ( INCLUDE_vTaskDelay == 1 )
 
-    uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+    void vTaskDelay( const TickType_t xTicksToDelay )
     {
-        xReturn = xTickCount;
-    }
-    portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        BaseType_t xAlreadyYielded = pdFALSE;
 
-    return xReturn;
-}
-/*-----------------------------------------------------------*/
+        /* A delay time of zero just forces a reschedule. */
+        if( xTicksToDelay > ( TickType_t ) 0U )
+        {
+            configASSERT( uxSchedulerSuspended == 0 );
+            vTaskSuspendAll();
+            {
+                traceTASK_DELAY();
 
-UBaseType_t uxTaskGetNumberOfTasks( void )
-{
-    /* A critical section is not required because the variables are of type
-     * BaseType_t. */
-    return uxCurrentNumberOfTasks;
-}
-/*-----------------------------------------------------------*/
+                /* A task that is removed from the event list while the
+                 * scheduler is suspended will not get placed in the ready
+                 * list or removed from the blocked list until the scheduler
+                 * is resumed.
+                 *
+                 * This task cannot be in an event list as it is the currently
+                 * executing task. */
+                prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+            }
+            xAlreadyYielded = xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-    TCB_t * pxTCB;
+        /* Force a reschedule if xTaskResumeAll has not already done so, we may
+         * have put ourselves to sleep. */
+        if( xAlreadyYielded == pdFALSE )
+        {
+            portYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
 
-    /* If null is passed in here then the name of the calling task is being
-     * queried. */
-    pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-    configASSERT( pxTCB );
-    return &( pxTCB->pcTaskName[ 0 ] );
-}
+#endif /* INCLUDE_vTaskDelay */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_xTaskAbortDelay == 1 ) )
 
-    static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
-                                                     const char pcNameToQuery[] )
+    eTaskState eTaskGetState( TaskHandle_t xTask )
     {
-        TCB_t * pxNextTCB, * pxFirstTCB, * pxReturn = NULL;
-        UBaseType_t x;
-        char cNextChar;
-        BaseType_t xBreakLoop;
+        eTaskState eReturn;
+        List_t const * pxStateList;
+        const TCB_t * const pxTCB = xTask;
 
-        /* This function is called with the scheduler suspended. */
+        #if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+            List_t const * pxDelayedList, * pxOverflowedDelayedList;
+        #endif
 
-        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
-        {
-            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+        configASSERT( pxTCB );
 
-            do
+        if( pxTCB == pxCurrentTCB )
+        {
+            /* The task calling this function is querying its own state. */
+            eReturn = eRunning;
+        }
+        else
+        {
+            taskENTER_CRITICAL();
             {
-                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
 
-                /* Check each character in the name looking for a match or
-                 * mismatch. */
-                xBreakLoop = pdFALSE;
+                #if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+                    {
+                        pxDelayedList = pxDelayedTaskList;
+                        pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+                    }
+                #endif
+            }
+            taskEXIT_CRITICAL();
 
-                for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                if( ( pxStateList >= &( xDelayedTaskWheel[ 0 ] ) ) && ( pxStateList <= &( xDelayedTaskWheel[ configDELAYED_TASK_WHEEL_SIZE - 1 ] ) ) )
+            #else
+                if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+            #endif
+            {
+                /* The task being queried is referenced from one of the Blocked
+                 * lists. */
+                eReturn = eBlocked;
+            }
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+                else if( ( pxStateList == &xReleaseList1 ) || ( pxStateList == &xReleaseList2 ) )
                 {
-                    cNextChar = pxNextTCB->pcTaskName[ x ];
+                    /* The periodic task is waiting for its next release. */
+                    eReturn = eBlocked;
+                }
+            #endif
 
-                    if( cNextChar != pcNameToQuery[ x ] )
-                    {
-                        /* Characters didn't match. */
-                        xBreakLoop = pdTRUE;
-                    }
-                    else if( cNextChar == ( char ) 0x00 )
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                else if( pxStateList == &xSuspendedTaskList )
+                {
+                    /* The task being queried is referenced from the suspended
+                     * list.  Is it genuinely suspended or is it blocked
+                     * indefinitely? */
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
                     {
-                        /* Both strings terminated, a match must have been
-                         * found. */
-                        pxReturn = pxNextTCB;
-                        xBreakLoop = pdTRUE;
+                        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                            {
+                                BaseType_t x;
+
+                                /* The task does not appear on the event list item of
+                                 * and of the RTOS objects, but could still be in the
+                                 * blocked state if it is waiting on its notification
+                                 * rather than waiting on an object.  If not, is
+                                 * suspended. */
+                                eReturn = eSuspended;
+
+                                for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+                                {
+                                    if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                                    {
+                                        eReturn = eBlocked;
+                                        break;
+                                    }
+                                }
+                            }
+                        #else /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+                            {
+                                eReturn = eSuspended;
+                            }
+                        #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
                     }
                     else
                     {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    if( xBreakLoop != pdFALSE )
-                    {
-                        break;
+                        eReturn = eBlocked;
                     }
                 }
+            #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
 
-                if( pxReturn != NULL )
+            #if ( INCLUDE_vTaskDelete == 1 )
+                else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
                 {
-                    /* The handle has been found. */
-                    break;
+                    /* The task being queried is referenced from the deleted
+                     * tasks list, or it is not referenced from any lists at
+                     * all. */
+                    eReturn = eDeleted;
                 }
-            } while( pxNextTCB != pxFirstTCB );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
+            #endif
+
+            else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
+            {
+                /* If the task is not in any other state, it must be in the
+                 * Ready (including pending ready) state. */
+                eReturn = eReady;
+            }
         }
 
-        return pxReturn;
-    }
+        return eReturn;
+    } /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* INCLUDE_eTaskGetState */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( INCLUDE_uxTaskPriorityGet == 1 )
 
-    TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    UBaseType_t uxTaskPriorityGet( const TaskHandle_t xTask )
     {
-        UBaseType_t uxQueue = configMAX_PRIORITIES;
-        TCB_t * pxTCB;
-
-        /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
-        configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+        TCB_t const * pxTCB;
+        UBaseType_t uxReturn;
 
-        vTaskSuspendAll();
+        taskENTER_CRITICAL();
         {
-            /* Search the ready lists. */
-            do
-            {
-                uxQueue--;
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+            /* If null is passed in here then it is the priority of the task
+             * that called uxTaskPriorityGet() that is being queried. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            uxReturn = pxTCB->uxPriority;
+        }
+        taskEXIT_CRITICAL();
 
-                if( pxTCB != NULL )
-                {
-                    /* Found the handle. */
-                    break;
-                }
-            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+        return uxReturn;
+    }
 
-            /* Search the delayed lists. */
-            if( pxTCB == NULL )
-            {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-            }
+#endif /* INCLUDE_uxTaskPriorityGet */
+/*-----------------------------------------------------------*/
 
-            if( pxTCB == NULL )
-            {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
-            }
+#if ( INCLUDE_uxTaskPriorityGet == 1 )
 
-            #if ( INCLUDE_vTaskSuspend == 1 )
-                {
-                    if( pxTCB == NULL )
-                    {
-                        /* Search the suspended list. */
-                        pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
-                    }
-                }
-            #endif
+    UBaseType_t uxTaskPriorityGetFromISR( const TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+        UBaseType_t uxReturn, uxSavedInterruptState;
 
-            #if ( INCLUDE_vTaskDelete == 1 )
-                {
-                    if( pxTCB == NULL )
-                    {
-                        /* Search the deleted list. */
-                        pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
-                    }
-                }
-            #endif
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum  system call (or maximum API call) interrupt priority.
+         * Interrupts that are  above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+         * is defined in FreeRTOSConfig.h then
+         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+         * failure if a FreeRTOS API function is called from an interrupt that has
+         * been assigned a priority above the configured maximum system call
+         * priority.  Only FreeRTOS functions that end in FromISR can be called
+         * from interrupts  that have been assigned a priority at or (logically)
+         * below the maximum system call interrupt priority.  FreeRTOS maintains a
+         * separate interrupt safe API to ensure interrupt entry is as fast and as
+         * simple as possible.  More information (albeit Cortex-M specific) is
+         * provided on the following link:
+         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptState = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            /* If null is passed in here then it is the priority of the calling
+             * task that is being queried. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            uxReturn = pxTCB->uxPriority;
         }
-        ( void ) xTaskResumeAll();
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptState );
 
-        return pxTCB;
+        return uxReturn;
     }
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* INCLUDE_uxTaskPriorityGet */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( INCLUDE_vTaskPrioritySet == 1 )
 
-    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
-                                      const UBaseType_t uxArraySize,
-                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    void vTaskPrioritySet( TaskHandle_t xTask,
+                           UBaseType_t uxNewPriority )
     {
-        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+        TCB_t * pxTCB;
+        UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
+        BaseType_t xYieldRequired = pdFALSE;
 
-        vTaskSuspendAll();
+        configASSERT( uxNewPriority < configMAX_PRIORITIES );
+
+        /* Ensure the new priority is valid. */
+        if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
         {
-            /* Is there a space in the array for each task in the system? */
-            if( uxArraySize >= uxCurrentNumberOfTasks )
-            {
-                /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Ready state. */
-                do
-                {
-                    uxQueue--;
-                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+            uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-                /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Blocked state. */
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the priority of the calling
+             * task that is being changed. */
+            pxTCB = prvGetTCBFromHandle( xTask );
 
-                #if ( INCLUDE_vTaskDelete == 1 )
-                    {
-                        /* Fill in an TaskStatus_t structure with information on
-                         * each task that has been deleted but not yet cleaned up. */
-                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
-                    }
-                #endif
+            traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
 
-                #if ( INCLUDE_vTaskSuspend == 1 )
-                    {
-                        /* Fill in an TaskStatus_t structure with information on
-                         * each task in the Suspended state. */
-                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
-                    }
-                #endif
+            #if ( configUSE_MUTEXES == 1 )
+                {
+                    uxCurrentBasePriority = pxTCB->uxBasePriority;
+                }
+            #else
+                {
+                    uxCurrentBasePriority = pxTCB->uxPriority;
+                }
+            #endif
 
-                #if ( configGENERATE_RUN_TIME_STATS == 1 )
-                    {
-                        if( pulTotalRunTime != NULL )
-                        {
-                            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                                portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
-                            #else
-                                *pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-                            #endif
-                        }
-                    }
-                #else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
-                    {
-                        if( pulTotalRunTime != NULL )
-                        {
-                            *pulTotalRunTime = 0;
-                        }
-                    }
-                #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
-        }
-        ( void ) xTaskResumeAll();
-
-        return uxTask;
-    }
-
-#endif /* configUSE_TRACE_FACILITY */
-/*----------------------------------------------------------*/
-
-#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
-
-    TaskHandle_t xTaskGetIdleTaskHandle( void )
-    {
-        /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-         * started, then xIdleTaskHandle will be NULL. */
-        configASSERT( ( xIdleTaskHandle != NULL ) );
-        return xIdleTaskHandle;
-    }
-
-#endif /* INCLUDE_xTaskGetIdleTaskHandle */
-/*----------------------------------------------------------*/
-
-/* This conditional compilation should use inequality to 0, not equality to 1.
- * This is to ensure vTaskStepTick() is available when user defined low power mode
- * implementations require configUSE_TICKLESS_IDLE to be set to a value other than
- * 1. */
-#if ( configUSE_TICKLESS_IDLE != 0 )
-
-    void vTaskStepTick( const TickType_t xTicksToJump )
-    {
-        /* Correct the tick count value after a period during which the tick
-         * was suppressed.  Note this does *not* call the tick hook function for
-         * each stepped tick. */
-        configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
-        xTickCount += xTicksToJump;
-        traceINCREASE_TICK_COUNT( xTicksToJump );
-    }
-
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
-
-BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
-{
-    BaseType_t xYieldOccurred;
-
-    /* Must not be called with the scheduler suspended as the implementation
-     * relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
-    configASSERT( uxSchedulerSuspended == 0 );
-
-    /* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
-     * the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
-    vTaskSuspendAll();
-    xPendedTicks += xTicksToCatchUp;
-    xYieldOccurred = xTaskResumeAll();
-
-    return xYieldOccurred;
-}
-/*----------------------------------------------------------*/
-
-#if ( INCLUDE_xTaskAbortDelay == 1 )
-
-    BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
-    {
-        TCB_t * pxTCB = xTask;
-        BaseType_t xReturn;
-
-        configASSERT( pxTCB );
-
-        vTaskSuspendAll();
-        {
-            /* A task can only be prematurely removed from the Blocked state if
-             * it is actually in the Blocked state. */
-            if( eTaskGetState( xTask ) == eBlocked )
+            if( uxCurrentBasePriority != uxNewPriority )
             {
-                xReturn = pdPASS;
-
-                /* Remove the reference to the task from the blocked list.  An
-                 * interrupt won't touch the xStateListItem because the
-                 * scheduler is suspended. */
-                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-
-                /* Is the task waiting on an event also?  If so remove it from
-                 * the event list too.  Interrupts can touch the event list item,
-                 * even though the scheduler is suspended, so a critical section
-                 * is used. */
-                taskENTER_CRITICAL();
+                /* The priority change may have readied a task of higher
+                 * priority than the calling task. */
+                if( uxNewPriority > uxCurrentBasePriority )
                 {
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    if( pxTCB != pxCurrentTCB )
                     {
-                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-
-                        /* This lets the task know it was forcibly removed from the
-                         * blocked state so it should not re-evaluate its block time and
-                         * then block again. */
-                        pxTCB->ucDelayAborted = pdTRUE;
+                        /* The priority of a task other than the currently
+                         * running task is being raised.  Is the priority being
+                         * raised above that of the running task? */
+                        if( uxNewPriority >= pxCurrentTCB->uxPriority )
+                        {
+                            xYieldRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
                     }
                     else
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        /* The priority of the running task is being raised,
+                         * but the running task must already be the highest
+                         * priority task able to run so no yield is required. */
                     }
                 }
-                taskEXIT_CRITICAL();
+                else if( pxTCB == pxCurrentTCB )
+                {
+                    /* Setting the priority of the running task down means
+                     * there may now be another task of higher priority that
+                     * is ready to execute. */
+                    xYieldRequired = pdTRUE;
+                }
+                else
+                {
+                    /* Setting the priority of any other task down does not
+                     * require a yield as the running task must be above the
+                     * new priority of the task being modified. */
+                }
 
-                /* Place the unblocked task into the appropriate ready list. */
-                prvAddTaskToReadyList( pxTCB );
+                /* Remember the ready list the task might be referenced from
+                 * before its uxPriority member is changed so the
+                 * taskRESET_READY_PRIORITY() macro can function correctly. */
+                uxPriorityUsedOnEntry = pxTCB->uxPriority;
 
-                /* A task being unblocked cannot cause an immediate context
-                 * switch if preemption is turned off. */
-                #if ( configUSE_PREEMPTION == 1 )
+                #if ( configUSE_MUTEXES == 1 )
                     {
-                        /* Preemption is on, but a context switch should only be
-                         * performed if the unblocked task has a priority that is
-                         * higher than the currently executing task. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        /* Only change the priority being used if the task is not
+                         * currently using an inherited priority. */
+                        if( pxTCB->uxBasePriority == pxTCB->uxPriority )
                         {
-                            /* Pend the yield to be performed when the scheduler
-                             * is unsuspended. */
-                            xYieldPending = pdTRUE;
+                            pxTCB->uxPriority = uxNewPriority;
                         }
                         else
                         {
                             mtCOVERAGE_TEST_MARKER();
                         }
-                    }
-                #endif /* configUSE_PREEMPTION */
-            }
-            else
-            {
-                xReturn = pdFAIL;
-            }
-        }
-        ( void ) xTaskResumeAll();
-
-        return xReturn;
-    }
-
-#endif /* INCLUDE_xTaskAbortDelay */
-/*----------------------------------------------------------*/
-
-BaseType_t xTaskIncrementTick( void )
-{
-    TCB_t * pxTCB;
-    TickType_t xItemValue;
-    BaseType_t xSwitchRequired = pdFALSE;
-
-    /* Called by the portable layer each time a tick interrupt occurs.
-     * Increments the tick then checks to see if the new tick value will cause any
-     * tasks to be unblocked. */
-    traceTASK_INCREMENT_TICK( xTickCount );
-
-    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-    {
-        /* Minor optimisation.  The tick count cannot change in this
-         * block. */
-        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
-
-        /* Increment the RTOS tick, switching the delayed and overflowed
-         * delayed lists if it wraps to 0. */
-        xTickCount = xConstTickCount;
 
-        if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
-        {
-            taskSWITCH_DELAYED_LISTS();
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
+                        /* The base priority gets set whatever. */
+                        pxTCB->uxBasePriority = uxNewPriority;
+                    }
+                #else /* if ( configUSE_MUTEXES == 1 ) */
+                    {
+                        pxTCB->uxPriority = uxNewPriority;
+                    }
+                #endif /* if ( configUSE_MUTEXES == 1 ) */
 
-        /* See if this tick has made a timeout expire.  Tasks are stored in
-         * the  queue in the order of their wake time - meaning once one task
-         * has been found whose block time has not expired there is no need to
-         * look any further down the list. */
-        if( xConstTickCount >= xNextTaskUnblockTime )
-        {
-            for( ; ; )
-            {
-                if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+                /* Only reset the event list item value if the value is not
+                 * being used for anything else. */
+                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
                 {
-                    /* The delayed list is empty.  Set xNextTaskUnblockTime
-                     * to the maximum possible value so it is extremely
-                     * unlikely that the
-                     * if( xTickCount >= xNextTaskUnblockTime ) test will pass
-                     * next time through. */
-                    xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                    break;
+                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
                 }
                 else
                 {
-                    /* The delayed list is not empty, get the value of the
-                     * item at the head of the delayed list.  This is the time
-                     * at which the task at the head of the delayed list must
-                     * be removed from the Blocked state. */
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-                    if( xConstTickCount < xItemValue )
+                /* If the task is in the blocked or suspended list we need do
+                 * nothing more than change its priority variable. However, if
+                 * the task is in a ready list it needs to be removed and placed
+                 * in the list appropriate to its new priority. */
+                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    /* The task is currently in its ready list - remove before
+                     * adding it to its new ready list.  As we are in a critical
+                     * section we can do this even if the scheduler is suspended. */
+                    if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                     {
-                        /* It is not time to unblock this item yet, but the
-                         * item value is the time at which the task at the head
-                         * of the blocked list must be removed from the Blocked
-                         * state -  so record the item value in
-                         * xNextTaskUnblockTime. */
-                        xNextTaskUnblockTime = xItemValue;
-                        break; /*lint !e9011 Code structure here is deemed easier to understand with multiple breaks. */
+                        /* It is known that the task is in its ready list so
+                         * there is no need to check again and the port level
+                         * reset macro can be called directly. */
+                        portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
 
-                    /* It is time to remove the item from the Blocked state. */
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-                    /* Is the task waiting on an event also?  If so remove
-                     * it from the event list. */
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-                    {
-                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-                  /**********************************************************************/
-				  /* Update Task New Deadline */
-					#if (configUSE_EDF_SCHEDULER == 1)
-		listSET_LIST_ITEM_VALUE(&(pxTCB->xStateListItem), pxTCB->xTaskPeriod + listGET_LIST_ITEM_VALUE(&(pxTCB->xStateListItem)));
-					#endif
-			   /**********************************************************************/
-                    /* Place the unblocked task into the appropriate ready
-                     * list. */
- 
-                    /* A task being unblocked cannot cause an immediate
-                     * context switch if preemption is turned off. */
-                    #if ( configUSE_PREEMPTION == 1 )
-                        {
-                            /* Preemption is on, but a context switch should
-                             * only be performed if the unblocked task has a
-                             * priority that is equal to or higher than the
-                             * currently executing task. */
-							 
-		/**********************************************************************************/ 
-				   #if (configUSE_EDF_SCHEDULER == 1)
-					    if( pxTCB->xStateListItem.xItemValue <= pxCurrentTCB->xStateListItem.xItemValue )
-                                {
-                                    xSwitchRequired = pdTRUE;
-                                }
-                       else
-                                {
-                                    mtCOVERAGE_TEST_MARKER();
-                                }
-			        #else
-                        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-                                {
-                                    xSwitchRequired = pdTRUE;
-                                }
-                    else
-                                {
-                                    mtCOVERAGE_TEST_MARKER();
-                                }
-							#endif
-                        }
-                    #endif /* configUSE_PREEMPTION */
-                }
-            }
-        }
-			/**********************************************************************************/
-
-        /* Tasks of equal priority to the currently running task will share
-         * processing time (time slice) if preemption is on, and the application
-         * writer has not explicitly turned time slicing off. */
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
-            {
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                if( xYieldRequired != pdFALSE )
                 {
-                    xSwitchRequired = pdTRUE;
+                    taskYIELD_IF_USING_PREEMPTION();
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
+
+                /* Remove compiler warning about unused variables when the port
+                 * optimised task selection is not being used. */
+                ( void ) uxPriorityUsedOnEntry;
             }
-        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+        }
+        taskEXIT_CRITICAL();
+    }
 
-        #if ( configUSE_TICK_HOOK == 1 )
+#endif /* INCLUDE_vTaskPrioritySet */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+    {
+        TCB_t * pxTCB;
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the running task that is
+             * being suspended. */
+            pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+
+            traceTASK_SUSPEND( pxTCB );
+
+            /* Remove task from the ready/delayed list and place in the
+             * suspended list. */
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
             {
-                /* Guard against the tick hook being called when the pended tick
-                 * count is being unwound (when the scheduler is being unlocked). */
-                if( xPendedTicks == ( TickType_t ) 0 )
-                {
-                    vApplicationTickHook();
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
             }
-        #endif /* configUSE_TICK_HOOK */
-
-        #if ( configUSE_PREEMPTION == 1 )
+            else
             {
-                if( xYieldPending != pdFALSE )
-                {
-                    xSwitchRequired = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                mtCOVERAGE_TEST_MARKER();
             }
-        #endif /* configUSE_PREEMPTION */
-    }
-    else
-    {
-        ++xPendedTicks;
 
-        /* The tick hook gets called at regular intervals, even if the
-         * scheduler is locked. */
-        #if ( configUSE_TICK_HOOK == 1 )
+            /* Is the task waiting on an event also? */
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
             {
-                vApplicationTickHook();
+                ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
-        #endif
-    }
 
-    return xSwitchRequired;
-}
-/*-----------------------------------------------------------*/
+            vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                {
+                    BaseType_t x;
 
-    void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
-                                     TaskHookFunction_t pxHookFunction )
-    {
-        TCB_t * xTCB;
+                    for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+                    {
+                        if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                        {
+                            /* The task was blocked to wait for a notification, but is
+                             * now suspended, so no notification was received. */
+                            pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+                        }
+                    }
+                }
+            #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+        }
+        taskEXIT_CRITICAL();
 
-        /* If xTask is NULL then it is the task hook of the calling task that is
-         * getting set. */
-        if( xTask == NULL )
+        if( xSchedulerRunning != pdFALSE )
         {
-            xTCB = ( TCB_t * ) pxCurrentTCB;
+            /* Reset the next expected unblock time in case it referred to the
+             * task that is now in the Suspended state. */
+            taskENTER_CRITICAL();
+            {
+                prvResetNextTaskUnblockTime();
+            }
+            taskEXIT_CRITICAL();
         }
         else
         {
-            xTCB = xTask;
+            mtCOVERAGE_TEST_MARKER();
         }
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        taskENTER_CRITICAL();
+        if( pxTCB == pxCurrentTCB )
         {
-            xTCB->pxTaskTag = pxHookFunction;
+            if( xSchedulerRunning != pdFALSE )
+            {
+                /* The current task has just been suspended. */
+                configASSERT( uxSchedulerSuspended == 0 );
+                portYIELD_WITHIN_API();
+            }
+            else
+            {
+                /* The scheduler is not running, but the task that was pointed
+                 * to by pxCurrentTCB has just been suspended and pxCurrentTCB
+                 * must be adjusted to point to a different task. */
+                if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+                {
+                    /* No other tasks are ready, so set pxCurrentTCB back to
+                     * NULL so when the next task is created pxCurrentTCB will
+                     * be set to point to it no matter what its relative priority
+                     * is. */
+                    pxCurrentTCB = NULL;
+                }
+                else
+                {
+                    vTaskSwitchContext();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        taskEXIT_CRITICAL();
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* INCLUDE_vTaskSuspend */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( INCLUDE_vTaskSuspend == 1 )
 
-    TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+    static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
     {
-        TCB_t * pxTCB;
-        TaskHookFunction_t xReturn;
+        BaseType_t xReturn = pdFALSE;
+        const TCB_t * const pxTCB = xTask;
 
-        /* If xTask is NULL then set the calling task's hook. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+        /* Accesses xPendingReadyList so must be called from a critical
+         * section. */
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        taskENTER_CRITICAL();
+        /* It does not make sense to check if the calling task is suspended. */
+        configASSERT( xTask );
+
+        /* Is the task being resumed actually in the suspended list? */
+        if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
         {
-            xReturn = pxTCB->pxTaskTag;
+            /* Has the task already been resumed from within an ISR? */
+            if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+            {
+                /* Is it in the suspended list because it is in the Suspended
+                 * state, or because is is blocked with no timeout? */
+                if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE ) /*lint !e961.  The cast is only redundant when NULL is used. */
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        taskEXIT_CRITICAL();
 
         return xReturn;
-    }
+    } /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* INCLUDE_vTaskSuspend */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( INCLUDE_vTaskSuspend == 1 )
 
-    TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+    void vTaskResume( TaskHandle_t xTaskToResume )
     {
-        TCB_t * pxTCB;
-        TaskHookFunction_t xReturn;
-        UBaseType_t uxSavedInterruptStatus;
+        TCB_t * const pxTCB = xTaskToResume;
 
-        /* If xTask is NULL then set the calling task's hook. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+        /* It does not make sense to resume the calling task. */
+        configASSERT( xTaskToResume );
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        /* The parameter cannot be NULL as it is impossible to resume the
+         * currently executing task. */
+        if( ( pxTCB != pxCurrentTCB ) && ( pxTCB != NULL ) )
         {
-            xReturn = pxTCB->pxTaskTag;
-        }
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-        return xReturn;
-    }
-
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
-
-    BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
-                                             void * pvParameter )
-    {
-        TCB_t * xTCB;
-        BaseType_t xReturn;
+            taskENTER_CRITICAL();
+            {
+                if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+                {
+                    traceTASK_RESUME( pxTCB );
 
-        /* If xTask is NULL then we are calling our own task hook. */
-        if( xTask == NULL )
-        {
-            xTCB = pxCurrentTCB;
-        }
-        else
-        {
-            xTCB = xTask;
-        }
+                    /* The ready list can be accessed even if the scheduler is
+                     * suspended because this is inside a critical section. */
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
 
-        if( xTCB->pxTaskTag != NULL )
-        {
-            xReturn = xTCB->pxTaskTag( pvParameter );
+                    /* A higher priority task may have just been resumed. */
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        if( taskEDF_SHOULD_PREEMPT( pxTCB ) )
+                    #else
+                        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    #endif
+                    {
+                        /* This yield may not cause the task just resumed to run,
+                         * but will leave the lists in the correct state for the
+                         * next yield. */
+                        taskYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
         }
         else
         {
-            xReturn = pdFAIL;
+            mtCOVERAGE_TEST_MARKER();
         }
-
-        return xReturn;
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* INCLUDE_vTaskSuspend */
+
 /*-----------------------------------------------------------*/
 
-void vTaskSwitchContext( void )
-{
-    if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
-    {
-        /* The scheduler is currently suspended - do not allow a context
-         * switch. */
-        xYieldPending = pdTRUE;
-    }
-    else
+#if ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+
+    BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume )
     {
-        xYieldPending = pdFALSE;
-        traceTASK_SWITCHED_OUT();
+        BaseType_t xYieldRequired = pdFALSE;
+        TCB_t * const pxTCB = xTaskToResume;
+        UBaseType_t uxSavedInterruptStatus;
 
-        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+        configASSERT( xTaskToResume );
+
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum  system call (or maximum API call) interrupt priority.
+         * Interrupts that are  above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+         * is defined in FreeRTOSConfig.h then
+         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+         * failure if a FreeRTOS API function is called from an interrupt that has
+         * been assigned a priority above the configured maximum system call
+         * priority.  Only FreeRTOS functions that end in FromISR can be called
+         * from interrupts  that have been assigned a priority at or (logically)
+         * below the maximum system call interrupt priority.  FreeRTOS maintains a
+         * separate interrupt safe API to ensure interrupt entry is as fast and as
+         * simple as possible.  More information (albeit Cortex-M specific) is
+         * provided on the following link:
+         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
             {
-                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-                #else
-                    ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-                #endif
+                traceTASK_RESUME_FROM_ISR( pxTCB );
+                taskLATENCY_WOKEN( pxTCB );
 
-                /* Add the amount of time the task has been running to the
-                 * accumulated time so far.  The time the task started running was
-                 * stored in ulTaskSwitchedInTime.  Note that there is no overflow
-                 * protection here so count values are only valid until the timer
-                 * overflows.  The guard against negative values is to protect
-                 * against suspect run time stat counter implementations - which
-                 * are provided by the application, not the kernel. */
-                if( ulTotalRunTime > ulTaskSwitchedInTime )
+                /* Check the ready lists can be accessed. */
+                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
-                    pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                    /* Ready lists can be accessed so move the task from the
+                     * suspended list to the ready list directly. */
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        if( taskEDF_SHOULD_PREEMPT( pxTCB ) )
+                    #else
+                        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    #endif
+                    {
+                        xYieldRequired = pdTRUE;
+
+                        /* Mark that a yield is pending in case the user is not
+                         * using the return value to initiate a context switch
+                         * from the ISR using portYIELD_FROM_ISR. */
+                        xYieldPending = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    /* The delayed or ready lists cannot be accessed so the task
+                     * is held in the pending ready list until the scheduler is
+                     * unsuspended. */
+                    vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
-
-                ulTaskSwitchedInTime = ulTotalRunTime;
             }
-        #endif /* configGENERATE_RUN_TIME_STATS */
-
-        /* Check for stack overflow, if configured. */
-        taskCHECK_FOR_STACK_OVERFLOW();
-
-        /* Before the currently running task is switched out, save its errno. */
-        #if ( configUSE_POSIX_ERRNO == 1 )
+            else
             {
-                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+                mtCOVERAGE_TEST_MARKER();
             }
-        #endif
-		
-/*****************************************************************************/
-        /* Select a new task to run using either the generic C or port
-         * optimised asm code. */
-		 /* Every time the running task is
-suspended, or a suspended task with an higher priority than the running task awakes, a switch
-context occurs. vT askSwitchContext() method is in charge to update the *pxCurrentTCB pointer to the new running task*/
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
+        return xYieldRequired;
+    }
 
-       #if (configUSE_EDF_SCHEDULER == 0)
-				{
-					taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-				}
-#else
-				{
-					pxCurrentTCB = (TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( xReadyTasksListEDF ) );
-				}
-#endif
+#endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
+/*-----------------------------------------------------------*/
 
-		traceTASK_SWITCHED_IN();
-        /*********************************************************************************/
-		/* After the new task is switched in, update the global errno. */
-        #if ( configUSE_POSIX_ERRNO == 1 )
+void vTaskStartScheduler( void )
+{
+    BaseType_t xReturn;
+
+    /* Add the idle task at the lowest priority. */
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        {
+            StaticTask_t * pxIdleTaskTCBBuffer = NULL;
+            StackType_t * pxIdleTaskStackBuffer = NULL;
+            uint32_t ulIdleTaskStackSize;
+
+            /* The Idle task is created using user provided RAM - obtain the
+             * address of the RAM then create the idle task. */
+            vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+            xIdleTaskHandle = xTaskCreateStatic( prvIdleTask,
+                                                 configIDLE_TASK_NAME,
+                                                 ulIdleTaskStackSize,
+                                                 ( void * ) NULL,       /*lint !e961.  The cast is not redundant for all compilers. */
+                                                 portPRIVILEGE_BIT,     /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+                                                 pxIdleTaskStackBuffer,
+                                                 pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+            if( xIdleTaskHandle != NULL )
             {
-                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+                xReturn = pdPASS;
             }
-        #endif
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+    #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+	/***************************************************************/
+	/* initializes the IDLE task and inserts it into the Ready List */ 
+        {
+            /* The Idle task is being created using dynamically allocated RAM.
+             * With EDF it is not a periodic task: it runs below the EDF band,
+             * so only once the EDF ready list is empty, and shares
+             * tskIDLE_PRIORITY with any application task created there. */
+            xReturn = xTaskCreate( prvIdleTask,
+                                   configIDLE_TASK_NAME,
+                                   configMINIMAL_STACK_SIZE,
+                                   ( void * ) NULL,
+                                   portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+                                   &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+        }
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
-        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+    #if ( configUSE_TIMERS == 1 )
+        {
+            if( xReturn == pdPASS )
             {
-                /* Switch Newlib's _impure_ptr variable to point to the _reent
-                 * structure specific to this task.
-                 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-                 * for additional information. */
-                _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+                xReturn = xTimerCreateTimerTask();
             }
-        #endif /* configUSE_NEWLIB_REENTRANT */
-    }
-}
-/*-----------------------------------------------------------*/
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* configUSE_TIMERS */
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) )
+        {
+            if( xReturn == pdPASS )
+            {
+                xReturn = prvPartitionPeriodicTasks();
+
+                /* The periodic tasks do not fit on configEDF_NUMBER_OF_CORES
+                 * cores.  This is a design error, not a lack of memory, so it
+                 * is not left to the caller to notice that the scheduler did
+                 * not start. */
+                configASSERT( xReturn == pdPASS );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) */
+
+    if( xReturn == pdPASS )
+    {
+        /* freertos_tasks_c_additions_init() should only be called if the user
+         * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
+         * the only macro called by the function. */
+        #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+            {
+                freertos_tasks_c_additions_init();
+            }
+        #endif
+
+        /* Interrupts are turned off here, to ensure a tick does not occur
+         * before or during the call to xPortStartScheduler().  The stacks of
+         * the created tasks contain a status word with interrupts switched on
+         * so interrupts will automatically get re-enabled when the first task
+         * starts to run. */
+        portDISABLE_INTERRUPTS();
+
+        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+            {
+                /* Switch Newlib's _impure_ptr variable to point to the _reent
+                 * structure specific to the task that will run first.
+                 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+                 * for additional information. */
+                _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+            }
+        #endif /* configUSE_NEWLIB_REENTRANT */
+
+        xNextTaskUnblockTime = portMAX_DELAY;
+        xSchedulerRunning = pdTRUE;
+        xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_DEADLINES == 1 ) )
+            {
+                UBaseType_t uxTask;
+
+                /* The tasks created so far were released at a timer count of
+                 * 0.  Move their deadlines to the count the timer is at now,
+                 * which keeps their order. */
+                ulTickTime = portEDF_GET_DEADLINE_TIME();
+                xTickTimeTick = xTickCount;
+
+                for( uxTask = ( UBaseType_t ) 0U; uxTask < uxPeriodicTaskCount; uxTask++ )
+                {
+                    pxPeriodicTasks[ uxTask ]->ulTaskAbsoluteDeadline += ulTickTime;
+                }
+            }
+        #endif
+
+        #if ( configUSE_JOB_HISTOGRAMS == 1 )
+            {
+                UBaseType_t uxJobTask;
+
+                /* The first jobs are released as the scheduler starts, and the
+                 * task picked to run first is started straight away. */
+                for( uxJobTask = ( UBaseType_t ) 0U; uxJobTask < uxPeriodicTaskCount; uxJobTask++ )
+                {
+                    taskJOB_STATS_RELEASE( pxPeriodicTasks[ uxJobTask ] );
+                }
+
+                if( pxCurrentTCB->xTaskPeriod != ( TickType_t ) 0U )
+                {
+                    pxCurrentTCB->xJobStarted = pdTRUE;
+                    prvJobHistogramAdd( pxCurrentTCB, taskJOB_RELEASE_JITTER, 0UL );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        /* If configGENERATE_RUN_TIME_STATS is defined then the following
+         * macro must be defined to configure the timer/counter used to generate
+         * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
+         * is set to 0 and the following line fails to build then ensure you do not
+         * have portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() defined in your
+         * FreeRTOSConfig.h file. */
+        portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+
+        traceTASK_SWITCHED_IN();
+        taskTRACE_RECORD( taskTRACE_SWITCH_IN, pxCurrentTCB, xTickCount & 0xFFFFU );
+        taskGPIO_TRACE_TASK( pxCurrentTCB );
+
+        /* Setting up the timer tick is hardware specific and thus in the
+         * portable interface. */
+        if( xPortStartScheduler() != pdFALSE )
+        {
+            /* Should not reach here as if the scheduler is running the
+             * function will not return. */
+        }
+        else
+        {
+            /* Should only reach here if a task calls xTaskEndScheduler(). */
+        }
+    }
+    else
+    {
+        /* This line will only be reached if the kernel could not be started,
+         * because there was not enough FreeRTOS heap to create the idle task
+         * or the timer task, or with EDF because the periodic tasks do not fit
+         * on the cores. */
+        configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
+    }
+
+    /* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
+     * meaning xIdleTaskHandle is not used anywhere else. */
+    ( void ) xIdleTaskHandle;
+
+    /* OpenOCD makes use of uxTopUsedPriority for thread debugging. Prevent uxTopUsedPriority
+     * from getting optimized out as it is no longer used by the kernel. */
+    ( void ) uxTopUsedPriority;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskEndScheduler( void )
+{
+    /* Stop the scheduler interrupts and call the portable scheduler end
+     * routine so the original ISRs can be restored if necessary.  The port
+     * layer must ensure interrupts enable  bit is left in the correct state. */
+    portDISABLE_INTERRUPTS();
+    xSchedulerRunning = pdFALSE;
+    vPortEndScheduler();
+}
+/*----------------------------------------------------------*/
+
+void vTaskSuspendAll( void )
+{
+    /* A critical section is not required as the variable is of type
+     * BaseType_t.  Please read Richard Barry's reply in the following link to a
+     * post in the FreeRTOS support forum before reporting this as a bug! -
+     * https://goo.gl/wu4acr */
+
+    /* portSOFTWARE_BARRIER() is only implemented for emulated/simulated ports that
+     * do not otherwise exhibit real time behaviour. */
+    portSOFTWARE_BARRIER();
+
+    /* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
+     * is used to allow calls to vTaskSuspendAll() to nest. */
+    ++uxSchedulerSuspended;
+
+    /* Enforces ordering for ports and optimised compilers that may otherwise place
+     * the above increment elsewhere. */
+    portMEMORY_BARRIER();
+}
+/*----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+    static TickType_t prvGetExpectedIdleTime( void )
+    {
+        TickType_t xReturn;
+        UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+
+        /* uxHigherPriorityReadyTasks takes care of the case where
+         * configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
+         * task that are in the Ready state, even though the idle task is
+         * running. */
+        #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+            {
+                if( uxTopReadyPriority > tskIDLE_PRIORITY )
+                {
+                    uxHigherPriorityReadyTasks = pdTRUE;
+                }
+            }
+        #else
+            {
+                const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
+
+                /* When port optimised task selection is used the uxTopReadyPriority
+                 * variable is used as a bit map.  If bits other than the least
+                 * significant bit are set then there are tasks that have a priority
+                 * above the idle priority that are in the Ready state.  This takes
+                 * care of the case where the co-operative scheduler is in use. */
+                if( uxTopReadyPriority > uxLeastSignificantBit )
+                {
+                    uxHigherPriorityReadyTasks = pdTRUE;
+                }
+            }
+        #endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
+
+        /* With EDF the idle task is below the EDF band, so the checks are the
+         * same as for the fixed-priority scheduler.  It is not alone at its
+         * priority: application tasks, such as the trace and report tasks of
+         * main.c, may run at tskIDLE_PRIORITY too.  Those that are ready keep
+         * the tick running, and those that are blocked wake from the delayed
+         * lists, so prvGetTicksToNextWake() already stops short of them. */
+        if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
+        {
+            xReturn = 0;
+        }
+        else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
+        {
+            /* There are other idle priority tasks in the ready state.  They
+             * run as soon as the idle task yields or its time slice ends, so
+             * there is nothing to sleep through. */
+            xReturn = 0;
+        }
+        else if( uxHigherPriorityReadyTasks != pdFALSE )
+        {
+            /* There are tasks in the Ready state that have a priority above the
+             * idle priority.  This path can only be reached if
+             * configUSE_PREEMPTION is 0. */
+            xReturn = 0;
+        }
+        else
+        {
+            xReturn = prvGetTicksToNextWake();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
+
+#if ( ( configUSE_TICKLESS_IDLE != 0 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) || ( configUSE_BULK_TICK_CATCH_UP == 1 ) )
+
+    static TickType_t prvGetTicksToNextWake( void )
+    {
+        TickType_t xReturn;
+
+        /* The head of the delayed list is the earliest pending release. */
+        xReturn = xNextTaskUnblockTime - xTickCount;
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+            {
+                /* So are the periodic tasks in the release queue. */
+                if( ( xNextReleaseTime - xTickCount ) < xReturn )
+                {
+                    xReturn = xNextReleaseTime - xTickCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOBS == 1 ) )
+            {
+                /* Jobs are released by the tick too. */
+                if( ( xJobServerHandle != NULL ) && ( listLIST_IS_EMPTY( &xJobReleaseList ) == pdFALSE ) &&
+                    ( ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( &xJobReleaseList ) - xTickCount ) < xReturn ) )
+                {
+                    xReturn = listGET_ITEM_VALUE_OF_HEAD_ENTRY( &xJobReleaseList ) - xTickCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        return xReturn;
+    }
+
+#endif /* ( configUSE_TICKLESS_IDLE != 0 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) || ( configUSE_BULK_TICK_CATCH_UP == 1 ) */
+/*----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+
+    static TickType_t prvGetTicksToNextEvent( void )
+    {
+        TickType_t xReturn, xTicksToOverflow;
+
+        if( ( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE ) || ( xPendedTicks != ( TickType_t ) 0U ) )
+        {
+            /* The pended ticks are processed when the scheduler is resumed,
+             * until then nothing is known about the next wake time. */
+            xReturn = ( TickType_t ) 1U;
+        }
+
+        #if ( configUSE_TICK_HOOK == 1 )
+            else if( pdTRUE )
+            {
+                /* The tick hook is called every tick. */
+                xReturn = ( TickType_t ) 1U;
+            }
+        #endif
+
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+            else if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    && ( pxCurrentTCB->uxPriority != configEDF_PRIORITY_BAND )
+                #endif
+                )
+            {
+                /* Tasks that share the running priority are time sliced
+                 * every tick.  Tasks of the EDF band do not share time. */
+                xReturn = ( TickType_t ) 1U;
+            }
+        #endif
+        else
+        {
+            xReturn = prvGetTicksToNextWake();
+
+            /* A wake time that has already passed is handled by the very next
+             * tick. */
+            if( ( xReturn == ( TickType_t ) 0U ) || ( xNextTaskUnblockTime <= xTickCount ) )
+            {
+                xReturn = ( TickType_t ) 1U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The delayed lists are switched by the tick on which the tick
+             * count overflows, so that tick cannot be skipped. */
+            xTicksToOverflow = ( TickType_t ) 0U - xTickCount;
+
+            if( ( xTicksToOverflow != ( TickType_t ) 0U ) && ( xTicksToOverflow < xReturn ) )
+            {
+                xReturn = xTicksToOverflow;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_EVENT_DRIVEN_TICK */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskResumeAll( void )
+{
+    TCB_t * pxTCB = NULL;
+    BaseType_t xAlreadyYielded = pdFALSE;
+
+    /* If uxSchedulerSuspended is zero then this function does not match a
+     * previous call to vTaskSuspendAll(). */
+    configASSERT( uxSchedulerSuspended );
+
+    /* It is possible that an ISR caused a task to be removed from an event
+     * list while the scheduler was suspended.  If this was the case then the
+     * removed task will have been added to the xPendingReadyList.  Once the
+     * scheduler has been resumed it is safe to move all the pending ready
+     * tasks from this list into their appropriate ready list. */
+    taskENTER_CRITICAL();
+    {
+        --uxSchedulerSuspended;
+
+        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+        {
+            if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
+            {
+                /* Move any readied tasks from the pending list into the
+                 * appropriate ready list. */
+                while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
+                {
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                    portMEMORY_BARRIER();
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+
+                    /* If the moved task has a priority higher than or equal to
+                     * the current task then a yield must be performed. */
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        if( taskEDF_SHOULD_PREEMPT( pxTCB ) )
+                    #else
+                        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    #endif
+                    {
+                        xYieldPending = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( pxTCB != NULL )
+                {
+                    /* A task was unblocked while the scheduler was suspended,
+                     * which may have prevented the next unblock time from being
+                     * re-calculated, in which case re-calculate it now.  Mainly
+                     * important for low power tickless implementations, where
+                     * this can prevent an unnecessary exit from low power
+                     * state. */
+                    prvResetNextTaskUnblockTime();
+                }
+
+                /* If any ticks occurred while the scheduler was suspended then
+                 * they should be processed now.  This ensures the tick count does
+                 * not  slip, and that any delayed tasks are resumed at the correct
+                 * time. */
+                {
+                    TickType_t xPendedCounts = xPendedTicks; /* Non-volatile copy. */
+
+                    if( xPendedCounts > ( TickType_t ) 0U )
+                    {
+                        #if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+                            {
+                                if( prvCatchUpTicks( xPendedCounts ) != pdFALSE )
+                                {
+                                    xYieldPending = pdTRUE;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+                        #else
+                            {
+                                do
+                                {
+                                    if( xTaskIncrementTick() != pdFALSE )
+                                    {
+                                        xYieldPending = pdTRUE;
+                                    }
+                                    else
+                                    {
+                                        mtCOVERAGE_TEST_MARKER();
+                                    }
+
+                                    --xPendedCounts;
+                                } while( xPendedCounts > ( TickType_t ) 0U );
+                            }
+                        #endif /* configUSE_BULK_TICK_CATCH_UP */
+
+                        xPendedTicks = 0;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( xYieldPending != pdFALSE )
+                {
+                    #if ( configUSE_PREEMPTION != 0 )
+                        {
+                            xAlreadyYielded = pdTRUE;
+                        }
+                    #endif
+                    taskYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xAlreadyYielded;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCount( void )
+{
+    TickType_t xTicks;
+
+    /* Critical section required if running on a 16 bit processor. */
+    portTICK_TYPE_ENTER_CRITICAL();
+    {
+        #if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+            {
+                /* The tick interrupt does not come every tick. */
+                portENTER_CRITICAL();
+                taskCATCH_UP_EVENT_TICKS();
+                portEXIT_CRITICAL();
+            }
+        #endif
+
+        xTicks = xTickCount;
+    }
+    portTICK_TYPE_EXIT_CRITICAL();
+
+    return xTicks;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCountFromISR( void )
+{
+    TickType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    /* RTOS ports that support interrupt nesting have the concept of a maximum
+     * system call (or maximum API call) interrupt priority.  Interrupts that are
+     * above the maximum system call priority are kept permanently enabled, even
+     * when the RTOS kernel is in a critical section, but cannot make any calls to
+     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+     * failure if a FreeRTOS API function is called from an interrupt that has been
+     * assigned a priority above the configured maximum system call priority.
+     * Only FreeRTOS functions that end in FromISR can be called from interrupts
+     * that have been assigned a priority at or (logically) below the maximum
+     * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
+     * safe API to ensure interrupt entry is as fast and as simple as possible.
+     * More information (albeit Cortex-M specific) is provided on the following
+     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+    {
+        #if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+            {
+                UBaseType_t uxSavedCatchUpStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+                taskCATCH_UP_EVENT_TICKS();
+                portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedCatchUpStatus );
+            }
+        #endif
+
+        xReturn = xTickCount;
+    }
+    portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTaskGetNumberOfTasks( void )
+{
+    /* A critical section is not required because the variables are of type
+     * BaseType_t. */
+    return uxCurrentNumberOfTasks;
+}
+/*-----------------------------------------------------------*/
+
+char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+    TCB_t * pxTCB;
+
+    /* If null is passed in here then the name of the calling task is being
+     * queried. */
+    pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+    configASSERT( pxTCB );
+    return &( pxTCB->pcTaskName[ 0 ] );
+}
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+    static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
+                                                     const char pcNameToQuery[] )
+    {
+        TCB_t * pxNextTCB, * pxFirstTCB, * pxReturn = NULL;
+        UBaseType_t x;
+        char cNextChar;
+        BaseType_t xBreakLoop;
+
+        /* This function is called with the scheduler suspended. */
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                /* Check each character in the name looking for a match or
+                 * mismatch. */
+                xBreakLoop = pdFALSE;
+
+                for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+                {
+                    cNextChar = pxNextTCB->pcTaskName[ x ];
+
+                    if( cNextChar != pcNameToQuery[ x ] )
+                    {
+                        /* Characters didn't match. */
+                        xBreakLoop = pdTRUE;
+                    }
+                    else if( cNextChar == ( char ) 0x00 )
+                    {
+                        /* Both strings terminated, a match must have been
+                         * found. */
+                        pxReturn = pxNextTCB;
+                        xBreakLoop = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( xBreakLoop != pdFALSE )
+                    {
+                        break;
+                    }
+                }
+
+                if( pxReturn != NULL )
+                {
+                    /* The handle has been found. */
+                    break;
+                }
+            } while( pxNextTCB != pxFirstTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxReturn;
+    }
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+    TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    {
+        UBaseType_t uxQueue = configMAX_PRIORITIES;
+        TCB_t * pxTCB;
+
+        /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
+        configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+
+        vTaskSuspendAll();
+        {
+            /* Search the ready lists. */
+            do
+            {
+                uxQueue--;
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+
+                if( pxTCB != NULL )
+                {
+                    /* Found the handle. */
+                    break;
+                }
+            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+            /* Search the delayed lists. */
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    for( uxQueue = ( UBaseType_t ) 0U; ( uxQueue < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE ) && ( pxTCB == NULL ); uxQueue++ )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( &( xDelayedTaskWheel[ uxQueue ] ), pcNameToQuery );
+                    }
+                }
+            #else
+                {
+                    if( pxTCB == NULL )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+                    }
+
+                    if( pxTCB == NULL )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                    }
+                }
+            #endif /* configUSE_DELAYED_TASK_WHEEL */
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the suspended list. */
+                        pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+                    }
+                }
+            #endif
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the deleted list. */
+                        pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+                    }
+                }
+            #endif
+        }
+        ( void ) xTaskResumeAll();
+
+        return pxTCB;
+    }
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
+                                      const UBaseType_t uxArraySize,
+                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    {
+        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+
+        vTaskSuspendAll();
+        {
+            /* Is there a space in the array for each task in the system? */
+            if( uxArraySize >= uxCurrentNumberOfTasks )
+            {
+                /* Fill in an TaskStatus_t structure with information on each
+                 * task in the Ready state. */
+                do
+                {
+                    uxQueue--;
+                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+                /* Fill in an TaskStatus_t structure with information on each
+                 * task in the Blocked state. */
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                    {
+                        for( uxQueue = ( UBaseType_t ) 0U; uxQueue < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE; uxQueue++ )
+                        {
+                            uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxQueue ] ), eBlocked );
+                        }
+                    }
+                #else
+                    {
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+                    }
+                #endif /* configUSE_DELAYED_TASK_WHEEL */
+
+                #if ( INCLUDE_vTaskDelete == 1 )
+                    {
+                        /* Fill in an TaskStatus_t structure with information on
+                         * each task that has been deleted but not yet cleaned up. */
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
+                    }
+                #endif
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                    {
+                        /* Fill in an TaskStatus_t structure with information on
+                         * each task in the Suspended state. */
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
+                    }
+                #endif
+
+                #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                    {
+                        if( pulTotalRunTime != NULL )
+                        {
+                            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                                portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+                            #else
+                                *pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+                            #endif
+                        }
+                    }
+                #else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+                    {
+                        if( pulTotalRunTime != NULL )
+                        {
+                            *pulTotalRunTime = 0;
+                        }
+                    }
+                #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxTask;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+
+    TaskHandle_t xTaskGetIdleTaskHandle( void )
+    {
+        /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
+         * started, then xIdleTaskHandle will be NULL. */
+        configASSERT( ( xIdleTaskHandle != NULL ) );
+        return xIdleTaskHandle;
+    }
+
+#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+/*----------------------------------------------------------*/
+
+/* This conditional compilation should use inequality to 0, not equality to 1.
+ * This is to ensure vTaskStepTick() is available when user defined low power mode
+ * implementations require configUSE_TICKLESS_IDLE to be set to a value other than
+ * 1. */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+    void vTaskStepTick( const TickType_t xTicksToJump )
+    {
+        /* Correct the tick count value after a period during which the tick
+         * was suppressed.  Note this does *not* call the tick hook function for
+         * each stepped tick. */
+        configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+            {
+                configASSERT( ( xTickCount + xTicksToJump ) <= xNextReleaseTime );
+            }
+        #endif
+
+        xTickCount += xTicksToJump;
+        traceINCREASE_TICK_COUNT( xTicksToJump );
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
+{
+    BaseType_t xYieldOccurred;
+
+    /* Must not be called with the scheduler suspended as the implementation
+     * relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
+    configASSERT( uxSchedulerSuspended == 0 );
+
+    /* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
+     * the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
+    vTaskSuspendAll();
+    xPendedTicks += xTicksToCatchUp;
+    xYieldOccurred = xTaskResumeAll();
+
+    return xYieldOccurred;
+}
+/*----------------------------------------------------------*/
+
+#if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+
+    static BaseType_t prvCatchUpTicks( TickType_t xTicksToCatchUp )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+        TickType_t xTicksToSkip, xTicksToOverflow;
+
+        xCatchUpEnd = xTickCount + xTicksToCatchUp;
+        xCatchingUp = pdTRUE;
+
+        while( xTicksToCatchUp > ( TickType_t ) 0U )
+        {
+            /* Nothing is due before the next wake time, so the ticks before it
+             * are only counted.  The last tick is always processed, so that
+             * time slicing still takes place. */
+            xTicksToSkip = prvGetTicksToNextWake();
+
+            if( ( xTicksToSkip == ( TickType_t ) 0U ) || ( xNextTaskUnblockTime <= xTickCount ) )
+            {
+                xTicksToSkip = ( TickType_t ) 0U;
+            }
+            else
+            {
+                xTicksToSkip--;
+            }
+
+            if( xTicksToSkip >= xTicksToCatchUp )
+            {
+                xTicksToSkip = xTicksToCatchUp - ( TickType_t ) 1U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The delayed lists are switched by the tick on which the tick
+             * count overflows, so that tick cannot be skipped. */
+            xTicksToOverflow = ( TickType_t ) 0U - xTickCount;
+
+            if( ( xTicksToOverflow != ( TickType_t ) 0U ) && ( xTicksToSkip >= xTicksToOverflow ) )
+            {
+                xTicksToSkip = xTicksToOverflow - ( TickType_t ) 1U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xTickCount += xTicksToSkip;
+            traceINCREASE_TICK_COUNT( xTicksToSkip );
+            xTicksToCatchUp -= xTicksToSkip;
+
+            if( xTaskIncrementTick() != pdFALSE )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xTicksToCatchUp--;
+        }
+
+        xCatchingUp = pdFALSE;
+
+        return xSwitchRequired;
+    }
+/*----------------------------------------------------------*/
+
+    static TickType_t prvSkipMissedReleases( TCB_t * pxTCB,
+                                             TickType_t xReleaseTime )
+    {
+        TickType_t xBehind, xSkipped;
+
+        if( ( xCatchingUp != pdFALSE ) && ( pxTCB->pxTaskReleaseTime != NULL ) )
+        {
+            /* Only a release at least a whole period before the end of the
+             * catch-up is behind.  The task was blocked in xTaskDelayUntil()
+             * with its own period, so that period is non-zero. */
+            xBehind = xCatchUpEnd - xReleaseTime;
+
+            if( ( xBehind >= pxTCB->xTaskPeriod ) && ( xBehind <= ( portMAX_DELAY >> 1 ) ) )
+            {
+                xSkipped = xBehind / pxTCB->xTaskPeriod;
+                xReleaseTime += xSkipped * pxTCB->xTaskPeriod;
+                pxTCB->uxTaskDeadlineMisses += ( UBaseType_t ) xSkipped;
+                taskDEADLINES_MISSED( pxTCB, xSkipped );
+
+                /* The task is still blocked in xTaskDelayUntil(), so its wake
+                 * time can be moved on for its next call. */
+                *( pxTCB->pxTaskReleaseTime ) = xReleaseTime;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The task leaves xTaskDelayUntil(). */
+        pxTCB->pxTaskReleaseTime = NULL;
+
+        return xReleaseTime;
+    }
+
+#endif /* configUSE_BULK_TICK_CATCH_UP */
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskAbortDelay == 1 )
+
+    BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB = xTask;
+        BaseType_t xReturn;
+
+        configASSERT( pxTCB );
+
+        vTaskSuspendAll();
+        {
+            /* A task can only be prematurely removed from the Blocked state if
+             * it is actually in the Blocked state. */
+            if( eTaskGetState( xTask ) == eBlocked )
+            {
+                xReturn = pdPASS;
+
+                /* Remove the reference to the task from the blocked list.  An
+                 * interrupt won't touch the xStateListItem because the
+                 * scheduler is suspended. */
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+                /* Is the task waiting on an event also?  If so remove it from
+                 * the event list too.  Interrupts can touch the event list item,
+                 * even though the scheduler is suspended, so a critical section
+                 * is used. */
+                taskENTER_CRITICAL();
+                {
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+
+                        /* This lets the task know it was forcibly removed from the
+                         * blocked state so it should not re-evaluate its block time and
+                         * then block again. */
+                        pxTCB->ucDelayAborted = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                /* Place the unblocked task into the appropriate ready list. */
+                prvAddTaskToReadyList( pxTCB );
+
+                /* A task being unblocked cannot cause an immediate context
+                 * switch if preemption is turned off. */
+                #if ( configUSE_PREEMPTION == 1 )
+                    {
+                        /* Preemption is on, but a context switch should only be
+                         * performed if the unblocked task has a priority that is
+                         * higher than the currently executing task. */
+                        #if ( configUSE_EDF_SCHEDULER == 1 )
+                            if( taskEDF_SHOULD_PREEMPT_STRICT( pxTCB ) )
+                        #else
+                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        #endif
+                        {
+                            /* Pend the yield to be performed when the scheduler
+                             * is unsuspended. */
+                            xYieldPending = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* configUSE_PREEMPTION */
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+
+#endif /* INCLUDE_xTaskAbortDelay */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskIncrementTick( void )
+{
+    TCB_t * pxTCB;
+    TickType_t xItemValue;
+    BaseType_t xSwitchRequired = pdFALSE;
+
+    taskPROFILE_START( taskPROFILE_TICK );
+
+    /* Called by the portable layer each time a tick interrupt occurs.
+     * Increments the tick then checks to see if the new tick value will cause any
+     * tasks to be unblocked. */
+    #if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+        {
+            /* Nothing happens on the ticks before the one this interrupt was
+             * programmed for, they are only counted. */
+            taskCATCH_UP_EVENT_TICKS();
+        }
+    #endif
+
+    traceTASK_INCREMENT_TICK( xTickCount );
+
+    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+    {
+        /* Minor optimisation.  The tick count cannot change in this
+         * block. */
+        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
+
+        /* Increment the RTOS tick, switching the delayed and overflowed
+         * delayed lists if it wraps to 0. */
+        xTickCount = xConstTickCount;
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_DEADLINES == 1 ) )
+            {
+                /* The tasks released by this tick take their deadlines from
+                 * this count. */
+                ulTickTime = portEDF_GET_DEADLINE_TIME();
+                xTickTimeTick = xConstTickCount;
+            }
+        #endif
+
+        #if ( configUSE_CPU_LOAD_WINDOWS == 1 )
+            {
+                /* Ticks the tick interrupt did not see, suppressed or caught up,
+                 * only make the sample that spans them longer. */
+                if( ( TickType_t ) ( xConstTickCount - xLoadSampleTick ) >= configCPU_LOAD_SAMPLE_TICKS )
+                {
+                    xLoadSampleTick = xConstTickCount;
+                    prvSampleCpuLoad();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+        {
+            taskSWITCH_DELAYED_LISTS();
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+                {
+                    taskSWITCH_RELEASE_LISTS();
+                }
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* See if this tick has made a timeout expire.  Tasks are stored in
+         * the  queue in the order of their wake time - meaning once one task
+         * has been found whose block time has not expired there is no need to
+         * look any further down the list. */
+        if( xConstTickCount >= xNextTaskUnblockTime )
+        {
+            for( ; ; )
+            {
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                    pxTCB = prvGetExpiredDelayedTask( xConstTickCount );
+
+                    if( pxTCB == NULL )
+                    {
+                        /* Every task due at this tick has been woken, find
+                         * the next wake time in the wheel. */
+                        prvResetNextTaskUnblockTime();
+                        break;
+                    }
+                    else
+                #else
+                    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+                    {
+                        /* The delayed list is empty.  Set xNextTaskUnblockTime
+                         * to the maximum possible value so it is extremely
+                         * unlikely that the
+                         * if( xTickCount >= xNextTaskUnblockTime ) test will pass
+                         * next time through. */
+                        xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                        break;
+                    }
+                    else
+                #endif /* configUSE_DELAYED_TASK_WHEEL */
+                {
+                    #if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+                        {
+                            /* The delayed list is not empty, get the value of
+                             * the item at the head of the delayed list.  This is
+                             * the time at which the task at the head of the
+                             * delayed list must be removed from the Blocked
+                             * state. */
+                            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                            xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+                            if( xConstTickCount < xItemValue )
+                            {
+                                /* It is not time to unblock this item yet, but
+                                 * the item value is the time at which the task
+                                 * at the head of the blocked list must be
+                                 * removed from the Blocked state -  so record
+                                 * the item value in xNextTaskUnblockTime. */
+                                xNextTaskUnblockTime = xItemValue;
+                                break; /*lint !e9011 Code structure here is deemed easier to understand with multiple breaks. */
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    #endif /* configUSE_DELAYED_TASK_WHEEL */
+
+                    /* It is time to remove the item from the Blocked state. */
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+                    /* Is the task waiting on an event also?  If so remove
+                     * it from the event list. */
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    #if ( configUSE_BULK_TICK_CATCH_UP == 1 )
+                        {
+                            /* A task that fell behind while the ticks were
+                             * suspended is released at its last release. */
+                            listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), prvSkipMissedReleases( pxTCB, listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) ) );
+                        }
+                    #endif
+                  /**********************************************************************/
+                    /* The wake time is the release time of the new job. */
+                    xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+				  /* Update Task New Deadline */
+					#if (configUSE_EDF_SCHEDULER == 1)
+		taskEDF_SET_RELEASE( pxTCB, xItemValue );
+					#endif
+
+                    /* Recorded once the job has its deadline. */
+                    taskJOB_RELEASED( pxTCB, xItemValue );
+			   /**********************************************************************/
+                    /* Place the unblocked task into the appropriate ready
+                     * list. */
+                    prvAddTaskToReadyList( pxTCB );
+
+                    /* A task being unblocked cannot cause an immediate
+                     * context switch if preemption is turned off. */
+                    #if ( configUSE_PREEMPTION == 1 )
+                        {
+                            /* Preemption is on, but a context switch should
+                             * only be performed if the unblocked task has a
+                             * priority that is equal to or higher than the
+                             * currently executing task. */
+							 
+		/**********************************************************************************/ 
+				   #if (configUSE_EDF_SCHEDULER == 1)
+					    if( taskEDF_SHOULD_PREEMPT( pxTCB ) )
+                                {
+                                    xSwitchRequired = pdTRUE;
+                                }
+                       else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+			        #else
+                        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                                {
+                                    xSwitchRequired = pdTRUE;
+                                }
+                    else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+							#endif
+                        }
+                    #endif /* configUSE_PREEMPTION */
+                }
+            }
+        }
+			/**********************************************************************************/
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+            {
+                if( xConstTickCount >= xNextReleaseTime )
+                {
+                    if( prvReleasePeriodicTasks( xConstTickCount ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOBS == 1 ) )
+            {
+                if( prvReleaseJobs() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        /* Tasks of equal priority to the currently running task will share
+         * processing time (time slice) if preemption is on, and the application
+         * writer has not explicitly turned time slicing off. */
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+            {
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( pxCurrentTCB->uxPriority == configEDF_PRIORITY_BAND )
+                    {
+                        /* Tasks of the EDF band do not share time, the head of
+                         * the EDF ready list keeps running.  A switch is only
+                         * needed if another task has moved in front of it. */
+                        if( listGET_OWNER_OF_HEAD_ENTRY( &xReadyTasksListEDF ) != pxCurrentTCB )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                #endif /* configUSE_EDF_SCHEDULER */
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+        #if ( configUSE_TICK_HOOK == 1 )
+            {
+                /* Guard against the tick hook being called when the pended tick
+                 * count is being unwound (when the scheduler is being unlocked). */
+                if( xPendedTicks == ( TickType_t ) 0 )
+                {
+                    vApplicationTickHook();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_TICK_HOOK */
+
+        #if ( configUSE_PREEMPTION == 1 )
+            {
+                if( xYieldPending != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_PREEMPTION */
+    }
+    else
+    {
+        ++xPendedTicks;
+
+        /* The tick hook gets called at regular intervals, even if the
+         * scheduler is locked. */
+        #if ( configUSE_TICK_HOOK == 1 )
+            {
+                vApplicationTickHook();
+            }
+        #endif
+    }
+
+    #if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+        {
+            taskSET_NEXT_TICK_EVENT();
+        }
+    #endif
+
+    taskPROFILE_END( taskPROFILE_TICK );
+
+    return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
+                                     TaskHookFunction_t pxHookFunction )
+    {
+        TCB_t * xTCB;
+
+        /* If xTask is NULL then it is the task hook of the calling task that is
+         * getting set. */
+        if( xTask == NULL )
+        {
+            xTCB = ( TCB_t * ) pxCurrentTCB;
+        }
+        else
+        {
+            xTCB = xTask;
+        }
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        taskENTER_CRITICAL();
+        {
+            xTCB->pxTaskTag = pxHookFunction;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        TaskHookFunction_t xReturn;
+
+        /* If xTask is NULL then set the calling task's hook. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        taskENTER_CRITICAL();
+        {
+            xReturn = pxTCB->pxTaskTag;
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        TaskHookFunction_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* If xTask is NULL then set the calling task's hook. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xReturn = pxTCB->pxTaskTag;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
+                                             void * pvParameter )
+    {
+        TCB_t * xTCB;
+        BaseType_t xReturn;
+
+        /* If xTask is NULL then we are calling our own task hook. */
+        if( xTask == NULL )
+        {
+            xTCB = pxCurrentTCB;
+        }
+        else
+        {
+            xTCB = xTask;
+        }
+
+        if( xTCB->pxTaskTag != NULL )
+        {
+            xReturn = xTCB->pxTaskTag( pvParameter );
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+void vTaskSwitchContext( void )
+{
+    #if ( configUSE_TRACE_RECORDER == 1 )
+        TCB_t * const pxPreviousTCB = pxCurrentTCB;
+    #endif
+
+    taskPROFILE_START( taskPROFILE_SWITCH );
+
+    if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+    {
+        /* The scheduler is currently suspended - do not allow a context
+         * switch. */
+        xYieldPending = pdTRUE;
+    }
+    else
+    {
+        xYieldPending = pdFALSE;
+        traceTASK_SWITCHED_OUT();
+
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            {
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
+                #else
+                    ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+
+                /* Add the amount of time the task has been running to the
+                 * accumulated time so far.  The time the task started running was
+                 * stored in ulTaskSwitchedInTime.  Note that there is no overflow
+                 * protection here so count values are only valid until the timer
+                 * overflows.  The guard against negative values is to protect
+                 * against suspect run time stat counter implementations - which
+                 * are provided by the application, not the kernel. */
+                if( ulTotalRunTime > ulTaskSwitchedInTime )
+                {
+                    pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                ulTaskSwitchedInTime = ulTotalRunTime;
+            }
+        #endif /* configGENERATE_RUN_TIME_STATS */
+
+        /* Check for stack overflow, if configured. */
+        taskCHECK_FOR_STACK_OVERFLOW();
+
+        /* Before the currently running task is switched out, save its errno. */
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            {
+                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+            }
+        #endif
+		
+/*****************************************************************************/
+        /* Select a new task to run using either the generic C or port
+         * optimised asm code. */
+		 /* Every time the running task is
+suspended, or a suspended task with an higher priority than the running task awakes, a switch
+context occurs. vT askSwitchContext() method is in charge to update the *pxCurrentTCB pointer to the new running task*/
+
+
+        #if ( configUSE_KERNEL_PROFILING == 1 )
+            {
+                /* The time other tasks run is not counted against a critical
+                 * section the task switched out inside. */
+                if( pxCurrentTCB->uxProfileCriticalNesting != ( UBaseType_t ) 0U )
+                {
+                    pxCurrentTCB->ulProfileCriticalTime += ulProfileStart[ taskPROFILE_SWITCH ] - pxCurrentTCB->ulProfileCriticalStart;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+		/* The EDF band is one of the priority lists, so the same O(1) search
+		 * through uxTopReadyPriority serves both policies. */
+		taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+        #if ( configUSE_KERNEL_PROFILING == 1 )
+            {
+                if( pxCurrentTCB->uxProfileCriticalNesting != ( UBaseType_t ) 0U )
+                {
+                    pxCurrentTCB->ulProfileCriticalStart = portPROFILE_GET_TIME();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        #if ( configUSE_ISR_LATENCY == 1 )
+            {
+                /* The first run of a task an ISR woke. */
+                if( pxCurrentTCB->uxLatencySource != ( UBaseType_t ) 0U )
+                {
+                    prvProfileAdd( &( xLatencyStats[ pxCurrentTCB->uxLatencySource - ( UBaseType_t ) 1U ] ), portLATENCY_GET_TIME() - pxCurrentTCB->ulLatencyStart );
+                    pxCurrentTCB->uxLatencySource = ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+		traceTASK_SWITCHED_IN();
+        taskGPIO_TRACE_TASK( pxCurrentTCB );
+
+        #if ( configUSE_JOB_HISTOGRAMS == 1 )
+            {
+                /* ulTotalRunTime was read above, as the task was switched out. */
+                if( ( pxCurrentTCB->xJobStarted == pdFALSE ) && ( pxCurrentTCB->xTaskPeriod != ( TickType_t ) 0U ) )
+                {
+                    pxCurrentTCB->xJobStarted = pdTRUE;
+                    prvJobHistogramAdd( pxCurrentTCB, taskJOB_RELEASE_JITTER, ( uint32_t ) ( ulTotalRunTime - pxCurrentTCB->ulJobReleaseTime ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        #if ( configUSE_TRACE_RECORDER == 1 )
+            {
+                /* Only a change of task is recorded. */
+                if( pxCurrentTCB != pxPreviousTCB )
+                {
+                    taskTRACE_RECORD( taskTRACE_SWITCH_OUT, pxPreviousTCB, xTickCount & 0xFFFFU );
+                    taskTRACE_RECORD( taskTRACE_SWITCH_IN, pxCurrentTCB, xTickCount & 0xFFFFU );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+        /*********************************************************************************/
+
+        #if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+            {
+                /* Time slicing depends on the task now running. */
+                taskSET_NEXT_TICK_EVENT();
+            }
+        #endif
+
+
+		/* After the new task is switched in, update the global errno. */
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            {
+                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+            }
+        #endif
+
+        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+            {
+                /* Switch Newlib's _impure_ptr variable to point to the _reent
+                 * structure specific to this task.
+                 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+                 * for additional information. */
+                _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+            }
+        #endif /* configUSE_NEWLIB_REENTRANT */
+    }
+
+    taskPROFILE_END( taskPROFILE_SWITCH );
+}
+/*-----------------------------------------------------------*/
 
 void vTaskPlaceOnEventList( List_t * const pxEventList,
                             const TickType_t xTicksToWait )
 {
-    configASSERT( pxEventList );
+    configASSERT( pxEventList );
+
+    /* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
+     * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+
+    /* Place the event list item of the TCB in the appropriate event list.
+     * This is placed in the list in priority order so the highest priority task
+     * is the first to be woken by the event.
+     *
+     * Note: Lists are sorted in ascending order by ListItem_t.xItemValue.
+     * Normally, the xItemValue of a TCB's ListItem_t members is:
+     *      xItemValue = ( configMAX_PRIORITIES - uxPriority )
+     * Therefore, the event list is sorted in descending priority order.
+     *
+     * The queue that contains the event list is locked, preventing
+     * simultaneous access from interrupts. */
+    vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
+                                     const TickType_t xItemValue,
+                                     const TickType_t xTicksToWait )
+{
+    configASSERT( pxEventList );
+
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+     * the event groups implementation. */
+    configASSERT( uxSchedulerSuspended != 0 );
+
+    /* Store the item value in the event list item.  It is safe to access the
+     * event list item here as interrupts won't access the event list item of a
+     * task that is not in the Blocked state. */
+    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+    /* Place the event list item of the TCB at the end of the appropriate event
+     * list.  It is safe to access the event list here because it is part of an
+     * event group implementation - and interrupts don't access event groups
+     * directly (instead they access them indirectly by pending function calls to
+     * the task level). */
+    listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMERS == 1 )
+
+    void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
+                                          TickType_t xTicksToWait,
+                                          const BaseType_t xWaitIndefinitely )
+    {
+        configASSERT( pxEventList );
+
+        /* This function should not be called by application code hence the
+         * 'Restricted' in its name.  It is not part of the public API.  It is
+         * designed for use by kernel code, and has special calling requirements -
+         * it should be called with the scheduler suspended. */
+
+
+        /* Place the event list item of the TCB in the appropriate event list.
+         * In this case it is assume that this is the only task that is going to
+         * be waiting on this event list, so the faster vListInsertEnd() function
+         * can be used in place of vListInsert. */
+        listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+        /* If the task should block indefinitely then set the block time to a
+         * value that will be recognised as an indefinite delay inside the
+         * prvAddCurrentTaskToDelayedList() function. */
+        if( xWaitIndefinitely != pdFALSE )
+        {
+            xTicksToWait = portMAX_DELAY;
+        }
+
+        traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
+        prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+    }
+
+#endif /* configUSE_TIMERS */
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+{
+    TCB_t * pxUnblockedTCB;
+    BaseType_t xReturn;
+
+    /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+     * called from a critical section within an ISR. */
+
+    /* The event list is sorted in priority order, so the first in the list can
+     * be removed as it is known to be the highest priority.  Remove the TCB from
+     * the delayed list, and add it to the ready list.
+     *
+     * If an event is for a queue that is locked then this function will never
+     * get called - the lock count on the queue will get modified instead.  This
+     * means exclusive access to the event list is guaranteed here.
+     *
+     * This function assumes that a check has already been made to ensure that
+     * pxEventList is not empty. */
+    pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+    configASSERT( pxUnblockedTCB );
+    listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
+
+    /* Only stamps the task when called from an ISR that is timed. */
+    taskLATENCY_WOKEN( pxUnblockedTCB );
+
+    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+    {
+        listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+        prvAddTaskToReadyList( pxUnblockedTCB );
+
+        #if ( configUSE_TICKLESS_IDLE != 0 )
+            {
+                /* If a task is blocked on a kernel object then xNextTaskUnblockTime
+                 * might be set to the blocked task's time out time.  If the task is
+                 * unblocked for a reason other than a timeout xNextTaskUnblockTime is
+                 * normally left unchanged, because it is automatically reset to a new
+                 * value when the tick count equals xNextTaskUnblockTime.  However if
+                 * tickless idling is used it might be more important to enter sleep mode
+                 * at the earliest possible time - so reset xNextTaskUnblockTime here to
+                 * ensure it is updated at the earliest possible time. */
+                prvResetNextTaskUnblockTime();
+            }
+        #endif
+    }
+    else
+    {
+        /* The delayed and ready lists cannot be accessed, so hold this task
+         * pending until the scheduler is resumed. */
+        listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+    }
+
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        if( taskEDF_SHOULD_PREEMPT_STRICT( pxUnblockedTCB ) )
+    #else
+        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    #endif
+    {
+        /* Return true if the task removed from the event list has a higher
+         * priority than the calling task.  This allows the calling task to know if
+         * it should force a context switch now. */
+        xReturn = pdTRUE;
+
+        /* Mark that a yield is pending in case the user is not using the
+         * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
+        xYieldPending = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
+                                        const TickType_t xItemValue )
+{
+    TCB_t * pxUnblockedTCB;
+
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+     * the event flags implementation. */
+    configASSERT( uxSchedulerSuspended != pdFALSE );
+
+    /* Store the new item value in the event list. */
+    listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+    /* Remove the event list form the event flag.  Interrupts do not access
+     * event flags. */
+    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+    configASSERT( pxUnblockedTCB );
+    listREMOVE_ITEM( pxEventListItem );
+
+    #if ( configUSE_TICKLESS_IDLE != 0 )
+        {
+            /* If a task is blocked on a kernel object then xNextTaskUnblockTime
+             * might be set to the blocked task's time out time.  If the task is
+             * unblocked for a reason other than a timeout xNextTaskUnblockTime is
+             * normally left unchanged, because it is automatically reset to a new
+             * value when the tick count equals xNextTaskUnblockTime.  However if
+             * tickless idling is used it might be more important to enter sleep mode
+             * at the earliest possible time - so reset xNextTaskUnblockTime here to
+             * ensure it is updated at the earliest possible time. */
+            prvResetNextTaskUnblockTime();
+        }
+    #endif
+
+    /* Remove the task from the delayed list and add it to the ready list.  The
+     * scheduler is suspended so interrupts will not be accessing the ready
+     * lists. */
+    listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+    prvAddTaskToReadyList( pxUnblockedTCB );
+
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        if( taskEDF_SHOULD_PREEMPT_STRICT( pxUnblockedTCB ) )
+    #else
+        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    #endif
+    {
+        /* The unblocked task has a priority above that of the calling task, so
+         * a context switch is required.  This function is called with the
+         * scheduler suspended so xYieldPending is set so the context switch
+         * occurs immediately that the scheduler is resumed (unsuspended). */
+        xYieldPending = pdTRUE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+    configASSERT( pxTimeOut );
+    taskENTER_CRITICAL();
+    {
+        taskCATCH_UP_EVENT_TICKS();
+        pxTimeOut->xOverflowCount = xNumOfOverflows;
+        pxTimeOut->xTimeOnEntering = xTickCount;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+    /* For internal use only as it does not use a critical section. */
+    pxTimeOut->xOverflowCount = xNumOfOverflows;
+    pxTimeOut->xTimeOnEntering = xTickCount;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
+                                 TickType_t * const pxTicksToWait )
+{
+    BaseType_t xReturn;
+
+    configASSERT( pxTimeOut );
+    configASSERT( pxTicksToWait );
+
+    taskENTER_CRITICAL();
+    {
+        /* Minor optimisation.  The tick count cannot change in this block. */
+        TickType_t xConstTickCount;
+        TickType_t xElapsedTime;
+
+        taskCATCH_UP_EVENT_TICKS();
+        xConstTickCount = xTickCount;
+        xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
+
+        #if ( INCLUDE_xTaskAbortDelay == 1 )
+            if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
+            {
+                /* The delay was aborted, which is not the same as a time out,
+                 * but has the same result. */
+                pxCurrentTCB->ucDelayAborted = pdFALSE;
+                xReturn = pdTRUE;
+            }
+            else
+        #endif
+
+        #if ( INCLUDE_vTaskSuspend == 1 )
+            if( *pxTicksToWait == portMAX_DELAY )
+            {
+                /* If INCLUDE_vTaskSuspend is set to 1 and the block time
+                 * specified is the maximum block time then the task should block
+                 * indefinitely, and therefore never time out. */
+                xReturn = pdFALSE;
+            }
+            else
+        #endif
+
+        if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
+        {
+            /* The tick count is greater than the time at which
+             * vTaskSetTimeout() was called, but has also overflowed since
+             * vTaskSetTimeOut() was called.  It must have wrapped all the way
+             * around and gone past again. This passed since vTaskSetTimeout()
+             * was called. */
+            xReturn = pdTRUE;
+            *pxTicksToWait = ( TickType_t ) 0;
+        }
+        else if( xElapsedTime < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
+        {
+            /* Not a genuine timeout. Adjust parameters for time remaining. */
+            *pxTicksToWait -= xElapsedTime;
+            vTaskInternalSetTimeOutState( pxTimeOut );
+            xReturn = pdFALSE;
+        }
+        else
+        {
+            *pxTicksToWait = ( TickType_t ) 0;
+            xReturn = pdTRUE;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskMissedYield( void )
+{
+    xYieldPending = pdTRUE;
+}
+/*-----------------------------------------------------------*/
 
-    /* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
-     * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-    /* Place the event list item of the TCB in the appropriate event list.
-     * This is placed in the list in priority order so the highest priority task
-     * is the first to be woken by the event.
-     *
-     * Note: Lists are sorted in ascending order by ListItem_t.xItemValue.
-     * Normally, the xItemValue of a TCB's ListItem_t members is:
-     *      xItemValue = ( configMAX_PRIORITIES - uxPriority )
-     * Therefore, the event list is sorted in descending priority order.
-     *
-     * The queue that contains the event list is locked, preventing
-     * simultaneous access from interrupts. */
-    vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+    UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
+    {
+        UBaseType_t uxReturn;
+        TCB_t const * pxTCB;
+
+        if( xTask != NULL )
+        {
+            pxTCB = xTask;
+            uxReturn = pxTCB->uxTaskNumber;
+        }
+        else
+        {
+            uxReturn = 0U;
+        }
+
+        return uxReturn;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    void vTaskSetTaskNumber( TaskHandle_t xTask,
+                             const UBaseType_t uxHandle )
+    {
+        TCB_t * pxTCB;
+
+        if( xTask != NULL )
+        {
+            pxTCB = xTask;
+            pxTCB->uxTaskNumber = uxHandle;
+        }
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+
+/*
+ * -----------------------------------------------------------
+ * The Idle task.
+ * ----------------------------------------------------------
+ *
+ * The portTASK_FUNCTION() macro is used to allow port/compiler specific
+ * language extensions.  The equivalent prototype for this function is:
+ *
+ * void prvIdleTask( void *pvParameters );
+ *
+ */
+static portTASK_FUNCTION( prvIdleTask, pvParameters )
+{
+    /* Stop warnings. */
+    ( void ) pvParameters;
+
+    /** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
+     * SCHEDULER IS STARTED. **/
+
+    /* In case a task that has a secure context deletes itself, in which case
+     * the idle task is responsible for deleting the task's secure context, if
+     * any. */
+    portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
+
+    for( ; ; )
+    {
+        /* See if any tasks have deleted themselves - if so then the idle task
+         * is responsible for freeing the deleted task's TCB and stack. */
+        prvCheckTasksWaitingTermination();
+
+        #if ( configUSE_PREEMPTION == 0 )
+            {
+                /* If we are not using preemption we keep forcing a task switch to
+                 * see if any other task has become available.  If we are using
+                 * preemption we don't need to do this as any task becoming available
+                 * will automatically get the processor anyway. */
+                taskYIELD();
+            }
+        #endif /* configUSE_PREEMPTION */
+
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+            {
+                /* When using preemption tasks of equal priority will be
+                 * timesliced.  If a task that is sharing the idle priority is ready
+                 * to run then the idle task should yield before the end of the
+                 * timeslice.
+                 *
+                 * A critical region is not required here as we are just reading from
+                 * the list, and an occasional incorrect value will not matter.  If
+                 * the ready list at the idle priority contains more than one task
+                 * then a task other than the idle task is ready to execute. */
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+                {
+                    taskYIELD();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
+
+        #if ( configUSE_IDLE_HOOK == 1 )
+            {
+                extern void vApplicationIdleHook( void );
+
+                /* Call the user defined function from within the idle task.  This
+                 * allows the application designer to add background functionality
+                 * without the overhead of a separate task.
+                 * NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
+                 * CALL A FUNCTION THAT MIGHT BLOCK. */
+                vApplicationIdleHook();
+            }
+        #endif /* configUSE_IDLE_HOOK */
+
+        /* This conditional compilation should use inequality to 0, not equality
+         * to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
+         * user defined low power mode  implementations require
+         * configUSE_TICKLESS_IDLE to be set to a value other than 1. */
+        #if ( configUSE_TICKLESS_IDLE != 0 )
+            {
+                TickType_t xExpectedIdleTime;
+
+                /* It is not desirable to suspend then resume the scheduler on
+                 * each iteration of the idle task.  Therefore, a preliminary
+                 * test of the expected idle time is performed without the
+                 * scheduler suspended.  The result here is not necessarily
+                 * valid. */
+                xExpectedIdleTime = prvGetExpectedIdleTime();
+
+                if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+                {
+                    vTaskSuspendAll();
+                    {
+                        /* Now the scheduler is suspended, the expected idle
+                         * time can be sampled again, and this time its value can
+                         * be used. */
+                        configASSERT( xNextTaskUnblockTime >= xTickCount );
+                        xExpectedIdleTime = prvGetExpectedIdleTime();
+
+                        /* Define the following macro to set xExpectedIdleTime to 0
+                         * if the application does not want
+                         * portSUPPRESS_TICKS_AND_SLEEP() to be called. */
+                        configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
+
+                        if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+                        {
+                            traceLOW_POWER_IDLE_BEGIN();
+                            portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
+                            traceLOW_POWER_IDLE_END();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    ( void ) xTaskResumeAll();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_TICKLESS_IDLE */
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+    eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+    {
+        /* The idle task exists in addition to the application tasks. */
+        const UBaseType_t uxNonApplicationTasks = 1;
+        eSleepModeStatus eReturn = eStandardSleep;
+
+        /* This function must be called from a critical section. */
+
+        if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
+        {
+            /* A task was made ready while the scheduler was suspended. */
+            eReturn = eAbortSleep;
+        }
+        else if( xYieldPending != pdFALSE )
+        {
+            /* A yield was pended while the scheduler was suspended. */
+            eReturn = eAbortSleep;
+        }
+        else if( xPendedTicks != 0 )
+        {
+            /* A tick interrupt has already occurred but was held pending
+             * because the scheduler is suspended. */
+            eReturn = eAbortSleep;
+        }
+        else
+        {
+            /* If all the tasks are in the suspended list (which might mean they
+             * have an infinite block time rather than actually being suspended)
+             * then it is safe to turn all clocks off and just wait for external
+             * interrupts. */
+            if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+            {
+                eReturn = eNoTasksWaitingTimeout;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return eReturn;
+    }
 
-    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-}
+#endif /* configUSE_TICKLESS_IDLE */
 /*-----------------------------------------------------------*/
 
-void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
-                                     const TickType_t xItemValue,
-                                     const TickType_t xTicksToWait )
-{
-    configASSERT( pxEventList );
-
-    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-     * the event groups implementation. */
-    configASSERT( uxSchedulerSuspended != 0 );
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
-    /* Store the item value in the event list item.  It is safe to access the
-     * event list item here as interrupts won't access the event list item of a
-     * task that is not in the Blocked state. */
-    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
+                                            BaseType_t xIndex,
+                                            void * pvValue )
+    {
+        TCB_t * pxTCB;
 
-    /* Place the event list item of the TCB at the end of the appropriate event
-     * list.  It is safe to access the event list here because it is part of an
-     * event group implementation - and interrupts don't access event groups
-     * directly (instead they access them indirectly by pending function calls to
-     * the task level). */
-    listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        {
+            pxTCB = prvGetTCBFromHandle( xTaskToSet );
+            configASSERT( pxTCB != NULL );
+            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+        }
+    }
 
-    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-}
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TIMERS == 1 )
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
-    void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
-                                          TickType_t xTicksToWait,
-                                          const BaseType_t xWaitIndefinitely )
+    void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
+                                               BaseType_t xIndex )
     {
-        configASSERT( pxEventList );
-
-        /* This function should not be called by application code hence the
-         * 'Restricted' in its name.  It is not part of the public API.  It is
-         * designed for use by kernel code, and has special calling requirements -
-         * it should be called with the scheduler suspended. */
-
-
-        /* Place the event list item of the TCB in the appropriate event list.
-         * In this case it is assume that this is the only task that is going to
-         * be waiting on this event list, so the faster vListInsertEnd() function
-         * can be used in place of vListInsert. */
-        listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        void * pvReturn = NULL;
+        TCB_t * pxTCB;
 
-        /* If the task should block indefinitely then set the block time to a
-         * value that will be recognised as an indefinite delay inside the
-         * prvAddCurrentTaskToDelayedList() function. */
-        if( xWaitIndefinitely != pdFALSE )
+        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
         {
-            xTicksToWait = portMAX_DELAY;
+            pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+        }
+        else
+        {
+            pvReturn = NULL;
         }
 
-        traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
-        prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+        return pvReturn;
     }
 
-#endif /* configUSE_TIMERS */
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
-{
-    TCB_t * pxUnblockedTCB;
-    BaseType_t xReturn;
-
-    /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
-     * called from a critical section within an ISR. */
-
-    /* The event list is sorted in priority order, so the first in the list can
-     * be removed as it is known to be the highest priority.  Remove the TCB from
-     * the delayed list, and add it to the ready list.
-     *
-     * If an event is for a queue that is locked then this function will never
-     * get called - the lock count on the queue will get modified instead.  This
-     * means exclusive access to the event list is guaranteed here.
-     *
-     * This function assumes that a check has already been made to ensure that
-     * pxEventList is not empty. */
-    pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-    configASSERT( pxUnblockedTCB );
-    listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
-
-    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-    {
-        listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-        prvAddTaskToReadyList( pxUnblockedTCB );
+#if ( portUSING_MPU_WRAPPERS == 1 )
 
-        #if ( configUSE_TICKLESS_IDLE != 0 )
-            {
-                /* If a task is blocked on a kernel object then xNextTaskUnblockTime
-                 * might be set to the blocked task's time out time.  If the task is
-                 * unblocked for a reason other than a timeout xNextTaskUnblockTime is
-                 * normally left unchanged, because it is automatically reset to a new
-                 * value when the tick count equals xNextTaskUnblockTime.  However if
-                 * tickless idling is used it might be more important to enter sleep mode
-                 * at the earliest possible time - so reset xNextTaskUnblockTime here to
-                 * ensure it is updated at the earliest possible time. */
-                prvResetNextTaskUnblockTime();
-            }
-        #endif
-    }
-    else
+    void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
+                                  const MemoryRegion_t * const xRegions )
     {
-        /* The delayed and ready lists cannot be accessed, so hold this task
-         * pending until the scheduler is resumed. */
-        listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
-    }
+        TCB_t * pxTCB;
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
-    {
-        /* Return true if the task removed from the event list has a higher
-         * priority than the calling task.  This allows the calling task to know if
-         * it should force a context switch now. */
-        xReturn = pdTRUE;
+        /* If null is passed in here then we are modifying the MPU settings of
+         * the calling task. */
+        pxTCB = prvGetTCBFromHandle( xTaskToModify );
 
-        /* Mark that a yield is pending in case the user is not using the
-         * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
-        xYieldPending = pdTRUE;
-    }
-    else
-    {
-        xReturn = pdFALSE;
+        vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
     }
 
-    return xReturn;
-}
+#endif /* portUSING_MPU_WRAPPERS */
 /*-----------------------------------------------------------*/
 
-void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
-                                        const TickType_t xItemValue )
+static void prvInitialiseTaskLists( void )
 {
-    TCB_t * pxUnblockedTCB;
+    UBaseType_t uxPriority;
 
-    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-     * the event flags implementation. */
-    configASSERT( uxSchedulerSuspended != pdFALSE );
+    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+    {
+        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+    }
 
-    /* Store the new item value in the event list. */
-    listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+        {
+            for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE; uxPriority++ )
+            {
+                vListInitialise( &( xDelayedTaskWheel[ uxPriority ] ) );
+            }
+        }
+    #else
+        {
+            vListInitialise( &xDelayedTaskList1 );
+            vListInitialise( &xDelayedTaskList2 );
+        }
+    #endif /* configUSE_DELAYED_TASK_WHEEL */
 
-    /* Remove the event list form the event flag.  Interrupts do not access
-     * event flags. */
-    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-    configASSERT( pxUnblockedTCB );
-    listREMOVE_ITEM( pxEventListItem );
+    vListInitialise( &xPendingReadyList );
 
-    #if ( configUSE_TICKLESS_IDLE != 0 )
+    #if ( INCLUDE_vTaskDelete == 1 )
         {
-            /* If a task is blocked on a kernel object then xNextTaskUnblockTime
-             * might be set to the blocked task's time out time.  If the task is
-             * unblocked for a reason other than a timeout xNextTaskUnblockTime is
-             * normally left unchanged, because it is automatically reset to a new
-             * value when the tick count equals xNextTaskUnblockTime.  However if
-             * tickless idling is used it might be more important to enter sleep mode
-             * at the earliest possible time - so reset xNextTaskUnblockTime here to
-             * ensure it is updated at the earliest possible time. */
-            prvResetNextTaskUnblockTime();
+            vListInitialise( &xTasksWaitingTermination );
         }
-    #endif
+    #endif /* INCLUDE_vTaskDelete */
 
-    /* Remove the task from the delayed list and add it to the ready list.  The
-     * scheduler is suspended so interrupts will not be accessing the ready
-     * lists. */
-    listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-    prvAddTaskToReadyList( pxUnblockedTCB );
+    #if ( INCLUDE_vTaskSuspend == 1 )
+        {
+            vListInitialise( &xSuspendedTaskList );
+        }
+    #endif /* INCLUDE_vTaskSuspend */
+	
+    #if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+        {
+            /* Start with pxDelayedTaskList using list1 and the
+             * pxOverflowDelayedTaskList using list2. */
+            pxDelayedTaskList = &xDelayedTaskList1;
+            pxOverflowDelayedTaskList = &xDelayedTaskList2;
+        }
+    #endif
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
-    {
-        /* The unblocked task has a priority above that of the calling task, so
-         * a context switch is required.  This function is called with the
-         * scheduler suspended so xYieldPending is set so the context switch
-         * occurs immediately that the scheduler is resumed (unsuspended). */
-        xYieldPending = pdTRUE;
-    }
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+        {
+            vListInitialise( &xReleaseList1 );
+            vListInitialise( &xReleaseList2 );
+            pxReleaseList = &xReleaseList1;
+            pxOverflowReleaseList = &xReleaseList2;
+        }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
-void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
+static void prvCheckTasksWaitingTermination( void )
 {
-    configASSERT( pxTimeOut );
-    taskENTER_CRITICAL();
-    {
-        pxTimeOut->xOverflowCount = xNumOfOverflows;
-        pxTimeOut->xTimeOnEntering = xTickCount;
-    }
-    taskEXIT_CRITICAL();
-}
-/*-----------------------------------------------------------*/
+    /** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
 
-void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
-{
-    /* For internal use only as it does not use a critical section. */
-    pxTimeOut->xOverflowCount = xNumOfOverflows;
-    pxTimeOut->xTimeOnEntering = xTickCount;
-}
-/*-----------------------------------------------------------*/
+    #if ( INCLUDE_vTaskDelete == 1 )
+        {
+            TCB_t * pxTCB;
 
-BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
-                                 TickType_t * const pxTicksToWait )
-{
-    BaseType_t xReturn;
+            /* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
+             * being called too often in the idle task. */
+            while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+            {
+                taskENTER_CRITICAL();
+                {
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    --uxCurrentNumberOfTasks;
+                    --uxDeletedTasksWaitingCleanUp;
+                }
+                taskEXIT_CRITICAL();
+
+                prvDeleteTCB( pxTCB );
+            }
+        }
+    #endif /* INCLUDE_vTaskDelete */
+}
+/*-----------------------------------------------------------*/
 
-    configASSERT( pxTimeOut );
-    configASSERT( pxTicksToWait );
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-    taskENTER_CRITICAL();
+    void vTaskGetInfo( TaskHandle_t xTask,
+                       TaskStatus_t * pxTaskStatus,
+                       BaseType_t xGetFreeStackSpace,
+                       eTaskState eState )
     {
-        /* Minor optimisation.  The tick count cannot change in this block. */
-        const TickType_t xConstTickCount = xTickCount;
-        const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
+        TCB_t * pxTCB;
 
-        #if ( INCLUDE_xTaskAbortDelay == 1 )
-            if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
+        /* xTask is NULL then get the state of the calling task. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
+        pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
+        pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
+        pxTaskStatus->pxStackBase = pxTCB->pxStack;
+        pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+
+        #if ( configUSE_MUTEXES == 1 )
             {
-                /* The delay was aborted, which is not the same as a time out,
-                 * but has the same result. */
-                pxCurrentTCB->ucDelayAborted = pdFALSE;
-                xReturn = pdTRUE;
+                pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
+            }
+        #else
+            {
+                pxTaskStatus->uxBasePriority = 0;
             }
-            else
         #endif
 
-        #if ( INCLUDE_vTaskSuspend == 1 )
-            if( *pxTicksToWait == portMAX_DELAY )
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
             {
-                /* If INCLUDE_vTaskSuspend is set to 1 and the block time
-                 * specified is the maximum block time then the task should block
-                 * indefinitely, and therefore never time out. */
-                xReturn = pdFALSE;
+                pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+            }
+        #else
+            {
+                pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
             }
-            else
         #endif
 
-        if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
+        /* Obtaining the task state is a little fiddly, so is only done if the
+         * value of eState passed into this function is eInvalid - otherwise the
+         * state is just set to whatever is passed in. */
+        if( eState != eInvalid )
         {
-            /* The tick count is greater than the time at which
-             * vTaskSetTimeout() was called, but has also overflowed since
-             * vTaskSetTimeOut() was called.  It must have wrapped all the way
-             * around and gone past again. This passed since vTaskSetTimeout()
-             * was called. */
-            xReturn = pdTRUE;
-            *pxTicksToWait = ( TickType_t ) 0;
+            if( pxTCB == pxCurrentTCB )
+            {
+                pxTaskStatus->eCurrentState = eRunning;
+            }
+            else
+            {
+                pxTaskStatus->eCurrentState = eState;
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                    {
+                        /* If the task is in the suspended list then there is a
+                         *  chance it is actually just blocked indefinitely - so really
+                         *  it should be reported as being in the Blocked state. */
+                        if( eState == eSuspended )
+                        {
+                            vTaskSuspendAll();
+                            {
+                                if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                                {
+                                    pxTaskStatus->eCurrentState = eBlocked;
+                                }
+                            }
+                            ( void ) xTaskResumeAll();
+                        }
+                    }
+                #endif /* INCLUDE_vTaskSuspend */
+            }
         }
-        else if( xElapsedTime < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
+        else
         {
-            /* Not a genuine timeout. Adjust parameters for time remaining. */
-            *pxTicksToWait -= xElapsedTime;
-            vTaskInternalSetTimeOutState( pxTimeOut );
-            xReturn = pdFALSE;
+            pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+        }
+
+        /* Obtaining the stack space takes some time, so the xGetFreeStackSpace
+         * parameter is provided to allow it to be skipped. */
+        if( xGetFreeStackSpace != pdFALSE )
+        {
+            #if ( portSTACK_GROWTH > 0 )
+                {
+                    pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+                }
+            #else
+                {
+                    pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+                }
+            #endif
         }
         else
         {
-            *pxTicksToWait = ( TickType_t ) 0;
-            xReturn = pdTRUE;
+            pxTaskStatus->usStackHighWaterMark = 0;
         }
     }
-    taskEXIT_CRITICAL();
-
-    return xReturn;
-}
-/*-----------------------------------------------------------*/
 
-void vTaskMissedYield( void )
-{
-    xYieldPending = pdTRUE;
-}
+#endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-    UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
+    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
+                                                     List_t * pxList,
+                                                     eTaskState eState )
     {
-        UBaseType_t uxReturn;
-        TCB_t const * pxTCB;
+        configLIST_VOLATILE TCB_t * pxNextTCB, * pxFirstTCB;
+        UBaseType_t uxTask = 0;
 
-        if( xTask != NULL )
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
         {
-            pxTCB = xTask;
-            uxReturn = pxTCB->uxTaskNumber;
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            /* Populate an TaskStatus_t structure within the
+             * pxTaskStatusArray array for each task that is referenced from
+             * pxList.  See the definition of TaskStatus_t in task.h for the
+             * meaning of each TaskStatus_t structure member. */
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
+                uxTask++;
+            } while( pxNextTCB != pxFirstTCB );
         }
         else
         {
-            uxReturn = 0U;
+            mtCOVERAGE_TEST_MARKER();
         }
 
-        return uxReturn;
+        return uxTask;
     }
 
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
 
-    void vTaskSetTaskNumber( TaskHandle_t xTask,
-                             const UBaseType_t uxHandle )
+    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
     {
-        TCB_t * pxTCB;
+        uint32_t ulCount = 0U;
 
-        if( xTask != NULL )
+        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
         {
-            pxTCB = xTask;
-            pxTCB->uxTaskNumber = uxHandle;
+            pucStackByte -= portSTACK_GROWTH;
+            ulCount++;
         }
+
+        ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
+
+        return ( configSTACK_DEPTH_TYPE ) ulCount;
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+/*-----------------------------------------------------------*/
 
-/*
- * -----------------------------------------------------------
- * The Idle task.
- * ----------------------------------------------------------
- *
- * The portTASK_FUNCTION() macro is used to allow port/compiler specific
- * language extensions.  The equivalent prototype for this function is:
- *
- * void prvIdleTask( void *pvParameters );
- *
- */
-static portTASK_FUNCTION( prvIdleTask, pvParameters )
-{
-    /* Stop warnings. */
-    ( void ) pvParameters;
+#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+
+/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
+ * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
+ * user to determine the return type.  It gets around the problem of the value
+ * overflowing on 8-bit types without breaking backward compatibility for
+ * applications that expect an 8-bit return type. */
+    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        uint8_t * pucEndOfStack;
+        configSTACK_DEPTH_TYPE uxReturn;
+
+        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
+         * the same except for their return type.  Using configSTACK_DEPTH_TYPE
+         * allows the user to determine the return type.  It gets around the
+         * problem of the value overflowing on 8-bit types without breaking
+         * backward compatibility for applications that expect an 8-bit return
+         * type. */
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        #if portSTACK_GROWTH < 0
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+            }
+        #else
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            }
+        #endif
+
+        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+        return uxReturn;
+    }
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+
+    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        uint8_t * pucEndOfStack;
+        UBaseType_t uxReturn;
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        #if portSTACK_GROWTH < 0
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+            }
+        #else
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            }
+        #endif
+
+        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+        return uxReturn;
+    }
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STACK_REPORT == 1 )
+
+    UBaseType_t uxTaskGetStackUsage( TaskHandle_t xTask,
+                                     UBaseType_t * puxStackDepth )
+    {
+        TCB_t * pxTCB;
+
+        pxTCB = prvGetTCBFromHandle( xTask );
 
-    /** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
-     * SCHEDULER IS STARTED. **/
+        if( puxStackDepth != NULL )
+        {
+            *puxStackDepth = ( UBaseType_t ) pxTCB->uxStackDepth;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-    /* In case a task that has a secure context deletes itself, in which case
-     * the idle task is responsible for deleting the task's secure context, if
-     * any. */
-    portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
+        /* The high water mark is the space that was never written, so the
+         * words lost to aligning the top of the stack count as used. */
+        return ( UBaseType_t ) pxTCB->uxStackDepth - uxTaskGetStackHighWaterMark( pxTCB );
+    }
 
-    for( ; ; )
-    {
-		/************ Update DeadLine of Idle Task ************/
-         pxCurrentTCB -> xStateListItem.xItemValue += (TickType_t)200 ;  /* offset to make it the least priority */ 
+#endif /* configUSE_STACK_REPORT */
+/*-----------------------------------------------------------*/
 
-		 
-        /* See if any tasks have deleted themselves - if so then the idle task
-         * is responsible for freeing the deleted task's TCB and stack. */
-        prvCheckTasksWaitingTermination();
+#if ( INCLUDE_vTaskDelete == 1 )
 
-        #if ( configUSE_PREEMPTION == 0 )
+    static void prvDeleteTCB( TCB_t * pxTCB )
+    {
+        /* This call is required specifically for the TriCore port.  It must be
+         * above the vPortFree() calls.  The call is also used by ports/demos that
+         * want to allocate and clean RAM statically. */
+        portCLEAN_UP_TCB( pxTCB );
+
+        /* Free up the memory allocated by the scheduler for the task.  It is up
+         * to the task to free any memory allocated at the application level.
+         * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+         * for additional information. */
+        #if ( configUSE_NEWLIB_REENTRANT == 1 )
             {
-                /* If we are not using preemption we keep forcing a task switch to
-                 * see if any other task has become available.  If we are using
-                 * preemption we don't need to do this as any task becoming available
-                 * will automatically get the processor anyway. */
-                taskYIELD();
+                _reclaim_reent( &( pxTCB->xNewLib_reent ) );
             }
-        #endif /* configUSE_PREEMPTION */
+        #endif /* configUSE_NEWLIB_REENTRANT */
 
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
             {
-                /* When using preemption tasks of equal priority will be
-                 * timesliced.  If a task that is sharing the idle priority is ready
-                 * to run then the idle task should yield before the end of the
-                 * timeslice.
-                 *
-                 * A critical region is not required here as we are just reading from
-                 * the list, and an occasional incorrect value will not matter.  If
-                 * the ready list at the idle priority contains more than one task
-                 * then a task other than the idle task is ready to execute. */
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+                /* The task can only have been allocated dynamically - free both
+                 * the stack and TCB. */
+                vPortFreeStack( pxTCB->pxStack );
+                vPortFree( pxTCB );
+            }
+        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+            {
+                /* The task could have been allocated statically or dynamically, so
+                 * check what was statically allocated before trying to free the
+                 * memory. */
+                if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
                 {
-                    taskYIELD();
+                    /* Both the stack and TCB were allocated dynamically, so both
+                     * must be freed. */
+                    vPortFreeStack( pxTCB->pxStack );
+                    vPortFree( pxTCB );
+                }
+                else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+                {
+                    /* Only the stack was statically allocated, so the TCB is the
+                     * only memory that must be freed. */
+                    vPortFree( pxTCB );
                 }
                 else
                 {
+                    /* Neither the stack nor the TCB were allocated dynamically, so
+                     * nothing needs to be freed. */
+                    configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+    }
 
-        #if ( configUSE_IDLE_HOOK == 1 )
-            {
-                extern void vApplicationIdleHook( void );
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
 
-                /* Call the user defined function from within the idle task.  This
-                 * allows the application designer to add background functionality
-                 * without the overhead of a separate task.
-                 * NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
-                 * CALL A FUNCTION THAT MIGHT BLOCK. */
-                vApplicationIdleHook();
-            }
-        #endif /* configUSE_IDLE_HOOK */
+static void prvResetNextTaskUnblockTime( void )
+{
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+        {
+            const TickType_t xConstTickCount = xTickCount;
+            const UBaseType_t uxFirstSlot = taskDELAYED_TASK_WHEEL_INDEX( xConstTickCount );
+            UBaseType_t uxOffset, uxSlot, uxStep;
+            uint32_t ulSlotBits;
+            TickType_t xWakeTime;
+            List_t const * pxSlot;
+            ListItem_t const * pxIterator;
+
+            /* Walk the slots forward from the current tick.  The first task
+             * found whose wake time is in the current turn of the wheel is the
+             * next to unblock.  If there is none, every slot has been seen and
+             * the earliest wake time of all is used.  Tasks delayed past an
+             * overflow are left out until the overflow, as they are with the
+             * delayed lists.  Slots whose bit is clear are empty and skipped
+             * without being looked at. */
+            xNextTaskUnblockTime = portMAX_DELAY;
+            uxOffset = ( UBaseType_t ) 0U;
+
+            while( uxOffset < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE )
+            {
+                uxSlot = ( uxFirstSlot + uxOffset ) & ( ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE - ( UBaseType_t ) 1U );
+                ulSlotBits = ulDelayedTaskWheelMap[ uxSlot >> 5 ] >> ( uxSlot & ( UBaseType_t ) 31U );
+
+                if( ulSlotBits == 0U )
+                {
+                    /* No task from here to the end of the word, or to the end
+                     * of the wheel if that comes first. */
+                    uxStep = ( UBaseType_t ) 32U - ( uxSlot & ( UBaseType_t ) 31U );
 
-        /* This conditional compilation should use inequality to 0, not equality
-         * to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
-         * user defined low power mode  implementations require
-         * configUSE_TICKLESS_IDLE to be set to a value other than 1. */
-        #if ( configUSE_TICKLESS_IDLE != 0 )
-            {
-                TickType_t xExpectedIdleTime;
+                    if( uxStep > ( ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE - uxSlot ) )
+                    {
+                        uxStep = ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE - uxSlot;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
 
-                /* It is not desirable to suspend then resume the scheduler on
-                 * each iteration of the idle task.  Therefore, a preliminary
-                 * test of the expected idle time is performed without the
-                 * scheduler suspended.  The result here is not necessarily
-                 * valid. */
-                xExpectedIdleTime = prvGetExpectedIdleTime();
+                    uxOffset += uxStep;
+                    continue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-                if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+                while( ( ulSlotBits & 1U ) == 0U )
                 {
-                    vTaskSuspendAll();
-                    {
-                        /* Now the scheduler is suspended, the expected idle
-                         * time can be sampled again, and this time its value can
-                         * be used. */
-                        configASSERT( xNextTaskUnblockTime >= xTickCount );
-                        xExpectedIdleTime = prvGetExpectedIdleTime();
+                    ulSlotBits >>= 1;
+                    uxOffset++;
+                    uxSlot++;
+                }
 
-                        /* Define the following macro to set xExpectedIdleTime to 0
-                         * if the application does not want
-                         * portSUPPRESS_TICKS_AND_SLEEP() to be called. */
-                        configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
+                if( uxOffset >= ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE )
+                {
+                    /* Back at a slot already seen. */
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-                        if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+                pxSlot = &( xDelayedTaskWheel[ uxSlot ] );
+
+                if( listLIST_IS_EMPTY( pxSlot ) != pdFALSE )
+                {
+                    /* Its tasks have been woken or removed since. */
+                    ulDelayedTaskWheelMap[ uxSlot >> 5 ] &= ~( ( uint32_t ) 1U << ( uxSlot & ( UBaseType_t ) 31U ) );
+                }
+                else
+                {
+                    for( pxIterator = listGET_HEAD_ENTRY( pxSlot ); pxIterator != listGET_END_MARKER( pxSlot ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+                    {
+                        xWakeTime = listGET_LIST_ITEM_VALUE( pxIterator );
+
+                        if( ( xWakeTime >= xConstTickCount ) && ( xWakeTime < xNextTaskUnblockTime ) )
                         {
-                            traceLOW_POWER_IDLE_BEGIN();
-                            portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
-                            traceLOW_POWER_IDLE_END();
+                            xNextTaskUnblockTime = xWakeTime;
                         }
                         else
                         {
                             mtCOVERAGE_TEST_MARKER();
                         }
                     }
-                    ( void ) xTaskResumeAll();
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-        #endif /* configUSE_TICKLESS_IDLE */
-    }
-}
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_TICKLESS_IDLE != 0 )
-
-    eSleepModeStatus eTaskConfirmSleepModeStatus( void )
-    {
-        /* The idle task exists in addition to the application tasks. */
-        const UBaseType_t uxNonApplicationTasks = 1;
-        eSleepModeStatus eReturn = eStandardSleep;
 
-        /* This function must be called from a critical section. */
+                    if( xNextTaskUnblockTime == ( xConstTickCount + ( TickType_t ) uxOffset ) )
+                    {
+                        /* Every slot not yet seen wakes later. */
+                        break;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
 
-        if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
-        {
-            /* A task was made ready while the scheduler was suspended. */
-            eReturn = eAbortSleep;
-        }
-        else if( xYieldPending != pdFALSE )
-        {
-            /* A yield was pended while the scheduler was suspended. */
-            eReturn = eAbortSleep;
-        }
-        else if( xPendedTicks != 0 )
-        {
-            /* A tick interrupt has already occurred but was held pending
-             * because the scheduler is suspended. */
-            eReturn = eAbortSleep;
+                uxOffset++;
+            }
         }
-        else
+    #else /* configUSE_DELAYED_TASK_WHEEL */
         {
-            /* If all the tasks are in the suspended list (which might mean they
-             * have an infinite block time rather than actually being suspended)
-             * then it is safe to turn all clocks off and just wait for external
-             * interrupts. */
-            if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+            if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
             {
-                eReturn = eNoTasksWaitingTimeout;
+                /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+                 * the maximum possible value so it is  extremely unlikely that the
+                 * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+                 * there is an item in the delayed list. */
+                xNextTaskUnblockTime = portMAX_DELAY;
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                /* The new current delayed list is not empty, get the value of
+                 * the item at the head of the delayed list.  This is the time at
+                 * which the task at the head of the delayed list should be removed
+                 * from the Blocked state. */
+                xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
             }
         }
-
-        return eReturn;
-    }
-
-#endif /* configUSE_TICKLESS_IDLE */
+    #endif /* configUSE_DELAYED_TASK_WHEEL */
+}
 /*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
 
-    void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
-                                            BaseType_t xIndex,
-                                            void * pvValue )
+    static void prvAddCurrentTaskToDelayedTaskWheel( TickType_t xTimeToWake,
+                                                     const TickType_t xConstTickCount )
     {
-        TCB_t * pxTCB;
-
-        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        /* A task is woken at the earliest by the next tick, which only looks
+         * at its own slot. */
+        if( xTimeToWake == xConstTickCount )
         {
-            pxTCB = prvGetTCBFromHandle( xTaskToSet );
-            configASSERT( pxTCB != NULL );
-            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+            xTimeToWake++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-    }
-
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
-/*-----------------------------------------------------------*/
-
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
-    void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
-                                               BaseType_t xIndex )
-    {
-        void * pvReturn = NULL;
-        TCB_t * pxTCB;
+        listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+        listINSERT_END( taskDELAYED_TASK_WHEEL_SLOT( xTimeToWake ), &( pxCurrentTCB->xStateListItem ) );
+        ulDelayedTaskWheelMap[ taskDELAYED_TASK_WHEEL_INDEX( xTimeToWake ) >> 5 ] |= ( uint32_t ) 1U << ( taskDELAYED_TASK_WHEEL_INDEX( xTimeToWake ) & ( UBaseType_t ) 31U );
 
-        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        /* A wake time that has overflowed is only taken into account once the
+         * tick count overflows too. */
+        if( ( xTimeToWake > xConstTickCount ) && ( xTimeToWake < xNextTaskUnblockTime ) )
         {
-            pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+            xNextTaskUnblockTime = xTimeToWake;
         }
         else
         {
-            pvReturn = NULL;
+            mtCOVERAGE_TEST_MARKER();
         }
-
-        return pvReturn;
     }
-
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 /*-----------------------------------------------------------*/
 
-#if ( portUSING_MPU_WRAPPERS == 1 )
-
-    void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
-                                  const MemoryRegion_t * const xRegions )
-    {
-        TCB_t * pxTCB;
-
-        /* If null is passed in here then we are modifying the MPU settings of
-         * the calling task. */
-        pxTCB = prvGetTCBFromHandle( xTaskToModify );
+    static TCB_t * prvGetExpiredDelayedTask( const TickType_t xConstTickCount )
+    {
+        List_t const * const pxSlot = taskDELAYED_TASK_WHEEL_SLOT( xConstTickCount );
+        ListItem_t const * pxIterator;
+        TCB_t * pxTCB = NULL;
 
-        vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
+        /* The slot also holds tasks that wake on a later turn of the wheel. */
+        for( pxIterator = listGET_HEAD_ENTRY( pxSlot ); pxIterator != listGET_END_MARKER( pxSlot ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+        {
+            if( listGET_LIST_ITEM_VALUE( pxIterator ) == xConstTickCount )
+            {
+                pxTCB = listGET_LIST_ITEM_OWNER( pxIterator ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                break;
+            }
+        }
+
+        return pxTCB;
     }
 
-#endif /* portUSING_MPU_WRAPPERS */
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseTaskLists( void )
-{
-    UBaseType_t uxPriority;
+#if ( configUSE_EDF_SCHEDULER == 1 )
 
-    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+    static void prvInsertEDFReady( TCB_t * pxTCB )
     {
-        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+        /* vListInsert() is not used even for FIFO ties, as its comparison does
+         * not survive deadlines that wrap. */
+        ( void ) prvInsertEDFReadyFrom( pxTCB, listGET_HEAD_ENTRY( &xReadyTasksListEDF ) );
     }
+/*-----------------------------------------------------------*/
 
-    vListInitialise( &xDelayedTaskList1 );
-    vListInitialise( &xDelayedTaskList2 );
-    vListInitialise( &xPendingReadyList );
+    static ListItem_t * prvInsertEDFReadyFrom( TCB_t * pxTCB,
+                                               ListItem_t * pxFrom )
+    {
+        List_t * const pxList = &xReadyTasksListEDF;
+        ListItem_t * pxIterator;
 
-    #if ( INCLUDE_vTaskDelete == 1 )
+        /* Find the first task that pxTCB goes ahead of.  The walk stops at
+         * the list end marker if there is none.  With FIFO ties this is the
+         * first task with a later deadline, as for vListInsert(). */
+        for( pxIterator = pxFrom; pxIterator != listGET_END_MARKER( pxList ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
         {
-            vListInitialise( &xTasksWaitingTermination );
+            if( taskEDF_RUNS_BEFORE( pxTCB, ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) ) )
+            {
+                break;
+            }
         }
-    #endif /* INCLUDE_vTaskDelete */
 
-    #if ( INCLUDE_vTaskSuspend == 1 )
-        {
-            vListInitialise( &xSuspendedTaskList );
-        }
-    #endif /* INCLUDE_vTaskSuspend */
-	
-	/*************************************************/
-	/* start for our EDF */
-			/* E.C. */
-#if ( configUSE_EDF_SCHEDULER == 1 )
-			{
-				vListInitialise( &xReadyTasksListEDF );
-			}
-#endif
-			/* end of special for EDF */
-/*************************************************/
-    /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-     * using list2. */
-    pxDelayedTaskList = &xDelayedTaskList1;
-    pxOverflowDelayedTaskList = &xDelayedTaskList2;
-}
+        prvInsertListItemBefore( pxList, &( pxTCB->xStateListItem ), pxIterator );
+
+        return pxIterator;
+    }
 /*-----------------------------------------------------------*/
 
-static void prvCheckTasksWaitingTermination( void )
-{
-    /** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
+    static void prvInsertListItemBefore( List_t * const pxList,
+                                         ListItem_t * const pxNewListItem,
+                                         ListItem_t * const pxPosition )
+    {
+        pxNewListItem->pxNext = pxPosition;
+        pxNewListItem->pxPrevious = pxPosition->pxPrevious;
+        pxPosition->pxPrevious->pxNext = pxNewListItem;
+        pxPosition->pxPrevious = pxNewListItem;
+        pxNewListItem->pxContainer = pxList;
 
-    #if ( INCLUDE_vTaskDelete == 1 )
+        ( pxList->uxNumberOfItems )++;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_FINE_DEADLINES == 1 )
+
+        static uint32_t prvEDFTickToTime( TickType_t xTick )
         {
-            TCB_t * pxTCB;
+            uint32_t ulReturn;
 
-            /* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
-             * being called too often in the idle task. */
-            while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+            /* Releases are almost always at the tick being processed, which
+             * needs no conversion. */
+            if( xTick == xTickTimeTick )
             {
-                taskENTER_CRITICAL();
-                {
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    --uxCurrentNumberOfTasks;
-                    --uxDeletedTasksWaitingCleanUp;
-                }
-                taskEXIT_CRITICAL();
-
-                prvDeleteTCB( pxTCB );
+                ulReturn = ulTickTime;
+            }
+            else if( taskEDF_TICK_BEFORE( xTick, xTickTimeTick ) )
+            {
+                ulReturn = ulTickTime - taskEDF_TICKS_TO_COUNTS( xTickTimeTick - xTick );
+            }
+            else
+            {
+                ulReturn = ulTickTime + taskEDF_TICKS_TO_COUNTS( xTick - xTickTimeTick );
             }
+
+            return ulReturn;
         }
-    #endif /* INCLUDE_vTaskDelete */
-}
+
+    #endif /* configUSE_EDF_FINE_DEADLINES */
+
+#endif /* configUSE_EDF_SCHEDULER */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
 
-    void vTaskGetInfo( TaskHandle_t xTask,
-                       TaskStatus_t * pxTaskStatus,
-                       BaseType_t xGetFreeStackSpace,
-                       eTaskState eState )
+    TaskHandle_t xTaskGetCurrentTaskHandle( void )
     {
-        TCB_t * pxTCB;
+        TaskHandle_t xReturn;
 
-        /* xTask is NULL then get the state of the calling task. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+        /* A critical section is not required as this is not called from
+         * an interrupt and the current TCB will always be the same for any
+         * individual execution thread. */
+        xReturn = pxCurrentTCB;
 
-        pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
-        pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
-        pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
-        pxTaskStatus->pxStackBase = pxTCB->pxStack;
-        pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+        return xReturn;
+    }
 
-        #if ( configUSE_MUTEXES == 1 )
-            {
-                pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
-            }
-        #else
-            {
-                pxTaskStatus->uxBasePriority = 0;
-            }
-        #endif
+#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+/*-----------------------------------------------------------*/
 
-        #if ( configGENERATE_RUN_TIME_STATS == 1 )
-            {
-                pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
-            }
-        #else
-            {
-                pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
-            }
-        #endif
+#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 
-        /* Obtaining the task state is a little fiddly, so is only done if the
-         * value of eState passed into this function is eInvalid - otherwise the
-         * state is just set to whatever is passed in. */
-        if( eState != eInvalid )
+    BaseType_t xTaskGetSchedulerState( void )
+    {
+        BaseType_t xReturn;
+
+        if( xSchedulerRunning == pdFALSE )
         {
-            if( pxTCB == pxCurrentTCB )
+            xReturn = taskSCHEDULER_NOT_STARTED;
+        }
+        else
+        {
+            if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
             {
-                pxTaskStatus->eCurrentState = eRunning;
+                xReturn = taskSCHEDULER_RUNNING;
             }
             else
             {
-                pxTaskStatus->eCurrentState = eState;
-
-                #if ( INCLUDE_vTaskSuspend == 1 )
-                    {
-                        /* If the task is in the suspended list then there is a
-                         *  chance it is actually just blocked indefinitely - so really
-                         *  it should be reported as being in the Blocked state. */
-                        if( eState == eSuspended )
-                        {
-                            vTaskSuspendAll();
-                            {
-                                if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-                                {
-                                    pxTaskStatus->eCurrentState = eBlocked;
-                                }
-                            }
-                            ( void ) xTaskResumeAll();
-                        }
-                    }
-                #endif /* INCLUDE_vTaskSuspend */
+                xReturn = taskSCHEDULER_SUSPENDED;
             }
         }
-        else
-        {
-            pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
-        }
 
-        /* Obtaining the stack space takes some time, so the xGetFreeStackSpace
-         * parameter is provided to allow it to be skipped. */
-        if( xGetFreeStackSpace != pdFALSE )
-        {
-            #if ( portSTACK_GROWTH > 0 )
-                {
-                    pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
-                }
-            #else
-                {
-                    pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
-                }
-            #endif
-        }
-        else
-        {
-            pxTaskStatus->usStackHighWaterMark = 0;
-        }
+        return xReturn;
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_MUTEXES == 1 )
 
-    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
-                                                     List_t * pxList,
-                                                     eTaskState eState )
+    BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
     {
-        configLIST_VOLATILE TCB_t * pxNextTCB, * pxFirstTCB;
-        UBaseType_t uxTask = 0;
+        TCB_t * const pxMutexHolderTCB = pxMutexHolder;
+        BaseType_t xReturn = pdFALSE;
 
-        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        /* If the mutex was given back by an interrupt while the queue was
+         * locked then the mutex holder might now be NULL.  _RB_ Is this still
+         * needed as interrupts can no longer use mutexes? */
+        if( pxMutexHolder != NULL )
         {
-            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            /* If the holder of the mutex has a priority below the priority of
+             * the task attempting to obtain the mutex then it will temporarily
+             * inherit the priority of the task attempting to obtain the mutex. */
+            if( pxMutexHolderTCB->uxPriority < pxCurrentTCB->uxPriority )
+            {
+                /* Adjust the mutex holder state to account for its new
+                 * priority.  Only reset the event list item value if the value is
+                 * not being used for anything else. */
+                if( ( listGET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+                {
+                    listSET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-            /* Populate an TaskStatus_t structure within the
-             * pxTaskStatusArray array for each task that is referenced from
-             * pxList.  See the definition of TaskStatus_t in task.h for the
-             * meaning of each TaskStatus_t structure member. */
-            do
+                /* If the task being modified is in the ready state it will need
+                 * to be moved into a new list. */
+                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                    {
+                        /* It is known that the task is in its ready list so
+                         * there is no need to check again and the port level
+                         * reset macro can be called directly. */
+                        portRESET_READY_PRIORITY( pxMutexHolderTCB->uxPriority, uxTopReadyPriority );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Inherit the priority before being moved into the new list. */
+                    pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
+                    prvAddTaskToReadyList( pxMutexHolderTCB );
+                }
+                else
+                {
+                    /* Just inherit the priority. */
+                    pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
+                }
+
+                traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+
+                /* Inheritance occurred. */
+                xReturn = pdTRUE;
+            }
+            else
             {
-                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
-                uxTask++;
-            } while( pxNextTCB != pxFirstTCB );
+                if( pxMutexHolderTCB->uxBasePriority < pxCurrentTCB->uxPriority )
+                {
+                    /* The base priority of the mutex holder is lower than the
+                     * priority of the task attempting to take the mutex, but the
+                     * current priority of the mutex holder is not lower than the
+                     * priority of the task attempting to take the mutex.
+                     * Therefore the mutex holder must have already inherited a
+                     * priority, but inheritance would have occurred if that had
+                     * not been the case. */
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        return uxTask;
+        return xReturn;
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( configUSE_MUTEXES == 1 )
 
-    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+    BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
     {
-        uint32_t ulCount = 0U;
+        TCB_t * const pxTCB = pxMutexHolder;
+        BaseType_t xReturn = pdFALSE;
 
-        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        if( pxMutexHolder != NULL )
         {
-            pucStackByte -= portSTACK_GROWTH;
-            ulCount++;
-        }
-
-        ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
-
-        return ( configSTACK_DEPTH_TYPE ) ulCount;
-    }
-
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+            /* A task can only have an inherited priority if it holds the mutex.
+             * If the mutex is held by a task then it cannot be given from an
+             * interrupt, and if a mutex is given by the holding task then it must
+             * be the running state task. */
+            configASSERT( pxTCB == pxCurrentTCB );
+            configASSERT( pxTCB->uxMutexesHeld );
+            ( pxTCB->uxMutexesHeld )--;
 
-/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
- * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
- * user to determine the return type.  It gets around the problem of the value
- * overflowing on 8-bit types without breaking backward compatibility for
- * applications that expect an 8-bit return type. */
-    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
-    {
-        TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        configSTACK_DEPTH_TYPE uxReturn;
+            /* Has the holder of the mutex inherited the priority of another
+             * task? */
+            if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+            {
+                /* Only disinherit if no other mutexes are held. */
+                if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
+                {
+                    /* A task can only have an inherited priority if it holds
+                     * the mutex.  If the mutex is held by a task then it cannot be
+                     * given from an interrupt, and if a mutex is given by the
+                     * holding task then it must be the running state task.  Remove
+                     * the holding task from the ready list. */
+                    if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                    {
+                        portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
 
-        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
-         * the same except for their return type.  Using configSTACK_DEPTH_TYPE
-         * allows the user to determine the return type.  It gets around the
-         * problem of the value overflowing on 8-bit types without breaking
-         * backward compatibility for applications that expect an 8-bit return
-         * type. */
+                    /* Disinherit the priority before adding the task into the
+                     * new  ready list. */
+                    traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+                    pxTCB->uxPriority = pxTCB->uxBasePriority;
 
-        pxTCB = prvGetTCBFromHandle( xTask );
+                    /* Reset the event list item value.  It cannot be in use for
+                     * any other purpose if this task is running, and it must be
+                     * running to give back the mutex. */
+                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                    prvAddTaskToReadyList( pxTCB );
 
-        #if portSTACK_GROWTH < 0
-            {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+                    /* Return true to indicate that a context switch is required.
+                     * This is only actually required in the corner case whereby
+                     * multiple mutexes were held and the mutexes were given back
+                     * in an order different to that in which they were taken.
+                     * If a context switch did not occur when the first mutex was
+                     * returned, even if a task was waiting on it, then a context
+                     * switch should occur when the last mutex is returned whether
+                     * a task is waiting on it or not. */
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
-        #else
+            else
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+                mtCOVERAGE_TEST_MARKER();
             }
-        #endif
-
-        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        return uxReturn;
+        return xReturn;
     }
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+#if ( configUSE_MUTEXES == 1 )
 
-    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
+                                              UBaseType_t uxHighestPriorityWaitingTask )
     {
-        TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        UBaseType_t uxReturn;
+        TCB_t * const pxTCB = pxMutexHolder;
+        UBaseType_t uxPriorityUsedOnEntry, uxPriorityToUse;
+        const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
 
-        pxTCB = prvGetTCBFromHandle( xTask );
+        if( pxMutexHolder != NULL )
+        {
+            /* If pxMutexHolder is not NULL then the holder must hold at least
+             * one mutex. */
+            configASSERT( pxTCB->uxMutexesHeld );
 
-        #if portSTACK_GROWTH < 0
+            /* Determine the priority to which the priority of the task that
+             * holds the mutex should be set.  This will be the greater of the
+             * holding task's base priority and the priority of the highest
+             * priority task that is waiting to obtain the mutex. */
+            if( pxTCB->uxBasePriority < uxHighestPriorityWaitingTask )
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+                uxPriorityToUse = uxHighestPriorityWaitingTask;
             }
-        #else
+            else
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+                uxPriorityToUse = pxTCB->uxBasePriority;
             }
-        #endif
 
-        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
-
-        return uxReturn;
-    }
-
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
-/*-----------------------------------------------------------*/
+            /* Does the priority need to change? */
+            if( pxTCB->uxPriority != uxPriorityToUse )
+            {
+                /* Only disinherit if no other mutexes are held.  This is a
+                 * simplification in the priority inheritance implementation.  If
+                 * the task that holds the mutex is also holding other mutexes then
+                 * the other mutexes may have caused the priority inheritance. */
+                if( pxTCB->uxMutexesHeld == uxOnlyOneMutexHeld )
+                {
+                    /* If a task has timed out because it already holds the
+                     * mutex it was trying to obtain then it cannot of inherited
+                     * its own priority. */
+                    configASSERT( pxTCB != pxCurrentTCB );
 
-#if ( INCLUDE_vTaskDelete == 1 )
+                    /* Disinherit the priority, remembering the previous
+                     * priority to facilitate determining the subject task's
+                     * state. */
+                    traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+                    uxPriorityUsedOnEntry = pxTCB->uxPriority;
+                    pxTCB->uxPriority = uxPriorityToUse;
 
-    static void prvDeleteTCB( TCB_t * pxTCB )
-    {
-        /* This call is required specifically for the TriCore port.  It must be
-         * above the vPortFree() calls.  The call is also used by ports/demos that
-         * want to allocate and clean RAM statically. */
-        portCLEAN_UP_TCB( pxTCB );
+                    /* Only reset the event list item value if the value is not
+                     * being used for anything else. */
+                    if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+                    {
+                        listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriorityToUse ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
 
-        /* Free up the memory allocated by the scheduler for the task.  It is up
-         * to the task to free any memory allocated at the application level.
-         * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-         * for additional information. */
-        #if ( configUSE_NEWLIB_REENTRANT == 1 )
-            {
-                _reclaim_reent( &( pxTCB->xNewLib_reent ) );
-            }
-        #endif /* configUSE_NEWLIB_REENTRANT */
+                    /* If the running task is not the task that holds the mutex
+                     * then the task that holds the mutex could be in either the
+                     * Ready, Blocked or Suspended states.  Only remove the task
+                     * from its current state list if it is in the Ready state as
+                     * the task's priority is going to change and there is one
+                     * Ready list per priority. */
+                    if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                    {
+                        if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                        {
+                            /* It is known that the task is in its ready list so
+                             * there is no need to check again and the port level
+                             * reset macro can be called directly. */
+                            portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
 
-        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
-            {
-                /* The task can only have been allocated dynamically - free both
-                 * the stack and TCB. */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
-            }
-        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
-            {
-                /* The task could have been allocated statically or dynamically, so
-                 * check what was statically allocated before trying to free the
-                 * memory. */
-                if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
-                {
-                    /* Both the stack and TCB were allocated dynamically, so both
-                     * must be freed. */
-                    vPortFreeStack( pxTCB->pxStack );
-                    vPortFree( pxTCB );
-                }
-                else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
-                {
-                    /* Only the stack was statically allocated, so the TCB is the
-                     * only memory that must be freed. */
-                    vPortFree( pxTCB );
+                        prvAddTaskToReadyList( pxTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
                 else
                 {
-                    /* Neither the stack nor the TCB were allocated dynamically, so
-                     * nothing needs to be freed. */
-                    configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
 
-#endif /* INCLUDE_vTaskDelete */
-/*-----------------------------------------------------------*/
-
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-    {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
-    }
-    else
-    {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
-    }
-}
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
 
-    TaskHandle_t xTaskGetCurrentTaskHandle( void )
+    void vTaskEnterCritical( void )
     {
-        TaskHandle_t xReturn;
+        portDISABLE_INTERRUPTS();
 
-        /* A critical section is not required as this is not called from
-         * an interrupt and the current TCB will always be the same for any
-         * individual execution thread. */
-        xReturn = pxCurrentTCB;
+        if( xSchedulerRunning != pdFALSE )
+        {
+            ( pxCurrentTCB->uxCriticalNesting )++;
 
-        return xReturn;
+            /* This is not the interrupt safe version of the enter critical
+             * function so  assert() if it is being called from an interrupt
+             * context.  Only API functions that end in "FromISR" can be used in an
+             * interrupt.  Only assert if the critical nesting count is 1 to
+             * protect against recursive calls if the assert function also uses a
+             * critical section. */
+            if( pxCurrentTCB->uxCriticalNesting == 1 )
+            {
+                portASSERT_IF_IN_ISR();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
 
-#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+#endif /* portCRITICAL_NESTING_IN_TCB */
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
 
-    BaseType_t xTaskGetSchedulerState( void )
+    void vTaskExitCritical( void )
     {
-        BaseType_t xReturn;
-
-        if( xSchedulerRunning == pdFALSE )
-        {
-            xReturn = taskSCHEDULER_NOT_STARTED;
-        }
-        else
+        if( xSchedulerRunning != pdFALSE )
         {
-            if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+            if( pxCurrentTCB->uxCriticalNesting > 0U )
             {
-                xReturn = taskSCHEDULER_RUNNING;
+                ( pxCurrentTCB->uxCriticalNesting )--;
+
+                if( pxCurrentTCB->uxCriticalNesting == 0U )
+                {
+                    portENABLE_INTERRUPTS();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
             else
             {
-                xReturn = taskSCHEDULER_SUSPENDED;
+                mtCOVERAGE_TEST_MARKER();
             }
         }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
 
-        return xReturn;
+#endif /* portCRITICAL_NESTING_IN_TCB */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+    static char * prvWriteNameToBuffer( char * pcBuffer,
+                                        const char * pcTaskName )
+    {
+        size_t x;
+
+        /* Start by copying the entire string. */
+        strcpy( pcBuffer, pcTaskName );
+
+        /* Pad the end of the string with spaces to ensure columns line up when
+         * printed out. */
+        for( x = strlen( pcBuffer ); x < ( size_t ) ( configMAX_TASK_NAME_LEN - 1 ); x++ )
+        {
+            pcBuffer[ x ] = ' ';
+        }
+
+        /* Terminate. */
+        pcBuffer[ x ] = ( char ) 0x00;
+
+        /* Return the new end of string. */
+        return &( pcBuffer[ x ] );
     }
 
-#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
+#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-    BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
+    void vTaskList( char * pcWriteBuffer )
     {
-        TCB_t * const pxMutexHolderTCB = pxMutexHolder;
-        BaseType_t xReturn = pdFALSE;
+        TaskStatus_t * pxTaskStatusArray;
+        UBaseType_t uxArraySize, x;
+        char cStatus;
 
-        /* If the mutex was given back by an interrupt while the queue was
-         * locked then the mutex holder might now be NULL.  _RB_ Is this still
-         * needed as interrupts can no longer use mutexes? */
-        if( pxMutexHolder != NULL )
+        /*
+         * PLEASE NOTE:
+         *
+         * This function is provided for convenience only, and is used by many
+         * of the demo applications.  Do not consider it to be part of the
+         * scheduler.
+         *
+         * vTaskList() calls uxTaskGetSystemState(), then formats part of the
+         * uxTaskGetSystemState() output into a human readable table that
+         * displays task: names, states, priority, stack usage and task number.
+         * Stack usage specified as the number of unused StackType_t words stack can hold
+         * on top of stack - not the number of bytes.
+         *
+         * vTaskList() has a dependency on the sprintf() C library function that
+         * might bloat the code size, use a lot of stack, and provide different
+         * results on different platforms.  An alternative, tiny, third party,
+         * and limited functionality implementation of sprintf() is provided in
+         * many of the FreeRTOS/Demo sub-directories in a file called
+         * printf-stdarg.c (note printf-stdarg.c does not provide a full
+         * snprintf() implementation!).
+         *
+         * It is recommended that production systems call uxTaskGetSystemState()
+         * directly to get access to raw stats data, rather than indirectly
+         * through a call to vTaskList().
+         */
+
+
+        /* Make sure the write buffer does not contain a string. */
+        *pcWriteBuffer = ( char ) 0x00;
+
+        /* Take a snapshot of the number of tasks in case it changes while this
+         * function is executing. */
+        uxArraySize = uxCurrentNumberOfTasks;
+
+        /* Allocate an array index for each task.  NOTE!  if
+         * configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
+         * equate to NULL. */
+        pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+
+        if( pxTaskStatusArray != NULL )
         {
-            /* If the holder of the mutex has a priority below the priority of
-             * the task attempting to obtain the mutex then it will temporarily
-             * inherit the priority of the task attempting to obtain the mutex. */
-            if( pxMutexHolderTCB->uxPriority < pxCurrentTCB->uxPriority )
+            /* Generate the (binary) data. */
+            uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+
+            /* Create a human readable table from the binary data. */
+            for( x = 0; x < uxArraySize; x++ )
             {
-                /* Adjust the mutex holder state to account for its new
-                 * priority.  Only reset the event list item value if the value is
-                 * not being used for anything else. */
-                if( ( listGET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-                {
-                    listSET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                }
-                else
+                switch( pxTaskStatusArray[ x ].eCurrentState )
                 {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                    case eRunning:
+                        cStatus = tskRUNNING_CHAR;
+                        break;
 
-                /* If the task being modified is in the ready state it will need
-                 * to be moved into a new list. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
-                {
-                    if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-                    {
-                        /* It is known that the task is in its ready list so
-                         * there is no need to check again and the port level
-                         * reset macro can be called directly. */
-                        portRESET_READY_PRIORITY( pxMutexHolderTCB->uxPriority, uxTopReadyPriority );
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                    case eReady:
+                        cStatus = tskREADY_CHAR;
+                        break;
 
-                    /* Inherit the priority before being moved into the new list. */
-                    pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
-                    prvAddTaskToReadyList( pxMutexHolderTCB );
-                }
-                else
-                {
-                    /* Just inherit the priority. */
-                    pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
-                }
+                    case eBlocked:
+                        cStatus = tskBLOCKED_CHAR;
+                        break;
 
-                traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+                    case eSuspended:
+                        cStatus = tskSUSPENDED_CHAR;
+                        break;
 
-                /* Inheritance occurred. */
-                xReturn = pdTRUE;
-            }
-            else
-            {
-                if( pxMutexHolderTCB->uxBasePriority < pxCurrentTCB->uxPriority )
-                {
-                    /* The base priority of the mutex holder is lower than the
-                     * priority of the task attempting to take the mutex, but the
-                     * current priority of the mutex holder is not lower than the
-                     * priority of the task attempting to take the mutex.
-                     * Therefore the mutex holder must have already inherited a
-                     * priority, but inheritance would have occurred if that had
-                     * not been the case. */
-                    xReturn = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
+                    case eDeleted:
+                        cStatus = tskDELETED_CHAR;
+                        break;
+
+                    case eInvalid: /* Fall through. */
+                    default:       /* Should not get here, but it is included
+                                    * to prevent static checking errors. */
+                        cStatus = ( char ) 0x00;
+                        break;
                 }
+
+                /* Write the task name to the string, padding with spaces so it
+                 * can be printed in tabular form more easily. */
+                pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+
+                /* Write the rest of the string. */
+                sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                pcWriteBuffer += strlen( pcWriteBuffer );                                                                                                                                                                                                /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
             }
+
+            /* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
+             * is 0 then vPortFree() will be #defined to nothing. */
+            vPortFree( pxTaskStatusArray );
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
-
-        return xReturn;
     }
 
-#endif /* configUSE_MUTEXES */
-/*-----------------------------------------------------------*/
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-    BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
+    void vTaskGetRunTimeStats( char * pcWriteBuffer )
     {
-        TCB_t * const pxTCB = pxMutexHolder;
-        BaseType_t xReturn = pdFALSE;
+        TaskStatus_t * pxTaskStatusArray;
+        UBaseType_t uxArraySize, x;
+        configRUN_TIME_COUNTER_TYPE ulTotalTime, ulStatsAsPercentage;
 
-        if( pxMutexHolder != NULL )
+        #if ( configUSE_TRACE_FACILITY != 1 )
+            {
+                #error configUSE_TRACE_FACILITY must also be set to 1 in FreeRTOSConfig.h to use vTaskGetRunTimeStats().
+            }
+        #endif
+
+        /*
+         * PLEASE NOTE:
+         *
+         * This function is provided for convenience only, and is used by many
+         * of the demo applications.  Do not consider it to be part of the
+         * scheduler.
+         *
+         * vTaskGetRunTimeStats() calls uxTaskGetSystemState(), then formats part
+         * of the uxTaskGetSystemState() output into a human readable table that
+         * displays the amount of time each task has spent in the Running state
+         * in both absolute and percentage terms.
+         *
+         * vTaskGetRunTimeStats() has a dependency on the sprintf() C library
+         * function that might bloat the code size, use a lot of stack, and
+         * provide different results on different platforms.  An alternative,
+         * tiny, third party, and limited functionality implementation of
+         * sprintf() is provided in many of the FreeRTOS/Demo sub-directories in
+         * a file called printf-stdarg.c (note printf-stdarg.c does not provide
+         * a full snprintf() implementation!).
+         *
+         * It is recommended that production systems call uxTaskGetSystemState()
+         * directly to get access to raw stats data, rather than indirectly
+         * through a call to vTaskGetRunTimeStats().
+         */
+
+        /* Make sure the write buffer does not contain a string. */
+        *pcWriteBuffer = ( char ) 0x00;
+
+        /* Take a snapshot of the number of tasks in case it changes while this
+         * function is executing. */
+        uxArraySize = uxCurrentNumberOfTasks;
+
+        /* Allocate an array index for each task.  NOTE!  If
+         * configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
+         * equate to NULL. */
+        pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+
+        if( pxTaskStatusArray != NULL )
         {
-            /* A task can only have an inherited priority if it holds the mutex.
-             * If the mutex is held by a task then it cannot be given from an
-             * interrupt, and if a mutex is given by the holding task then it must
-             * be the running state task. */
-            configASSERT( pxTCB == pxCurrentTCB );
-            configASSERT( pxTCB->uxMutexesHeld );
-            ( pxTCB->uxMutexesHeld )--;
+            /* Generate the (binary) data. */
+            uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
 
-            /* Has the holder of the mutex inherited the priority of another
-             * task? */
-            if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+            /* For percentage calculations. */
+            ulTotalTime /= 100UL;
+
+            /* Avoid divide by zero errors. */
+            if( ulTotalTime > 0UL )
             {
-                /* Only disinherit if no other mutexes are held. */
-                if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
+                /* Create a human readable table from the binary data. */
+                for( x = 0; x < uxArraySize; x++ )
                 {
-                    /* A task can only have an inherited priority if it holds
-                     * the mutex.  If the mutex is held by a task then it cannot be
-                     * given from an interrupt, and if a mutex is given by the
-                     * holding task then it must be the running state task.  Remove
-                     * the holding task from the ready list. */
-                    if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                    /* What percentage of the total run time has the task used?
+                     * This will always be rounded down to the nearest integer.
+                     * ulTotalRunTime has already been divided by 100. */
+                    ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
+
+                    /* Write the task name to the string, padding with
+                     * spaces so it can be printed in tabular form more
+                     * easily. */
+                    pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+
+                    if( ulStatsAsPercentage > 0UL )
                     {
-                        portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+                        #ifdef portLU_PRINTF_SPECIFIER_REQUIRED
+                            {
+                                sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
+                            }
+                        #else
+                            {
+                                /* sizeof( int ) == sizeof( long ) so a smaller
+                                 * printf() library can be used. */
+                                sprintf( pcWriteBuffer, "\t%u\t\t%u%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                            }
+                        #endif
                     }
                     else
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        /* If the percentage is zero here then the task has
+                         * consumed less than 1% of the total run time. */
+                        #ifdef portLU_PRINTF_SPECIFIER_REQUIRED
+                            {
+                                sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
+                            }
+                        #else
+                            {
+                                /* sizeof( int ) == sizeof( long ) so a smaller
+                                 * printf() library can be used. */
+                                sprintf( pcWriteBuffer, "\t%u\t\t<1%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                            }
+                        #endif
                     }
 
-                    /* Disinherit the priority before adding the task into the
-                     * new  ready list. */
-                    traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
-                    pxTCB->uxPriority = pxTCB->uxBasePriority;
-
-                    /* Reset the event list item value.  It cannot be in use for
-                     * any other purpose if this task is running, and it must be
-                     * running to give back the mutex. */
-                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                    prvAddTaskToReadyList( pxTCB );
-
-                    /* Return true to indicate that a context switch is required.
-                     * This is only actually required in the corner case whereby
-                     * multiple mutexes were held and the mutexes were given back
-                     * in an order different to that in which they were taken.
-                     * If a context switch did not occur when the first mutex was
-                     * returned, even if a task was waiting on it, then a context
-                     * switch should occur when the last mutex is returned whether
-                     * a task is waiting on it or not. */
-                    xReturn = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
+                    pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
                 }
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
+
+            /* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
+             * is 0 then vPortFree() will be #defined to nothing. */
+            vPortFree( pxTaskStatusArray );
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
-
-        return xReturn;
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
-    void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
-                                              UBaseType_t uxHighestPriorityWaitingTask )
+    void vTaskPeriodicPartitionList( char * pcWriteBuffer )
     {
-        TCB_t * const pxTCB = pxMutexHolder;
-        UBaseType_t uxPriorityUsedOnEntry, uxPriorityToUse;
-        const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
+        TCB_t * pxTCB;
+        UBaseType_t uxIndex, uxCore;
+        uint32_t ulUtilisation[ configEDF_NUMBER_OF_CORES ];
 
-        if( pxMutexHolder != NULL )
-        {
-            /* If pxMutexHolder is not NULL then the holder must hold at least
-             * one mutex. */
-            configASSERT( pxTCB->uxMutexesHeld );
+        /*
+         * PLEASE NOTE:
+         *
+         * This function is provided for convenience only, like vTaskList(),
+         * and has the same dependency on sprintf().  It writes one line per
+         * periodic task giving its name, its core (or '-' if it was left
+         * out for want of an execution time), the core that runs the second
+         * piece of a split task (or '-') and the execution time of the first
+         * piece.  Then one line per core giving the utilisation C/T
+         * achieved on it and the density sum used to admit tasks, both in
+         * units of 1/10000 of the core.
+         */
 
-            /* Determine the priority to which the priority of the task that
-             * holds the mutex should be set.  This will be the greater of the
-             * holding task's base priority and the priority of the highest
-             * priority task that is waiting to obtain the mutex. */
-            if( pxTCB->uxBasePriority < uxHighestPriorityWaitingTask )
-            {
-                uxPriorityToUse = uxHighestPriorityWaitingTask;
-            }
-            else
-            {
-                uxPriorityToUse = pxTCB->uxBasePriority;
-            }
+        /* Make sure the write buffer does not contain a string. */
+        *pcWriteBuffer = ( char ) 0x00;
 
-            /* Does the priority need to change? */
-            if( pxTCB->uxPriority != uxPriorityToUse )
-            {
-                /* Only disinherit if no other mutexes are held.  This is a
-                 * simplification in the priority inheritance implementation.  If
-                 * the task that holds the mutex is also holding other mutexes then
-                 * the other mutexes may have caused the priority inheritance. */
-                if( pxTCB->uxMutexesHeld == uxOnlyOneMutexHeld )
-                {
-                    /* If a task has timed out because it already holds the
-                     * mutex it was trying to obtain then it cannot of inherited
-                     * its own priority. */
-                    configASSERT( pxTCB != pxCurrentTCB );
+        for( uxCore = ( UBaseType_t ) 0U; uxCore < ( UBaseType_t ) configEDF_NUMBER_OF_CORES; uxCore++ )
+        {
+            ulUtilisation[ uxCore ] = ( uint32_t ) 0UL;
+        }
 
-                    /* Disinherit the priority, remembering the previous
-                     * priority to facilitate determining the subject task's
-                     * state. */
-                    traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
-                    uxPriorityUsedOnEntry = pxTCB->uxPriority;
-                    pxTCB->uxPriority = uxPriorityToUse;
+        vTaskSuspendAll();
+        {
+            for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
+            {
+                pxTCB = pxPeriodicTasks[ uxIndex ];
 
-                    /* Only reset the event list item value if the value is not
-                     * being used for anything else. */
-                    if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+                #if ( configEDF_SPLIT_TASK_ANALYSIS == 1 )
+                    if( pxTCB->uxTaskSplitCore != taskEDF_NOT_SPLIT )
                     {
-                        listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriorityToUse ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                        ulUtilisation[ pxTCB->uxTaskCore ] += taskEDF_UTILISATION( pxTCB->xTaskSplitBudget, pxTCB->xTaskPeriod );
+                        ulUtilisation[ pxTCB->uxTaskSplitCore ] += taskEDF_UTILISATION( pxTCB->xTaskWCET - pxTCB->xTaskSplitBudget, pxTCB->xTaskPeriod );
+                        sprintf( pcWriteBuffer, "%s\t%u\t%u\t%u\r\n", pxTCB->pcTaskName, ( unsigned int ) pxTCB->uxTaskCore, ( unsigned int ) pxTCB->uxTaskSplitCore, ( unsigned int ) pxTCB->xTaskSplitBudget ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
                     }
                     else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    /* If the running task is not the task that holds the mutex
-                     * then the task that holds the mutex could be in either the
-                     * Ready, Blocked or Suspended states.  Only remove the task
-                     * from its current state list if it is in the Ready state as
-                     * the task's priority is going to change and there is one
-                     * Ready list per priority. */
-                    if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
-                    {
-                        if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-                        {
-                            /* It is known that the task is in its ready list so
-                             * there is no need to check again and the port level
-                             * reset macro can be called directly. */
-                            portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
+                #endif /* configEDF_SPLIT_TASK_ANALYSIS */
 
-                        prvAddTaskToReadyList( pxTCB );
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                if( pxTCB->uxTaskCore == taskEDF_NO_CORE )
+                {
+                    sprintf( pcWriteBuffer, "%s\t-\t-\t0\r\n", pxTCB->pcTaskName ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    ulUtilisation[ pxTCB->uxTaskCore ] += taskEDF_UTILISATION( pxTCB->xTaskWCET, pxTCB->xTaskPeriod );
+                    sprintf( pcWriteBuffer, "%s\t%u\t-\t%u\r\n", pxTCB->pcTaskName, ( unsigned int ) pxTCB->uxTaskCore, ( unsigned int ) pxTCB->xTaskWCET ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
                 }
+
+                pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
             }
-            else
+
+            for( uxCore = ( UBaseType_t ) 0U; uxCore < ( UBaseType_t ) configEDF_NUMBER_OF_CORES; uxCore++ )
             {
-                mtCOVERAGE_TEST_MARKER();
+                sprintf( pcWriteBuffer, "core %u\t%u\t%u\r\n", ( unsigned int ) uxCore, ( unsigned int ) ulUtilisation[ uxCore ], ( unsigned int ) ulCoreUtilisation[ uxCore ] ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
             }
         }
-        else
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PARTITION_ANALYSIS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
+TickType_t uxTaskResetEventItemValue( void )
+{
+    TickType_t uxReturn;
+
+    uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+
+    /* Reset the event list item to its normal value - so it can be used with
+     * queues and semaphores. */
+    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+    TaskHandle_t pvTaskIncrementMutexHeldCount( void )
+    {
+        /* If xSemaphoreCreateMutex() is called before any tasks have been created
+         * then pxCurrentTCB will be NULL. */
+        if( pxCurrentTCB != NULL )
         {
-            mtCOVERAGE_TEST_MARKER();
+            ( pxCurrentTCB->uxMutexesHeld )++;
         }
+
+        return pxCurrentTCB;
     }
 
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-    void vTaskEnterCritical( void )
+    uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWait,
+                                      BaseType_t xClearCountOnExit,
+                                      TickType_t xTicksToWait )
     {
-        portDISABLE_INTERRUPTS();
+        uint32_t ulReturn;
 
-        if( xSchedulerRunning != pdFALSE )
+        configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+        taskENTER_CRITICAL();
         {
-            ( pxCurrentTCB->uxCriticalNesting )++;
+            /* Only block if the notification count is not already non-zero. */
+            if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] == 0UL )
+            {
+                /* Mark this task as waiting for a notification. */
+                pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
 
-            /* This is not the interrupt safe version of the enter critical
-             * function so  assert() if it is being called from an interrupt
-             * context.  Only API functions that end in "FromISR" can be used in an
-             * interrupt.  Only assert if the critical nesting count is 1 to
-             * protect against recursive calls if the assert function also uses a
-             * critical section. */
-            if( pxCurrentTCB->uxCriticalNesting == 1 )
+                if( xTicksToWait > ( TickType_t ) 0 )
+                {
+                    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+                    traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait );
+
+                    /* All ports are written to allow a yield in a critical
+                     * section (some will yield immediately, others wait until the
+                     * critical section exits) - but it is not something that
+                     * application code should ever do. */
+                    portYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
             {
-                portASSERT_IF_IN_ISR();
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-        else
+        taskEXIT_CRITICAL();
+
+        taskENTER_CRITICAL();
         {
-            mtCOVERAGE_TEST_MARKER();
+            traceTASK_NOTIFY_TAKE( uxIndexToWait );
+            ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
+
+            if( ulReturn != 0UL )
+            {
+                if( xClearCountOnExit != pdFALSE )
+                {
+                    pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = 0UL;
+                }
+                else
+                {
+                    pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = ulReturn - ( uint32_t ) 1;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
         }
+        taskEXIT_CRITICAL();
+
+        return ulReturn;
     }
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-    void vTaskExitCritical( void )
+    BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWait,
+                                       uint32_t ulBitsToClearOnEntry,
+                                       uint32_t ulBitsToClearOnExit,
+                                       uint32_t * pulNotificationValue,
+                                       TickType_t xTicksToWait )
     {
-        if( xSchedulerRunning != pdFALSE )
+        BaseType_t xReturn;
+
+        configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+        taskENTER_CRITICAL();
         {
-            if( pxCurrentTCB->uxCriticalNesting > 0U )
+            /* Only block if a notification is not already pending. */
+            if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
             {
-                ( pxCurrentTCB->uxCriticalNesting )--;
+                /* Clear bits in the task's notification value as bits may get
+                 * set  by the notifying task or interrupt.  This can be used to
+                 * clear the value to zero. */
+                pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnEntry;
 
-                if( pxCurrentTCB->uxCriticalNesting == 0U )
+                /* Mark this task as waiting for a notification. */
+                pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
+
+                if( xTicksToWait > ( TickType_t ) 0 )
                 {
-                    portENABLE_INTERRUPTS();
+                    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+                    traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait );
+
+                    /* All ports are written to allow a yield in a critical
+                     * section (some will yield immediately, others wait until the
+                     * critical section exits) - but it is not something that
+                     * application code should ever do. */
+                    portYIELD_WITHIN_API();
                 }
                 else
                 {
@@ -4626,369 +8584,464 @@ static void prvResetNextTaskUnblockTime( void )
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-        else
+        taskEXIT_CRITICAL();
+
+        taskENTER_CRITICAL();
         {
-            mtCOVERAGE_TEST_MARKER();
+            traceTASK_NOTIFY_WAIT( uxIndexToWait );
+
+            if( pulNotificationValue != NULL )
+            {
+                /* Output the current notification value, which may or may not
+                 * have changed. */
+                *pulNotificationValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
+            }
+
+            /* If ucNotifyValue is set then either the task never entered the
+             * blocked state (because a notification was already pending) or the
+             * task unblocked because of a notification.  Otherwise the task
+             * unblocked because of a timeout. */
+            if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
+            {
+                /* A notification was not received. */
+                xReturn = pdFALSE;
+            }
+            else
+            {
+                /* A notification was already pending or a notification was
+                 * received while the task was waiting. */
+                pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnExit;
+                xReturn = pdTRUE;
+            }
+
+            pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
         }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
     }
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-    static char * prvWriteNameToBuffer( char * pcBuffer,
-                                        const char * pcTaskName )
+    BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify,
+                                   UBaseType_t uxIndexToNotify,
+                                   uint32_t ulValue,
+                                   eNotifyAction eAction,
+                                   uint32_t * pulPreviousNotificationValue )
     {
-        size_t x;
+        TCB_t * pxTCB;
+        BaseType_t xReturn = pdPASS;
+        uint8_t ucOriginalNotifyState;
 
-        /* Start by copying the entire string. */
-        strcpy( pcBuffer, pcTaskName );
+        configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+        configASSERT( xTaskToNotify );
+        pxTCB = xTaskToNotify;
 
-        /* Pad the end of the string with spaces to ensure columns line up when
-         * printed out. */
-        for( x = strlen( pcBuffer ); x < ( size_t ) ( configMAX_TASK_NAME_LEN - 1 ); x++ )
+        taskENTER_CRITICAL();
         {
-            pcBuffer[ x ] = ' ';
-        }
-
-        /* Terminate. */
-        pcBuffer[ x ] = ( char ) 0x00;
-
-        /* Return the new end of string. */
-        return &( pcBuffer[ x ] );
-    }
-
-#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
-/*-----------------------------------------------------------*/
+            if( pulPreviousNotificationValue != NULL )
+            {
+                *pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+            }
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
 
-    void vTaskList( char * pcWriteBuffer )
-    {
-        TaskStatus_t * pxTaskStatusArray;
-        UBaseType_t uxArraySize, x;
-        char cStatus;
+            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-        /*
-         * PLEASE NOTE:
-         *
-         * This function is provided for convenience only, and is used by many
-         * of the demo applications.  Do not consider it to be part of the
-         * scheduler.
-         *
-         * vTaskList() calls uxTaskGetSystemState(), then formats part of the
-         * uxTaskGetSystemState() output into a human readable table that
-         * displays task: names, states, priority, stack usage and task number.
-         * Stack usage specified as the number of unused StackType_t words stack can hold
-         * on top of stack - not the number of bytes.
-         *
-         * vTaskList() has a dependency on the sprintf() C library function that
-         * might bloat the code size, use a lot of stack, and provide different
-         * results on different platforms.  An alternative, tiny, third party,
-         * and limited functionality implementation of sprintf() is provided in
-         * many of the FreeRTOS/Demo sub-directories in a file called
-         * printf-stdarg.c (note printf-stdarg.c does not provide a full
-         * snprintf() implementation!).
-         *
-         * It is recommended that production systems call uxTaskGetSystemState()
-         * directly to get access to raw stats data, rather than indirectly
-         * through a call to vTaskList().
-         */
+            switch( eAction )
+            {
+                case eSetBits:
+                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+                    break;
 
+                case eIncrement:
+                    ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+                    break;
 
-        /* Make sure the write buffer does not contain a string. */
-        *pcWriteBuffer = ( char ) 0x00;
+                case eSetValueWithOverwrite:
+                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+                    break;
 
-        /* Take a snapshot of the number of tasks in case it changes while this
-         * function is executing. */
-        uxArraySize = uxCurrentNumberOfTasks;
+                case eSetValueWithoutOverwrite:
 
-        /* Allocate an array index for each task.  NOTE!  if
-         * configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
-         * equate to NULL. */
-        pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+                    if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+                    {
+                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+                    }
+                    else
+                    {
+                        /* The value could not be written to the task. */
+                        xReturn = pdFAIL;
+                    }
 
-        if( pxTaskStatusArray != NULL )
-        {
-            /* Generate the (binary) data. */
-            uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+                    break;
 
-            /* Create a human readable table from the binary data. */
-            for( x = 0; x < uxArraySize; x++ )
-            {
-                switch( pxTaskStatusArray[ x ].eCurrentState )
-                {
-                    case eRunning:
-                        cStatus = tskRUNNING_CHAR;
-                        break;
+                case eNoAction:
 
-                    case eReady:
-                        cStatus = tskREADY_CHAR;
-                        break;
+                    /* The task is being notified without its notify value being
+                     * updated. */
+                    break;
 
-                    case eBlocked:
-                        cStatus = tskBLOCKED_CHAR;
-                        break;
+                default:
 
-                    case eSuspended:
-                        cStatus = tskSUSPENDED_CHAR;
-                        break;
+                    /* Should not get here if all enums are handled.
+                     * Artificially force an assert by testing a value the
+                     * compiler can't assume is const. */
+                    configASSERT( xTickCount == ( TickType_t ) 0 );
 
-                    case eDeleted:
-                        cStatus = tskDELETED_CHAR;
-                        break;
+                    break;
+            }
 
-                    case eInvalid: /* Fall through. */
-                    default:       /* Should not get here, but it is included
-                                    * to prevent static checking errors. */
-                        cStatus = ( char ) 0x00;
-                        break;
-                }
+            traceTASK_NOTIFY( uxIndexToNotify );
 
-                /* Write the task name to the string, padding with spaces so it
-                 * can be printed in tabular form more easily. */
-                pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+            /* If the task is in the blocked state specifically to wait for a
+             * notification then unblock it now. */
+            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+            {
+                listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                prvAddTaskToReadyList( pxTCB );
 
-                /* Write the rest of the string. */
-                sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-                pcWriteBuffer += strlen( pcWriteBuffer );                                                                                                                                                                                                /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
-            }
+                /* The task should not have been on an event list. */
+                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
-            /* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
-             * is 0 then vPortFree() will be #defined to nothing. */
-            vPortFree( pxTaskStatusArray );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
+                #if ( configUSE_TICKLESS_IDLE != 0 )
+                    {
+                        /* If a task is blocked waiting for a notification then
+                         * xNextTaskUnblockTime might be set to the blocked task's time
+                         * out time.  If the task is unblocked for a reason other than
+                         * a timeout xNextTaskUnblockTime is normally left unchanged,
+                         * because it will automatically get reset to a new value when
+                         * the tick count equals xNextTaskUnblockTime.  However if
+                         * tickless idling is used it might be more important to enter
+                         * sleep mode at the earliest possible time - so reset
+                         * xNextTaskUnblockTime here to ensure it is updated at the
+                         * earliest possible time. */
+                        prvResetNextTaskUnblockTime();
+                    }
+                #endif
+
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( taskEDF_SHOULD_PREEMPT_STRICT( pxTCB ) )
+                #else
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                #endif
+                {
+                    /* The notified task has a priority above the currently
+                     * executing task so a yield is required. */
+                    taskYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
     }
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
-/*----------------------------------------------------------*/
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-    void vTaskGetRunTimeStats( char * pcWriteBuffer )
+    BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify,
+                                          UBaseType_t uxIndexToNotify,
+                                          uint32_t ulValue,
+                                          eNotifyAction eAction,
+                                          uint32_t * pulPreviousNotificationValue,
+                                          BaseType_t * pxHigherPriorityTaskWoken )
     {
-        TaskStatus_t * pxTaskStatusArray;
-        UBaseType_t uxArraySize, x;
-        configRUN_TIME_COUNTER_TYPE ulTotalTime, ulStatsAsPercentage;
-
-        #if ( configUSE_TRACE_FACILITY != 1 )
-            {
-                #error configUSE_TRACE_FACILITY must also be set to 1 in FreeRTOSConfig.h to use vTaskGetRunTimeStats().
-            }
-        #endif
-
-        /*
-         * PLEASE NOTE:
-         *
-         * This function is provided for convenience only, and is used by many
-         * of the demo applications.  Do not consider it to be part of the
-         * scheduler.
-         *
-         * vTaskGetRunTimeStats() calls uxTaskGetSystemState(), then formats part
-         * of the uxTaskGetSystemState() output into a human readable table that
-         * displays the amount of time each task has spent in the Running state
-         * in both absolute and percentage terms.
-         *
-         * vTaskGetRunTimeStats() has a dependency on the sprintf() C library
-         * function that might bloat the code size, use a lot of stack, and
-         * provide different results on different platforms.  An alternative,
-         * tiny, third party, and limited functionality implementation of
-         * sprintf() is provided in many of the FreeRTOS/Demo sub-directories in
-         * a file called printf-stdarg.c (note printf-stdarg.c does not provide
-         * a full snprintf() implementation!).
-         *
-         * It is recommended that production systems call uxTaskGetSystemState()
-         * directly to get access to raw stats data, rather than indirectly
-         * through a call to vTaskGetRunTimeStats().
-         */
+        TCB_t * pxTCB;
+        uint8_t ucOriginalNotifyState;
+        BaseType_t xReturn = pdPASS;
+        UBaseType_t uxSavedInterruptStatus;
 
-        /* Make sure the write buffer does not contain a string. */
-        *pcWriteBuffer = ( char ) 0x00;
+        configASSERT( xTaskToNotify );
+        configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
-        /* Take a snapshot of the number of tasks in case it changes while this
-         * function is executing. */
-        uxArraySize = uxCurrentNumberOfTasks;
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum  system call (or maximum API call) interrupt priority.
+         * Interrupts that are  above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+         * is defined in FreeRTOSConfig.h then
+         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+         * failure if a FreeRTOS API function is called from an interrupt that has
+         * been assigned a priority above the configured maximum system call
+         * priority.  Only FreeRTOS functions that end in FromISR can be called
+         * from interrupts  that have been assigned a priority at or (logically)
+         * below the maximum system call interrupt priority.  FreeRTOS maintains a
+         * separate interrupt safe API to ensure interrupt entry is as fast and as
+         * simple as possible.  More information (albeit Cortex-M specific) is
+         * provided on the following link:
+         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-        /* Allocate an array index for each task.  NOTE!  If
-         * configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
-         * equate to NULL. */
-        pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+        pxTCB = xTaskToNotify;
 
-        if( pxTaskStatusArray != NULL )
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
         {
-            /* Generate the (binary) data. */
-            uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+            if( pulPreviousNotificationValue != NULL )
+            {
+                *pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+            }
 
-            /* For percentage calculations. */
-            ulTotalTime /= 100UL;
+            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-            /* Avoid divide by zero errors. */
-            if( ulTotalTime > 0UL )
+            switch( eAction )
             {
-                /* Create a human readable table from the binary data. */
-                for( x = 0; x < uxArraySize; x++ )
-                {
-                    /* What percentage of the total run time has the task used?
-                     * This will always be rounded down to the nearest integer.
-                     * ulTotalRunTime has already been divided by 100. */
-                    ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
+                case eSetBits:
+                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+                    break;
 
-                    /* Write the task name to the string, padding with
-                     * spaces so it can be printed in tabular form more
-                     * easily. */
-                    pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+                case eIncrement:
+                    ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+                    break;
 
-                    if( ulStatsAsPercentage > 0UL )
-                    {
-                        #ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-                            {
-                                sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
-                            }
-                        #else
-                            {
-                                /* sizeof( int ) == sizeof( long ) so a smaller
-                                 * printf() library can be used. */
-                                sprintf( pcWriteBuffer, "\t%u\t\t%u%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-                            }
-                        #endif
+                case eSetValueWithOverwrite:
+                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+                    break;
+
+                case eSetValueWithoutOverwrite:
+
+                    if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+                    {
+                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
                     }
                     else
                     {
-                        /* If the percentage is zero here then the task has
-                         * consumed less than 1% of the total run time. */
-                        #ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-                            {
-                                sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
-                            }
-                        #else
-                            {
-                                /* sizeof( int ) == sizeof( long ) so a smaller
-                                 * printf() library can be used. */
-                                sprintf( pcWriteBuffer, "\t%u\t\t<1%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-                            }
-                        #endif
+                        /* The value could not be written to the task. */
+                        xReturn = pdFAIL;
                     }
 
-                    pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
-                }
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+                    break;
 
-            /* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
-             * is 0 then vPortFree() will be #defined to nothing. */
-            vPortFree( pxTaskStatusArray );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
-    }
+                case eNoAction:
 
-#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
-/*-----------------------------------------------------------*/
+                    /* The task is being notified without its notify value being
+                     * updated. */
+                    break;
 
-TickType_t uxTaskResetEventItemValue( void )
-{
-    TickType_t uxReturn;
+                default:
 
-    uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+                    /* Should not get here if all enums are handled.
+                     * Artificially force an assert by testing a value the
+                     * compiler can't assume is const. */
+                    configASSERT( xTickCount == ( TickType_t ) 0 );
+                    break;
+            }
 
-    /* Reset the event list item to its normal value - so it can be used with
-     * queues and semaphores. */
-    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+            traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify );
 
-    return uxReturn;
-}
-/*-----------------------------------------------------------*/
+            /* If the task is in the blocked state specifically to wait for a
+             * notification then unblock it now. */
+            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+            {
+                /* The task should not have been on an event list. */
+                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                taskLATENCY_WOKEN( pxTCB );
 
-#if ( configUSE_MUTEXES == 1 )
+                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+                {
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+                }
+                else
+                {
+                    /* The delayed and ready lists cannot be accessed, so hold
+                     * this task pending until the scheduler is resumed. */
+                    listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                }
 
-    TaskHandle_t pvTaskIncrementMutexHeldCount( void )
-    {
-        /* If xSemaphoreCreateMutex() is called before any tasks have been created
-         * then pxCurrentTCB will be NULL. */
-        if( pxCurrentTCB != NULL )
-        {
-            ( pxCurrentTCB->uxMutexesHeld )++;
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( taskEDF_SHOULD_PREEMPT_STRICT( pxTCB ) )
+                #else
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                #endif
+                {
+                    /* The notified task has a priority above the currently
+                     * executing task so a yield is required. */
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+
+                    /* Mark that a yield is pending in case the user is not
+                     * using the "xHigherPriorityTaskWoken" parameter to an ISR
+                     * safe FreeRTOS function. */
+                    xYieldPending = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
         }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-        return pxCurrentTCB;
+        return xReturn;
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-    uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWait,
-                                      BaseType_t xClearCountOnExit,
-                                      TickType_t xTicksToWait )
+    void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify,
+                                        UBaseType_t uxIndexToNotify,
+                                        BaseType_t * pxHigherPriorityTaskWoken )
     {
-        uint32_t ulReturn;
+        TCB_t * pxTCB;
+        uint8_t ucOriginalNotifyState;
+        UBaseType_t uxSavedInterruptStatus;
 
-        configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+        configASSERT( xTaskToNotify );
+        configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
-        taskENTER_CRITICAL();
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum  system call (or maximum API call) interrupt priority.
+         * Interrupts that are  above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+         * is defined in FreeRTOSConfig.h then
+         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+         * failure if a FreeRTOS API function is called from an interrupt that has
+         * been assigned a priority above the configured maximum system call
+         * priority.  Only FreeRTOS functions that end in FromISR can be called
+         * from interrupts  that have been assigned a priority at or (logically)
+         * below the maximum system call interrupt priority.  FreeRTOS maintains a
+         * separate interrupt safe API to ensure interrupt entry is as fast and as
+         * simple as possible.  More information (albeit Cortex-M specific) is
+         * provided on the following link:
+         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        pxTCB = xTaskToNotify;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
         {
-            /* Only block if the notification count is not already non-zero. */
-            if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] == 0UL )
+            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
+
+            /* 'Giving' is equivalent to incrementing a count in a counting
+             * semaphore. */
+            ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+
+            traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify );
+
+            /* If the task is in the blocked state specifically to wait for a
+             * notification then unblock it now. */
+            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
-                /* Mark this task as waiting for a notification. */
-                pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
+                /* The task should not have been on an event list. */
+                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                taskLATENCY_WOKEN( pxTCB );
 
-                if( xTicksToWait > ( TickType_t ) 0 )
+                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
-                    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-                    traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait );
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+                }
+                else
+                {
+                    /* The delayed and ready lists cannot be accessed, so hold
+                     * this task pending until the scheduler is resumed. */
+                    listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                }
 
-                    /* All ports are written to allow a yield in a critical
-                     * section (some will yield immediately, others wait until the
-                     * critical section exits) - but it is not something that
-                     * application code should ever do. */
-                    portYIELD_WITHIN_API();
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( taskEDF_SHOULD_PREEMPT_STRICT( pxTCB ) )
+                #else
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                #endif
+                {
+                    /* The notified task has a priority above the currently
+                     * executing task so a yield is required. */
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+
+                    /* Mark that a yield is pending in case the user is not
+                     * using the "xHigherPriorityTaskWoken" parameter in an ISR
+                     * safe FreeRTOS function. */
+                    xYieldPending = pdTRUE;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
         }
-        taskEXIT_CRITICAL();
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+    BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask,
+                                             UBaseType_t uxIndexToClear )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xReturn;
+
+        configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+        /* If null is passed in here then it is the calling task that is having
+         * its notification state cleared. */
+        pxTCB = prvGetTCBFromHandle( xTask );
 
         taskENTER_CRITICAL();
         {
-            traceTASK_NOTIFY_TAKE( uxIndexToWait );
-            ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
-
-            if( ulReturn != 0UL )
+            if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
             {
-                if( xClearCountOnExit != pdFALSE )
-                {
-                    pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = 0UL;
-                }
-                else
-                {
-                    pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = ulReturn - ( uint32_t ) 1;
-                }
+                pxTCB->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
+                xReturn = pdPASS;
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                xReturn = pdFAIL;
             }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+    uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask,
+                                            UBaseType_t uxIndexToClear,
+                                            uint32_t ulBitsToClear )
+    {
+        TCB_t * pxTCB;
+        uint32_t ulReturn;
+
+        /* If null is passed in here then it is the calling task that is having
+         * its notification state cleared. */
+        pxTCB = prvGetTCBFromHandle( xTask );
 
-            pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
+        taskENTER_CRITICAL();
+        {
+            /* Return the notification as it was before the bits were cleared,
+             * then clear the bit mask. */
+            ulReturn = pxTCB->ulNotifiedValue[ uxIndexToClear ];
+            pxTCB->ulNotifiedValue[ uxIndexToClear ] &= ~ulBitsToClear;
         }
         taskEXIT_CRITICAL();
 
@@ -4998,547 +9051,627 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
 
-    BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWait,
-                                       uint32_t ulBitsToClearOnEntry,
-                                       uint32_t ulBitsToClearOnExit,
-                                       uint32_t * pulNotificationValue,
-                                       TickType_t xTicksToWait )
+    configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask )
     {
-        BaseType_t xReturn;
-
-        configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+        TCB_t * pxTCB;
+        configRUN_TIME_COUNTER_TYPE ulReturn;
 
+        /* The counter is accumulated in vTaskSwitchContext(), so every task,
+         * periodic or not, is accounted without registering it anywhere.  The
+         * time since the running task was last switched in is not included.
+         * It can be wider than a single load, so it is read with the switch
+         * held off. */
         taskENTER_CRITICAL();
         {
-            /* Only block if a notification is not already pending. */
-            if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
-            {
-                /* Clear bits in the task's notification value as bits may get
-                 * set  by the notifying task or interrupt.  This can be used to
-                 * clear the value to zero. */
-                pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnEntry;
+            pxTCB = prvGetTCBFromHandle( xTask );
+            ulReturn = pxTCB->ulRunTimeCounter;
+        }
+        taskEXIT_CRITICAL();
 
-                /* Mark this task as waiting for a notification. */
-                pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
+        return ulReturn;
+    }
 
-                if( xTicksToWait > ( TickType_t ) 0 )
-                {
-                    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-                    traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait );
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
 
-                    /* All ports are written to allow a yield in a critical
-                     * section (some will yield immediately, others wait until the
-                     * critical section exits) - but it is not something that
-                     * application code should ever do. */
-                    portYIELD_WITHIN_API();
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
-        }
-        taskEXIT_CRITICAL();
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
+
+    configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimeCounter( void )
+    {
+        configRUN_TIME_COUNTER_TYPE ulReturn;
 
         taskENTER_CRITICAL();
         {
-            traceTASK_NOTIFY_WAIT( uxIndexToWait );
+            ulReturn = xIdleTaskHandle->ulRunTimeCounter;
+        }
+        taskEXIT_CRITICAL();
 
-            if( pulNotificationValue != NULL )
-            {
-                /* Output the current notification value, which may or may not
-                 * have changed. */
-                *pulNotificationValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
-            }
+        return ulReturn;
+    }
 
-            /* If ucNotifyValue is set then either the task never entered the
-             * blocked state (because a notification was already pending) or the
-             * task unblocked because of a notification.  Otherwise the task
-             * unblocked because of a timeout. */
-            if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
-            {
-                /* A notification was not received. */
-                xReturn = pdFALSE;
-            }
-            else
-            {
-                /* A notification was already pending or a notification was
-                 * received while the task was waiting. */
-                pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnExit;
-                xReturn = pdTRUE;
-            }
+#endif
+/*-----------------------------------------------------------*/
 
-            pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
+
+    configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimePercent( void )
+    {
+        configRUN_TIME_COUNTER_TYPE ulTotalTime, ulIdleTime, ulReturn;
+
+        /* Both counters are read together, the division is left outside. */
+        taskENTER_CRITICAL();
+        {
+            ulTotalTime = portGET_RUN_TIME_COUNTER_VALUE();
+            ulIdleTime = xIdleTaskHandle->ulRunTimeCounter;
         }
         taskEXIT_CRITICAL();
 
-        return xReturn;
+        /* For percentage calculations. */
+        ulTotalTime /= ( configRUN_TIME_COUNTER_TYPE ) 100;
+
+        /* Avoid divide by zero errors. */
+        if( ulTotalTime > ( configRUN_TIME_COUNTER_TYPE ) 0 )
+        {
+            ulReturn = ulIdleTime / ulTotalTime;
+        }
+        else
+        {
+            ulReturn = 0;
+        }
+
+        return ulReturn;
     }
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
+#endif /* if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+#if ( configUSE_CPU_LOAD_WINDOWS == 1 )
 
-    BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify,
-                                   UBaseType_t uxIndexToNotify,
-                                   uint32_t ulValue,
-                                   eNotifyAction eAction,
-                                   uint32_t * pulPreviousNotificationValue )
+    static UBaseType_t prvGetLoadPermille( configRUN_TIME_COUNTER_TYPE ulPart,
+                                           configRUN_TIME_COUNTER_TYPE ulWhole )
     {
-        TCB_t * pxTCB;
-        BaseType_t xReturn = pdPASS;
-        uint8_t ucOriginalNotifyState;
-
-        configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
-        configASSERT( xTaskToNotify );
-        pxTCB = xTaskToNotify;
+        UBaseType_t uxReturn;
 
-        taskENTER_CRITICAL();
+        if( ulWhole == ( configRUN_TIME_COUNTER_TYPE ) 0 )
         {
-            if( pulPreviousNotificationValue != NULL )
+            uxReturn = ( UBaseType_t ) 0U;
+        }
+        else if( ulPart >= ulWhole )
+        {
+            uxReturn = ( UBaseType_t ) taskLOAD_FULL_SCALE;
+        }
+        else if( ulWhole <= ( configRUN_TIME_COUNTER_TYPE ) ( 0xFFFFFFFFUL / ( uint32_t ) taskLOAD_FULL_SCALE ) )
+        {
+            /* The usual case, kept to 32 bit arithmetic when the counter type
+             * is wider. */
+            uxReturn = ( UBaseType_t ) ( ( ( uint32_t ) ulPart * ( uint32_t ) taskLOAD_FULL_SCALE ) / ( uint32_t ) ulWhole );
+        }
+        else
+        {
+            /* Drop low bits of both counts until the product cannot overflow
+             * rather than using a wider type. */
+            while( ulWhole > ( ( ( configRUN_TIME_COUNTER_TYPE ) ~( configRUN_TIME_COUNTER_TYPE ) 0 ) / taskLOAD_FULL_SCALE ) )
             {
-                *pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+                ulWhole >>= 1;
+                ulPart >>= 1;
             }
 
-            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+            uxReturn = ( UBaseType_t ) ( ( ulPart * taskLOAD_FULL_SCALE ) / ulWhole );
+        }
 
-            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
 
-            switch( eAction )
-            {
-                case eSetBits:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
-                    break;
+    static void prvSampleCpuLoad( void )
+    {
+        configRUN_TIME_COUNTER_TYPE ulNow, ulElapsed, ulIdle, ulRunTime;
+        LoadSlot_t * pxSlot;
+        TCB_t * pxTCB;
+        UBaseType_t uxIndex;
 
-                case eIncrement:
-                    ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
-                    break;
+        #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+            portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+        #else
+            ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+        #endif
 
-                case eSetValueWithOverwrite:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-                    break;
+        ulElapsed = ulNow - ulLoadSampleTime;
+        ulLoadSampleTime = ulNow;
 
-                case eSetValueWithoutOverwrite:
+        /* The counter of the running task is only brought up to date when it
+         * is switched out, so the time since it was switched in is added. */
+        ulIdle = xIdleTaskHandle->ulRunTimeCounter;
 
-                    if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
-                    {
-                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-                    }
-                    else
-                    {
-                        /* The value could not be written to the task. */
-                        xReturn = pdFAIL;
-                    }
+        if( xIdleTaskHandle == pxCurrentTCB )
+        {
+            ulIdle += ulNow - ulTaskSwitchedInTime;
+        }
 
-                    break;
+        xLoadWindows[ 0 ].ulElapsed = ulElapsed;
+        xLoadWindows[ 0 ].ulBusy = ulElapsed - ( ulIdle - ulLoadIdleRunTime );
+        ulLoadIdleRunTime = ulIdle;
 
-                case eNoAction:
+        /* vTaskSwitchContext() drops the run time that spans a wrap of the
+         * counter, so the idle counter can end up behind the time this sample
+         * added for it.  The sample is then counted as idle. */
+        if( xLoadWindows[ 0 ].ulBusy > ulElapsed )
+        {
+            xLoadWindows[ 0 ].ulBusy = ( configRUN_TIME_COUNTER_TYPE ) 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-                    /* The task is being notified without its notify value being
-                     * updated. */
-                    break;
+        /* The sample replaces the oldest one in the short window. */
+        pxSlot = &( xLoadSamples[ uxLoadSampleIndex ] );
+        xLoadWindows[ 1 ].ulElapsed += xLoadWindows[ 0 ].ulElapsed - pxSlot->ulElapsed;
+        xLoadWindows[ 1 ].ulBusy += xLoadWindows[ 0 ].ulBusy - pxSlot->ulBusy;
+        *pxSlot = xLoadWindows[ 0 ];
+        uxLoadSampleIndex++;
 
-                default:
+        /* Each time the short window has been renewed it is one block of the
+         * long window. */
+        if( uxLoadSampleIndex >= ( UBaseType_t ) configCPU_LOAD_WINDOW_SAMPLES )
+        {
+            uxLoadSampleIndex = ( UBaseType_t ) 0U;
 
-                    /* Should not get here if all enums are handled.
-                     * Artificially force an assert by testing a value the
-                     * compiler can't assume is const. */
-                    configASSERT( xTickCount == ( TickType_t ) 0 );
+            pxSlot = &( xLoadBlocks[ uxLoadBlockIndex ] );
+            xLoadWindows[ 2 ].ulElapsed += xLoadWindows[ 1 ].ulElapsed - pxSlot->ulElapsed;
+            xLoadWindows[ 2 ].ulBusy += xLoadWindows[ 1 ].ulBusy - pxSlot->ulBusy;
+            *pxSlot = xLoadWindows[ 1 ];
+            uxLoadBlockIndex++;
 
-                    break;
+            if( uxLoadBlockIndex >= ( UBaseType_t ) configCPU_LOAD_WINDOW_SAMPLES )
+            {
+                uxLoadBlockIndex = ( UBaseType_t ) 0U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-            traceTASK_NOTIFY( uxIndexToNotify );
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxPeriodicTaskCount; uxIndex++ )
+        {
+            pxTCB = pxPeriodicTasks[ uxIndex ];
+            ulRunTime = pxTCB->ulRunTimeCounter;
 
-            /* If the task is in the blocked state specifically to wait for a
-             * notification then unblock it now. */
-            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+            if( pxTCB == pxCurrentTCB )
             {
-                listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                prvAddTaskToReadyList( pxTCB );
+                ulRunTime += ulNow - ulTaskSwitchedInTime;
+            }
 
-                /* The task should not have been on an event list. */
-                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+            pxTCB->uxTaskLoadShare = prvGetLoadPermille( ulRunTime - pxTCB->ulTaskLoadRunTime, ulElapsed );
+            pxTCB->ulTaskLoadRunTime = ulRunTime;
+        }
+    }
+/*-----------------------------------------------------------*/
 
-                #if ( configUSE_TICKLESS_IDLE != 0 )
-                    {
-                        /* If a task is blocked waiting for a notification then
-                         * xNextTaskUnblockTime might be set to the blocked task's time
-                         * out time.  If the task is unblocked for a reason other than
-                         * a timeout xNextTaskUnblockTime is normally left unchanged,
-                         * because it will automatically get reset to a new value when
-                         * the tick count equals xNextTaskUnblockTime.  However if
-                         * tickless idling is used it might be more important to enter
-                         * sleep mode at the earliest possible time - so reset
-                         * xNextTaskUnblockTime here to ensure it is updated at the
-                         * earliest possible time. */
-                        prvResetNextTaskUnblockTime();
-                    }
-                #endif
+    UBaseType_t uxTaskGetCpuLoad( UBaseType_t uxWindow )
+    {
+        LoadSlot_t xWindow;
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-                {
-                    /* The notified task has a priority above the currently
-                     * executing task so a yield is required. */
-                    taskYIELD_IF_USING_PREEMPTION();
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+        configASSERT( uxWindow < taskLOAD_WINDOWS );
+
+        taskENTER_CRITICAL();
+        {
+            xWindow = xLoadWindows[ uxWindow ];
+        }
+        taskEXIT_CRITICAL();
+
+        return prvGetLoadPermille( xWindow.ulBusy, xWindow.ulElapsed );
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskGetLoadShare( TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+        UBaseType_t uxReturn;
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            uxReturn = pxTCB->uxTaskLoadShare;
         }
         taskEXIT_CRITICAL();
 
-        return xReturn;
+        return uxReturn;
     }
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
+#endif /* configUSE_CPU_LOAD_WINDOWS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+#if ( configUSE_TRACE_RECORDER == 1 )
 
-    BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify,
-                                          UBaseType_t uxIndexToNotify,
-                                          uint32_t ulValue,
-                                          eNotifyAction eAction,
-                                          uint32_t * pulPreviousNotificationValue,
-                                          BaseType_t * pxHigherPriorityTaskWoken )
+    static void prvTraceRecord( uint8_t ucEvent,
+                                const TCB_t * pxTCB,
+                                uint32_t ulData )
     {
-        TCB_t * pxTCB;
-        uint8_t ucOriginalNotifyState;
-        BaseType_t xReturn = pdPASS;
-        UBaseType_t uxSavedInterruptStatus;
+        UBaseType_t uxChar;
+        uint32_t ulTime;
 
-        configASSERT( xTaskToNotify );
-        configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+        if( ucEvent == taskTRACE_NAME )
+        {
+            ulTime = 0UL;
 
-        /* RTOS ports that support interrupt nesting have the concept of a
-         * maximum  system call (or maximum API call) interrupt priority.
-         * Interrupts that are  above the maximum system call priority are keep
-         * permanently enabled, even when the RTOS kernel is in a critical section,
-         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-         * is defined in FreeRTOSConfig.h then
-         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-         * failure if a FreeRTOS API function is called from an interrupt that has
-         * been assigned a priority above the configured maximum system call
-         * priority.  Only FreeRTOS functions that end in FromISR can be called
-         * from interrupts  that have been assigned a priority at or (logically)
-         * below the maximum system call interrupt priority.  FreeRTOS maintains a
-         * separate interrupt safe API to ensure interrupt entry is as fast and as
-         * simple as possible.  More information (albeit Cortex-M specific) is
-         * provided on the following link:
-         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+            for( uxChar = ( UBaseType_t ) 0U; ( uxChar < ( UBaseType_t ) 4U ) && ( ( ulData + uxChar ) < ( uint32_t ) configMAX_TASK_NAME_LEN ); uxChar++ )
+            {
+                ulTime |= ( ( uint32_t ) ( uint8_t ) pxTCB->pcTaskName[ ulData + uxChar ] ) << ( uxChar * 8U );
+            }
+        }
+        else
+        {
+            ulTime = portTRACE_GET_TIME();
+        }
 
-        pxTCB = xTaskToNotify;
+        prvTraceRecordValue( ucEvent, pxTCB, ulTime, ulData );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTraceRecordValue( uint8_t ucEvent,
+                                     const TCB_t * pxTCB,
+                                     uint32_t ulValue,
+                                     uint32_t ulData )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        TraceRecord_t * pxRecord;
+        uint32_t ulHead;
 
+        /* Callers at task level are in a critical section already.  This
+         * only covers ports whose interrupts nest, as the reader never masks
+         * them. */
         uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
         {
-            if( pulPreviousNotificationValue != NULL )
+            ulHead = ulTraceHead;
+
+            /* Say how many records were lost before the first one that fits,
+             * if there is room for both. */
+            if( ( ulTraceDropped != 0UL ) && ( ( ulHead - ulTraceTail ) < ( uint32_t ) ( configTRACE_RECORDER_RECORDS - 1 ) ) )
             {
-                *pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+                pxRecord = &( xTraceRecords[ ulHead & ( uint32_t ) ( configTRACE_RECORDER_RECORDS - 1 ) ] );
+                pxRecord->ulTime = portTRACE_GET_TIME();
+                pxRecord->ucEvent = taskTRACE_OVERFLOW;
+                pxRecord->ucTask = ( uint8_t ) 0U;
+                pxRecord->usData = ( ulTraceDropped > 0xFFFFUL ) ? ( uint16_t ) 0xFFFFU : ( uint16_t ) ulTraceDropped;
+                ulTraceDropped = 0UL;
+                ulHead++;
             }
-
-            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
-            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
-
-            switch( eAction )
+            else
             {
-                case eSetBits:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
-                    break;
-
-                case eIncrement:
-                    ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
-                    break;
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-                case eSetValueWithOverwrite:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-                    break;
+            if( ( ulTraceDropped == 0UL ) && ( ( ulHead - ulTraceTail ) < ( uint32_t ) configTRACE_RECORDER_RECORDS ) )
+            {
+                pxRecord = &( xTraceRecords[ ulHead & ( uint32_t ) ( configTRACE_RECORDER_RECORDS - 1 ) ] );
+                pxRecord->ulTime = ulValue;
+                pxRecord->ucEvent = ucEvent;
+                pxRecord->ucTask = ( uint8_t ) pxTCB->uxTCBNumber;
+                pxRecord->usData = ( ulData > 0xFFFFUL ) ? ( uint16_t ) 0xFFFFU : ( uint16_t ) ulData;
+                ulHead++;
+            }
+            else
+            {
+                ulTraceDropped++;
+            }
 
-                case eSetValueWithoutOverwrite:
+            /* The reader only sees the records once they are complete. */
+            ulTraceHead = ulHead;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
 
-                    if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
-                    {
-                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-                    }
-                    else
-                    {
-                        /* The value could not be written to the task. */
-                        xReturn = pdFAIL;
-                    }
+    size_t xTaskTraceRead( void * pvBuffer,
+                           size_t xBufferLength )
+    {
+        uint32_t ulTail, ulHead;
+        size_t xCopied = ( size_t ) 0;
+        uint8_t * pucBuffer = ( uint8_t * ) pvBuffer;
 
-                    break;
+        configASSERT( pvBuffer );
 
-                case eNoAction:
+        /* Single reader: only the kernel moves ulTraceHead, and it never
+         * writes the records between ulTraceTail and ulTraceHead. */
+        ulTail = ulTraceTail;
+        ulHead = ulTraceHead;
 
-                    /* The task is being notified without its notify value being
-                     * updated. */
-                    break;
+        while( ( ulTail != ulHead ) && ( ( xBufferLength - xCopied ) >= sizeof( TraceRecord_t ) ) )
+        {
+            ( void ) memcpy( ( void * ) &( pucBuffer[ xCopied ] ), ( void * ) &( xTraceRecords[ ulTail & ( uint32_t ) ( configTRACE_RECORDER_RECORDS - 1 ) ] ), sizeof( TraceRecord_t ) );
+            xCopied += sizeof( TraceRecord_t );
+            ulTail++;
+        }
 
-                default:
+        /* Hands the slots back to the kernel. */
+        ulTraceTail = ulTail;
 
-                    /* Should not get here if all enums are handled.
-                     * Artificially force an assert by testing a value the
-                     * compiler can't assume is const. */
-                    configASSERT( xTickCount == ( TickType_t ) 0 );
-                    break;
-            }
+        return xCopied;
+    }
 
-            traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify );
+#endif /* configUSE_TRACE_RECORDER */
+/*-----------------------------------------------------------*/
 
-            /* If the task is in the blocked state specifically to wait for a
-             * notification then unblock it now. */
-            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
-            {
-                /* The task should not have been on an event list. */
-                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+#if ( configUSE_JOB_HISTOGRAMS == 1 )
 
-                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-                {
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
-                }
-                else
-                {
-                    /* The delayed and ready lists cannot be accessed, so hold
-                     * this task pending until the scheduler is resumed. */
-                    listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
-                }
+    static void prvJobHistogramAdd( TCB_t * pxTCB,
+                                    UBaseType_t uxHistogram,
+                                    uint32_t ulValue )
+    {
+        UBaseType_t uxBucket = ( UBaseType_t ) 0U;
+        uint32_t ulRemaining = ulValue;
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-                {
-                    /* The notified task has a priority above the currently
-                     * executing task so a yield is required. */
-                    if( pxHigherPriorityTaskWoken != NULL )
-                    {
-                        *pxHigherPriorityTaskWoken = pdTRUE;
-                    }
+        /* One bucket per power of 2. */
+        while( ( ulRemaining != 0UL ) && ( uxBucket < ( UBaseType_t ) ( configJOB_HISTOGRAM_BUCKETS - 1 ) ) )
+        {
+            ulRemaining >>= 1;
+            uxBucket++;
+        }
 
-                    /* Mark that a yield is pending in case the user is not
-                     * using the "xHigherPriorityTaskWoken" parameter to an ISR
-                     * safe FreeRTOS function. */
-                    xYieldPending = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
+        /* 32-bit counts, so a bucket saturates only after 2^32 jobs. */
+        if( pxTCB->ulJobHistogram[ uxHistogram ][ uxBucket ] != 0xFFFFFFFFUL )
+        {
+            ( pxTCB->ulJobHistogram[ uxHistogram ][ uxBucket ] )++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-        return xReturn;
+        if( ulValue > pxTCB->ulJobMax[ uxHistogram ] )
+        {
+            pxTCB->ulJobMax[ uxHistogram ] = ulValue;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
-
-#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-
-    void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify,
-                                        UBaseType_t uxIndexToNotify,
-                                        BaseType_t * pxHigherPriorityTaskWoken )
+    uint32_t ulTaskGetJobHistograms( TaskHandle_t xTask,
+                                     uint32_t * pulBuckets,
+                                     uint32_t * pulMax,
+                                     BaseType_t xReset )
     {
         TCB_t * pxTCB;
-        uint8_t ucOriginalNotifyState;
-        UBaseType_t uxSavedInterruptStatus;
+        uint32_t ulReturn;
 
-        configASSERT( xTaskToNotify );
-        configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+        /* pulBuckets takes the response time, lateness and release jitter
+         * histograms in turn, configJOB_HISTOGRAM_BUCKETS each, and pulMax
+         * the largest value of each.  Either can be NULL. */
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            ulReturn = pxTCB->ulJobCount;
 
-        /* RTOS ports that support interrupt nesting have the concept of a
-         * maximum  system call (or maximum API call) interrupt priority.
-         * Interrupts that are  above the maximum system call priority are keep
-         * permanently enabled, even when the RTOS kernel is in a critical section,
-         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-         * is defined in FreeRTOSConfig.h then
-         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-         * failure if a FreeRTOS API function is called from an interrupt that has
-         * been assigned a priority above the configured maximum system call
-         * priority.  Only FreeRTOS functions that end in FromISR can be called
-         * from interrupts  that have been assigned a priority at or (logically)
-         * below the maximum system call interrupt priority.  FreeRTOS maintains a
-         * separate interrupt safe API to ensure interrupt entry is as fast and as
-         * simple as possible.  More information (albeit Cortex-M specific) is
-         * provided on the following link:
-         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+            if( pulBuckets != NULL )
+            {
+                ( void ) memcpy( ( void * ) pulBuckets, ( void * ) pxTCB->ulJobHistogram, sizeof( pxTCB->ulJobHistogram ) );
+            }
 
-        pxTCB = xTaskToNotify;
+            if( pulMax != NULL )
+            {
+                ( void ) memcpy( ( void * ) pulMax, ( void * ) pxTCB->ulJobMax, sizeof( pxTCB->ulJobMax ) );
+            }
 
-        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
-        {
-            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
-            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
+            /* Reset in the same critical section so no job is lost between
+             * two snapshots. */
+            if( xReset != pdFALSE )
+            {
+                pxTCB->ulJobCount = 0UL;
+                ( void ) memset( ( void * ) pxTCB->ulJobMax, 0x00, sizeof( pxTCB->ulJobMax ) );
+                ( void ) memset( ( void * ) pxTCB->ulJobHistogram, 0x00, sizeof( pxTCB->ulJobHistogram ) );
+            }
+        }
+        taskEXIT_CRITICAL();
 
-            /* 'Giving' is equivalent to incrementing a count in a counting
-             * semaphore. */
-            ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+        return ulReturn;
+    }
 
-            traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify );
+#endif /* configUSE_JOB_HISTOGRAMS */
+/*-----------------------------------------------------------*/
 
-            /* If the task is in the blocked state specifically to wait for a
-             * notification then unblock it now. */
-            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
-            {
-                /* The task should not have been on an event list. */
-                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+#if ( ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 ) )
 
-                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-                {
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
-                }
-                else
-                {
-                    /* The delayed and ready lists cannot be accessed, so hold
-                     * this task pending until the scheduler is resumed. */
-                    listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
-                }
+    static void prvProfileAdd( ProfileStats_t * pxStats,
+                               uint32_t ulElapsed )
+    {
+        if( ( pxStats->ulCount == 0UL ) || ( ulElapsed < pxStats->ulMin ) )
+        {
+            pxStats->ulMin = ulElapsed;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-                {
-                    /* The notified task has a priority above the currently
-                     * executing task so a yield is required. */
-                    if( pxHigherPriorityTaskWoken != NULL )
-                    {
-                        *pxHigherPriorityTaskWoken = pdTRUE;
-                    }
+        if( ulElapsed > pxStats->ulMax )
+        {
+            pxStats->ulMax = ulElapsed;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-                    /* Mark that a yield is pending in case the user is not
-                     * using the "xHigherPriorityTaskWoken" parameter in an ISR
-                     * safe FreeRTOS function. */
-                    xYieldPending = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+        pxStats->ullTotal += ( uint64_t ) ulElapsed;
+        ( pxStats->ulCount )++;
+    }
+/*-----------------------------------------------------------*/
+
+    static uint32_t prvProfileRead( ProfileStats_t * pxStats,
+                                    uint32_t * pulMin,
+                                    uint32_t * pulAverage,
+                                    uint32_t * pulMax,
+                                    BaseType_t xReset )
+    {
+        ProfileStats_t xStats;
+
+        /* Reset in the same critical section so nothing is lost between two
+         * snapshots. */
+        taskENTER_CRITICAL();
+        {
+            xStats = *pxStats;
+
+            if( xReset != pdFALSE )
+            {
+                ( void ) memset( ( void * ) pxStats, 0x00, sizeof( ProfileStats_t ) );
             }
         }
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-    }
+        taskEXIT_CRITICAL();
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
-/*-----------------------------------------------------------*/
+        /* The 64 bit division is left out of the critical section. */
+        if( pulAverage != NULL )
+        {
+            *pulAverage = ( xStats.ulCount != 0UL ) ? ( uint32_t ) ( xStats.ullTotal / ( uint64_t ) xStats.ulCount ) : 0UL;
+        }
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+        if( pulMin != NULL )
+        {
+            *pulMin = xStats.ulMin;
+        }
 
-    BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask,
-                                             UBaseType_t uxIndexToClear )
-    {
-        TCB_t * pxTCB;
-        BaseType_t xReturn;
+        if( pulMax != NULL )
+        {
+            *pulMax = xStats.ulMax;
+        }
 
-        configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+        return xStats.ulCount;
+    }
 
-        /* If null is passed in here then it is the calling task that is having
-         * its notification state cleared. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+#endif /* ( configUSE_KERNEL_PROFILING == 1 ) || ( configUSE_ISR_LATENCY == 1 ) */
+/*-----------------------------------------------------------*/
 
-        taskENTER_CRITICAL();
+#if ( configUSE_KERNEL_PROFILING == 1 )
+
+    static void prvProfileCriticalEnter( void )
+    {
+        /* No task runs yet while the first one is created. */
+        if( pxCurrentTCB != NULL )
         {
-            if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
+            if( pxCurrentTCB->uxProfileCriticalNesting == ( UBaseType_t ) 0U )
             {
-                pxTCB->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
-                xReturn = pdPASS;
+                pxCurrentTCB->ulProfileCriticalTime = 0UL;
+                pxCurrentTCB->ulProfileCriticalStart = portPROFILE_GET_TIME();
             }
             else
             {
-                xReturn = pdFAIL;
+                mtCOVERAGE_TEST_MARKER();
             }
-        }
-        taskEXIT_CRITICAL();
 
-        return xReturn;
+            ( pxCurrentTCB->uxProfileCriticalNesting )++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
-
-#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-
-    uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask,
-                                            UBaseType_t uxIndexToClear,
-                                            uint32_t ulBitsToClear )
+    static void prvProfileCriticalExit( void )
     {
-        TCB_t * pxTCB;
-        uint32_t ulReturn;
-
-        /* If null is passed in here then it is the calling task that is having
-         * its notification state cleared. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+        /* The nesting is still 0 if the critical section was entered before
+         * the first task was created. */
+        if( ( pxCurrentTCB != NULL ) && ( pxCurrentTCB->uxProfileCriticalNesting != ( UBaseType_t ) 0U ) )
+        {
+            ( pxCurrentTCB->uxProfileCriticalNesting )--;
 
-        taskENTER_CRITICAL();
+            if( pxCurrentTCB->uxProfileCriticalNesting == ( UBaseType_t ) 0U )
+            {
+                prvProfileAdd( &( xProfileStats[ taskPROFILE_CRITICAL ] ), pxCurrentTCB->ulProfileCriticalTime + ( portPROFILE_GET_TIME() - pxCurrentTCB->ulProfileCriticalStart ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
         {
-            /* Return the notification as it was before the bits were cleared,
-             * then clear the bit mask. */
-            ulReturn = pxTCB->ulNotifiedValue[ uxIndexToClear ];
-            pxTCB->ulNotifiedValue[ uxIndexToClear ] &= ~ulBitsToClear;
+            mtCOVERAGE_TEST_MARKER();
         }
-        taskEXIT_CRITICAL();
-
-        return ulReturn;
     }
-
-#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
-
-    configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimeCounter( void )
+    uint32_t ulTaskGetSchedulerProfile( UBaseType_t uxSection,
+                                        uint32_t * pulMin,
+                                        uint32_t * pulAverage,
+                                        uint32_t * pulMax,
+                                        BaseType_t xReset )
     {
-        return xIdleTaskHandle->ulRunTimeCounter;
+        configASSERT( uxSection < ( UBaseType_t ) taskPROFILE_SECTIONS );
+
+        return prvProfileRead( &( xProfileStats[ uxSection ] ), pulMin, pulAverage, pulMax, xReset );
     }
 
-#endif
+#endif /* configUSE_KERNEL_PROFILING */
 /*-----------------------------------------------------------*/
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
+#if ( configUSE_ISR_LATENCY == 1 )
 
-    configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimePercent( void )
+    void vTaskLatencyEnterISR( UBaseType_t uxSource )
     {
-        configRUN_TIME_COUNTER_TYPE ulTotalTime, ulReturn;
+        configASSERT( uxSource < ( UBaseType_t ) configISR_LATENCY_SOURCES );
 
-        ulTotalTime = portGET_RUN_TIME_COUNTER_VALUE();
+        ulLatencyStart = portLATENCY_GET_TIME();
+        uxLatencySource = uxSource + ( UBaseType_t ) 1U;
+    }
+/*-----------------------------------------------------------*/
 
-        /* For percentage calculations. */
-        ulTotalTime /= ( configRUN_TIME_COUNTER_TYPE ) 100;
+    void vTaskLatencyExitISR( void )
+    {
+        uxLatencySource = ( UBaseType_t ) 0U;
+    }
+/*-----------------------------------------------------------*/
 
-        /* Avoid divide by zero errors. */
-        if( ulTotalTime > ( configRUN_TIME_COUNTER_TYPE ) 0 )
-        {
-            ulReturn = xIdleTaskHandle->ulRunTimeCounter / ulTotalTime;
-        }
-        else
-        {
-            ulReturn = 0;
-        }
+    uint32_t ulTaskGetISRLatency( UBaseType_t uxSource,
+                                  uint32_t * pulMin,
+                                  uint32_t * pulAverage,
+                                  uint32_t * pulMax,
+                                  BaseType_t xReset )
+    {
+        configASSERT( uxSource < ( UBaseType_t ) configISR_LATENCY_SOURCES );
 
-        return ulReturn;
+        return prvProfileRead( &( xLatencyStats[ uxSource ] ), pulMin, pulAverage, pulMax, xReset );
     }
 
-#endif /* if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
+#endif /* configUSE_ISR_LATENCY */
 /*-----------------------------------------------------------*/
 
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                                             const BaseType_t xCanBlockIndefinitely )
 {
     TickType_t xTimeToWake;
-    const TickType_t xConstTickCount = xTickCount;
+    TickType_t xConstTickCount;
+
+    #if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+        {
+            /* Block times are counted from the tick count, as they are when
+             * the tick is periodic. */
+            taskENTER_CRITICAL();
+            taskCATCH_UP_EVENT_TICKS();
+            taskEXIT_CRITICAL();
+        }
+    #endif
+
+    xConstTickCount = xTickCount;
+
+    #if ( configUSE_TRACE_RECORDER == 1 )
+        {
+            /* Called at task level, where the tick interrupt can record too. */
+            taskENTER_CRITICAL();
+            taskTRACE_RECORD( taskTRACE_BLOCK, pxCurrentTCB, xTicksToWait );
+            taskEXIT_CRITICAL();
+        }
+    #endif
 
     #if ( INCLUDE_xTaskAbortDelay == 1 )
         {
@@ -5578,73 +9711,271 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                  * kernel will manage it correctly. */
                 xTimeToWake = xConstTickCount + xTicksToWait;
 
-                /* The list item will be inserted in wake time order. */
-                listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                    {
+                        prvAddCurrentTaskToDelayedTaskWheel( xTimeToWake, xConstTickCount );
+                    }
+                #else
+                    {
+                        /* The list item will be inserted in wake time order. */
+                        listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+
+                        if( xTimeToWake < xConstTickCount )
+                        {
+                            /* Wake time has overflowed.  Place this item in the
+                             * overflow list. */
+                            vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                        }
+                        else
+                        {
+                            /* The wake time has not overflowed, so the current
+                             * block list is used. */
+                            vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+                            /* If the task entering the blocked state was placed
+                             * at the head of the list of blocked tasks then
+                             * xNextTaskUnblockTime needs to be updated too. */
+                            if( xTimeToWake < xNextTaskUnblockTime )
+                            {
+                                xNextTaskUnblockTime = xTimeToWake;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    }
+                #endif /* configUSE_DELAYED_TASK_WHEEL */
+            }
+        }
+    #else /* INCLUDE_vTaskSuspend */
+        {
+            /* Calculate the time at which the task should be woken if the event
+             * does not occur.  This may overflow but this doesn't matter, the kernel
+             * will manage it correctly. */
+            xTimeToWake = xConstTickCount + xTicksToWait;
 
-                if( xTimeToWake < xConstTickCount )
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
                 {
-                    /* Wake time has overflowed.  Place this item in the overflow
-                     * list. */
-                    vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                    prvAddCurrentTaskToDelayedTaskWheel( xTimeToWake, xConstTickCount );
                 }
-                else
+            #else
                 {
-                    /* The wake time has not overflowed, so the current block list
-                     * is used. */
-                    vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                    /* The list item will be inserted in wake time order. */
+                    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-                    /* If the task entering the blocked state was placed at the
-                     * head of the list of blocked tasks then xNextTaskUnblockTime
-                     * needs to be updated too. */
-                    if( xTimeToWake < xNextTaskUnblockTime )
+                    if( xTimeToWake < xConstTickCount )
                     {
-                        xNextTaskUnblockTime = xTimeToWake;
+                        /* Wake time has overflowed.  Place this item in the
+                         * overflow list. */
+                        vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
                     }
                     else
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        /* The wake time has not overflowed, so the current block
+                         * list is used. */
+                        vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+                        /* If the task entering the blocked state was placed at
+                         * the head of the list of blocked tasks then
+                         * xNextTaskUnblockTime needs to be updated too. */
+                        if( xTimeToWake < xNextTaskUnblockTime )
+                        {
+                            xNextTaskUnblockTime = xTimeToWake;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
                     }
                 }
+            #endif /* configUSE_DELAYED_TASK_WHEEL */
+
+            /* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
+            ( void ) xCanBlockIndefinitely;
+        }
+    #endif /* INCLUDE_vTaskSuspend */
+}
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) )
+
+    static void prvAddCurrentTaskToReleaseList( const TickType_t xTimeToRelease,
+                                                const TickType_t xConstTickCount )
+    {
+        List_t * pxList;
+        ListItem_t * pxIterator;
+        const TCB_t * pxOther;
+
+        #if ( INCLUDE_xTaskAbortDelay == 1 )
+            {
+                /* As for prvAddCurrentTaskToDelayedList(). */
+                pxCurrentTCB->ucDelayAborted = pdFALSE;
             }
+        #endif
+
+        /* Remove the task from the ready list before adding it to the release
+         * list as the same list item is used for both lists. */
+        if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+        {
+            portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority ); /*lint !e931 pxCurrentTCB cannot change as it is the calling task.  pxCurrentTCB->uxPriority and uxTopReadyPriority cannot change as called with scheduler suspended or in a critical section. */
         }
-    #else /* INCLUDE_vTaskSuspend */
+        else
         {
-            /* Calculate the time at which the task should be woken if the event
-             * does not occur.  This may overflow but this doesn't matter, the kernel
-             * will manage it correctly. */
-            xTimeToWake = xConstTickCount + xTicksToWait;
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToRelease );
 
-            /* The list item will be inserted in wake time order. */
-            listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+        if( xTimeToRelease < xConstTickCount )
+        {
+            /* The release time has overflowed. */
+            pxList = pxOverflowReleaseList;
+        }
+        else
+        {
+            pxList = pxReleaseList;
 
-            if( xTimeToWake < xConstTickCount )
+            if( xTimeToRelease < xNextReleaseTime )
             {
-                /* Wake time has overflowed.  Place this item in the overflow list. */
-                vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                xNextReleaseTime = xTimeToRelease;
             }
             else
             {
-                /* The wake time has not overflowed, so the current block list is used. */
-                vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        /* Tasks released at the same tick are ordered as they will be in the
+         * EDF ready list, by relative deadline and then by configEDF_TIE_BREAK,
+         * so the tick can merge them in one pass. */
+        for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != listGET_END_MARKER( pxList ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+        {
+            pxOther = listGET_LIST_ITEM_OWNER( pxIterator ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            if( ( xTimeToRelease < listGET_LIST_ITEM_VALUE( pxIterator ) ) ||
+                ( ( xTimeToRelease == listGET_LIST_ITEM_VALUE( pxIterator ) ) &&
+                  ( ( taskEDF_RELATIVE_DEADLINE( pxCurrentTCB ) < taskEDF_RELATIVE_DEADLINE( pxOther ) ) ||
+                    ( ( taskEDF_RELATIVE_DEADLINE( pxCurrentTCB ) == taskEDF_RELATIVE_DEADLINE( pxOther ) ) &&
+                      ( taskEDF_TIE_BREAK( pxCurrentTCB, pxOther ) ) ) ) ) )
+            {
+                break;
+            }
+        }
+
+        prvInsertListItemBefore( pxList, &( pxCurrentTCB->xStateListItem ), pxIterator );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvReleasePeriodicTasks( const TickType_t xConstTickCount )
+    {
+        TCB_t * pxTCB;
+        TickType_t xReleaseTime, xBatchReleaseTime = ( TickType_t ) 0U;
+        ListItem_t * pxCursor = NULL;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        for( ; ; )
+        {
+            if( listLIST_IS_EMPTY( pxReleaseList ) != pdFALSE )
+            {
+                xNextReleaseTime = portMAX_DELAY;
+                break;
+            }
+
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxReleaseList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            xReleaseTime = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+            if( xConstTickCount < xReleaseTime )
+            {
+                xNextReleaseTime = xReleaseTime;
+                break; /*lint !e9011 Code structure here is deemed easier to understand with multiple breaks. */
+            }
+
+            listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
 
-                /* If the task entering the blocked state was placed at the head of the
-                 * list of blocked tasks then xNextTaskUnblockTime needs to be updated
-                 * too. */
-                if( xTimeToWake < xNextTaskUnblockTime )
+            #if ( configUSE_BULK_TICK_CATCH_UP == 1 )
                 {
-                    xNextTaskUnblockTime = xTimeToWake;
+                    /* Skipping releases can change the order of a batch, so
+                     * while the ticks are caught up each task is placed from
+                     * the head. */
+                    if( xCatchingUp != pdFALSE )
+                    {
+                        pxCursor = NULL;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xReleaseTime = prvSkipMissedReleases( pxTCB, xReleaseTime );
                 }
-                else
+            #endif
+
+            /* The tasks of one release tick come out in ready list order, so
+             * each one is placed after the one before it.  A task released at
+             * another tick starts a new search from the head. */
+            if( ( pxCursor == NULL ) || ( xReleaseTime != xBatchReleaseTime ) )
+            {
+                pxCursor = listGET_HEAD_ENTRY( &xReadyTasksListEDF );
+                xBatchReleaseTime = xReleaseTime;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The deadline is taken from the release time, as for a task woken
+             * from the delayed list. */
+            taskEDF_SET_RELEASE( pxTCB, xReleaseTime );
+            taskJOB_RELEASED( pxTCB, xReleaseTime );
+
+            traceMOVED_TASK_TO_READY_STATE( pxTCB );
+            pxCursor = prvInsertEDFReadyFrom( pxTCB, pxCursor );
+            tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );
+        }
+
+        if( pxCursor != NULL )
+        {
+            taskRECORD_READY_PRIORITY( configEDF_PRIORITY_BAND );
+
+            #if ( configUSE_PREEMPTION == 1 )
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    /* One decision for the whole batch: only the new head of
+                     * the EDF ready list can preempt the running task. */
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( &xReadyTasksListEDF ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                    if( ( pxTCB != pxCurrentTCB ) && ( taskEDF_SHOULD_PREEMPT( pxTCB ) ) )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
-            }
+            #endif /* configUSE_PREEMPTION */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-            /* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
-            ( void ) xCanBlockIndefinitely;
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvResetNextReleaseTime( void )
+    {
+        if( listLIST_IS_EMPTY( pxReleaseList ) != pdFALSE )
+        {
+            xNextReleaseTime = portMAX_DELAY;
         }
-    #endif /* INCLUDE_vTaskSuspend */
-}
+        else
+        {
+            xNextReleaseTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxReleaseList );
+        }
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_RELEASE_QUEUE == 1 ) */
 
 /* Code below here allows additional code to be inserted into this source file,
  * especially where access to file scope functions and data is needed (for example
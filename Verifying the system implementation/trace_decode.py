@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+"""Decode the kernel trace streamed by the trace drain task in main.c.
+
+The drain sends '#' lines of base64 frames over the UART, mixed with whatever
+the application prints.  Capture the serial port to a file (or read the
+device directly) and pass it here:
+
+    stty -F /dev/ttyUSB0 115200 raw
+    cat /dev/ttyUSB0 > run.log
+    python3 trace_decode.py run.log
+
+Each frame is a type byte, the payload and a checksum byte that makes the
+bytes add up to 0 modulo 256.  A header frame (type 1) holds "EDFT", the
+format version, the timer frequency (uint32) and the tick rate (uint16).  A
+records frame (type 2) holds 8 byte records, little-endian:
+
+    uint32 time     T1TC, four name characters in a NAME record, or the
+                    absolute deadline in a DEADLINE or DEADLINE_TIME record
+    uint8  event    see EVENTS
+    uint8  task     the kernel's TCB number, 0 for OVERFLOW
+    uint16 data     depends on the event, see tasks.c
+
+A host build of the kernel can instead write what xTaskTraceRead() returns
+straight to a file, which is read with --raw; host/trace.c does.  --chrome
+writes the schedule as Chrome trace event JSON for chrome://tracing or
+ui.perfetto.dev: one track per task with its execution slices, and markers at
+each release, absolute deadline and deadline miss.
+
+The deadline marker is the deadline the kernel gave the job.  A DEADLINE
+record holds it as a tick, placed relative to the release record before it.
+A DEADLINE_TIME record (configUSE_EDF_FINE_DEADLINES) holds it in deadline
+timer counts, which are taken to be counts of the timer that stamps the
+records, as T1TC is for both in main.c.
+"""
+
+import argparse
+import base64
+import binascii
+import json
+import struct
+import sys
+
+FRAME_HEADER = 0x01
+FRAME_RECORDS = 0x02
+RECORD = struct.Struct("<IBBH")
+
+EVENTS = {
+    1: "SWITCH_IN",
+    2: "SWITCH_OUT",
+    3: "RELEASE",
+    4: "DEADLINE",
+    5: "BLOCK",
+    6: "MISS",
+    7: "CREATE",
+    8: "NAME",
+    9: "OVERFLOW",
+    10: "DEADLINE_TIME",
+}
+
+# Records that hold a value in place of their time stamp, and share the time
+# of the record before them.
+VALUE_EVENTS = ("DEADLINE", "DEADLINE_TIME")
+
+FORMAT_VERSION = 2
+
+
+class Trace:
+    """Records read back from a capture, with their time unwrapped."""
+
+    def __init__(self, timer_hz=None):
+        self.timer_hz = timer_hz
+        self.tick_hz = None
+        self.names = {}
+        self.records = []  # (time in timer counts, event name, task, data, value or None)
+        self.bad_frames = 0
+        self.text_lines = 0
+        self._wraps = 0
+        self._last_time = None
+        self._name_parts = {}
+
+    def feed_line(self, line):
+        line = line.strip()
+        # The stack report's "#define" lines are text too.
+        if not line.startswith(b"#") or line.startswith(b"#define"):
+            if line:
+                self.text_lines += 1
+            return
+        try:
+            frame = base64.b64decode(line[1:], validate=True)
+        except (binascii.Error, ValueError):
+            self.bad_frames += 1
+            return
+        if len(frame) < 2 or sum(frame) & 0xFF:
+            self.bad_frames += 1
+            return
+        kind, payload = frame[0], frame[1:-1]
+        if kind == FRAME_HEADER and len(payload) >= 11 and payload[:4] == b"EDFT":
+            if payload[4] != FORMAT_VERSION:
+                raise SystemExit("unsupported trace format version %d" % payload[4])
+            timer_hz, self.tick_hz = struct.unpack_from("<IH", payload, 5)
+            if self.timer_hz is None:
+                self.timer_hz = timer_hz
+        elif kind == FRAME_RECORDS and len(payload) % RECORD.size == 0:
+            self.feed_records(payload)
+        else:
+            self.bad_frames += 1
+
+    def feed_records(self, data):
+        for offset in range(0, len(data) - len(data) % RECORD.size, RECORD.size):
+            self._add(*RECORD.unpack_from(data, offset))
+
+    def _add(self, time, event, task, data):
+        name = EVENTS.get(event, "EVENT_%d" % event)
+        if name == "NAME":
+            parts = self._name_parts.setdefault(task, {})
+            parts[data] = struct.pack("<I", time)
+            text = b"".join(parts[k] for k in sorted(parts))
+            self.names[task] = text.split(b"\0", 1)[0].decode("ascii", "replace")
+            return
+        if name == "CREATE":
+            self._name_parts.pop(task, None)
+        if name in VALUE_EVENTS:
+            self.records.append((self.records[-1][0] if self.records else 0, name, task, data, time))
+            return
+        # T1TC wraps after 2^32 counts, the records come in time order.
+        if self._last_time is not None and time < self._last_time and self._last_time - time > 0x80000000:
+            self._wraps += 1
+        self._last_time = time
+        self.records.append(((self._wraps << 32) + time, name, task, data, None))
+
+    def task_name(self, task):
+        return self.names.get(task, "task%d" % task)
+
+    def seconds(self, counts):
+        return counts / float(self.timer_hz) if self.timer_hz else None
+
+
+def read_trace(stream, timer_hz=None):
+    trace = Trace(timer_hz)
+    for line in stream:
+        trace.feed_line(line)
+    return trace
+
+
+def read_raw_trace(stream, timer_hz, tick_hz):
+    trace = Trace(timer_hz)
+    trace.tick_hz = tick_hz
+    trace.feed_records(stream.read())
+    return trace
+
+
+def print_text(trace, out):
+    for time, event, task, data, value in trace.records:
+        seconds = trace.seconds(time)
+        stamp = "%14.6f" % seconds if seconds is not None else "%14d" % time
+        who = "-" if event == "OVERFLOW" else trace.task_name(task)
+        extra = "" if value is None else " at %d" % value
+        out.write("%s  %-16s %-13s %d%s\n" % (stamp, who, event, data, extra))
+    if trace.bad_frames:
+        sys.stderr.write("%d corrupted frames skipped\n" % trace.bad_frames)
+
+
+def write_chrome(trace, out):
+    """Write the schedule as Chrome trace event JSON, times in microseconds."""
+    if not trace.timer_hz or not trace.tick_hz:
+        raise SystemExit("the timer and tick rates are needed, no header was found (see --hz and --tick-hz)")
+
+    def us(counts):
+        return counts * 1e6 / trace.timer_hz
+
+    counts_per_tick = float(trace.timer_hz) / trace.tick_hz
+    events = []
+    running = {}  # task -> time it was switched in
+    release = {}  # task -> time and low 16 bits of the tick of the current job's release
+    jobs = {}
+
+    for time, event, task, data, value in trace.records:
+        if event == "SWITCH_IN":
+            running[task] = time
+        elif event == "SWITCH_OUT" and task in running:
+            start = running.pop(task)
+            events.append({"name": "job %d" % jobs.get(task, 0), "ph": "X", "pid": 1, "tid": task,
+                           "ts": us(start), "dur": us(time - start)})
+        elif event == "RELEASE":
+            jobs[task] = jobs.get(task, 0) + 1
+            release[task] = (time, data)
+            events.append({"name": "release", "ph": "i", "s": "t", "pid": 1, "tid": task,
+                           "ts": us(time), "args": {"tick": data, "job": jobs[task]}})
+        elif event == "DEADLINE":
+            # Ticks from the release to the deadline tick, the release was
+            # stamped as its tick was processed.
+            release_time, release_tick = release.get(task, (time, value & 0xFFFF))
+            deadline = release_time + ((value - release_tick) & 0xFFFF) * counts_per_tick
+            events.append({"name": "deadline", "ph": "i", "s": "t", "pid": 1, "tid": task,
+                           "ts": us(deadline), "args": {"job": jobs.get(task, 0), "relative_ticks": data,
+                                                        "deadline_tick": value}})
+        elif event == "DEADLINE_TIME":
+            # The deadline count is unwrapped next to the release stamp.
+            release_time = release.get(task, (time, 0))[0]
+            offset = (value - release_time) & 0xFFFFFFFF
+            if offset >= 0x80000000:
+                offset -= 1 << 32
+            events.append({"name": "deadline", "ph": "i", "s": "t", "pid": 1, "tid": task,
+                           "ts": us(release_time + offset), "args": {"job": jobs.get(task, 0), "relative_ticks": data,
+                                                                     "deadline_counts": value}})
+        elif event == "MISS":
+            events.append({"name": "miss", "ph": "i", "s": "p", "pid": 1, "tid": task,
+                           "ts": us(time), "args": {"misses": data}})
+        elif event == "BLOCK":
+            events.append({"name": "block", "ph": "i", "s": "t", "pid": 1, "tid": task,
+                           "ts": us(time), "args": {"ticks": data}})
+        elif event == "OVERFLOW":
+            events.append({"name": "%d records lost" % data, "ph": "i", "s": "g", "pid": 1, "tid": 0,
+                           "ts": us(time)})
+
+    if trace.records:
+        end = trace.records[-1][0]
+        for task, start in running.items():
+            events.append({"name": "job %d" % jobs.get(task, 0), "ph": "X", "pid": 1, "tid": task,
+                           "ts": us(start), "dur": us(end - start)})
+
+    events.sort(key=lambda e: e["ts"])
+    meta = [{"name": "process_name", "ph": "M", "pid": 1, "args": {"name": "EDF kernel"}}]
+    for task in sorted(set(r[2] for r in trace.records) | set(trace.names)):
+        meta.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": task,
+                     "args": {"name": trace.task_name(task)}})
+        meta.append({"name": "thread_sort_index", "ph": "M", "pid": 1, "tid": task,
+                     "args": {"sort_index": task}})
+
+    json.dump({"traceEvents": meta + events, "displayTimeUnit": "ms"}, out)
+    out.write("\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("capture", nargs="?", help="serial capture, stdin if left out")
+    parser.add_argument("--hz", type=int, help="timer frequency, overrides the header")
+    parser.add_argument("--tick-hz", type=int, default=1000, help="tick rate of a --raw capture")
+    parser.add_argument("--raw", action="store_true", help="the capture holds bare records from xTaskTraceRead()")
+    parser.add_argument("--chrome", metavar="FILE", help="write Chrome/Perfetto trace JSON to FILE instead of text")
+    args = parser.parse_args()
+
+    stream = open(args.capture, "rb") if args.capture else sys.stdin.buffer
+    with stream:
+        if args.raw:
+            if not args.hz:
+                parser.error("--raw needs --hz")
+            trace = read_raw_trace(stream, args.hz, args.tick_hz)
+        else:
+            trace = read_trace(stream, args.hz)
+
+    if args.chrome:
+        with open(args.chrome, "w") as out:
+            write_chrome(trace, out)
+    else:
+        print_text(trace, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()